@@ -62,6 +62,7 @@ B35993, BRNY001				10/07/2015 	   		  		Driver created
 BRNY001						18/08/2015       			AMUX defines
 BRNY001						30/11/2016	   				Corrected register definition for V1.1 (INIT_FAULT, INIT_SUPERVISOR)
 BRNY001						04/10/2017					Bug correction in the union LDT_WAKE_UP_3_Tx_32B_tag
+BRNY001						19/10/2026					Target bit field order in the host build (MPC5744P_HOST)
 
 
 ---------------------------   ----------    ------------  ------------------------------------------
@@ -72,6 +73,10 @@ BRNY001						04/10/2017					Bug correction in the union LDT_WAKE_UP_3_Tx_32B_tag
 
 #define FS65_V11 1
 
+#ifdef MPC5744P_HOST
+#pragma scalar_storage_order big-endian		//host build (Host/SIM): bit fields in the target order
+#endif
+
 /****************************************************************************\
 * Addresses of the FS6500/FS4500 registers
 \****************************************************************************/
@@ -1578,4 +1583,8 @@ typedef union { ///DEVICE_ID_FS_Rx
 	} B;
 } DEVICE_ID_FS_Rx_32B_tag;
 
+#ifdef MPC5744P_HOST
+#pragma scalar_storage_order default
+#endif
+
 #endif
@@ -59,6 +59,15 @@ Revision History:
                              Modification     Function
 Author (core ID)              Date D/M/Y       Name		  		Description of Changes
 BRNY001					      22/04/2016       YBR				Initial creation
+BRNY001					      19/10/2026       FS65_SendBatch	Batched register access
+BRNY001					      19/10/2026       FS65_GetLatency	Event latency histograms
+BRNY001					      19/10/2026       FS65_Snapshot	Sequence locked snapshots of INTstruct and voltages
+BRNY001					      19/10/2026       ALL				Target bit field order in the host build (MPC5744P_HOST)
+BRNY001					      19/10/2026       FS65_InitStep	Resumable initialization steps (BOOT sequencer)
+BRNY001					      19/10/2026       FS65_SaveVkam	Warm resume snapshot in the keep-alive RAM
+BRNY001					      19/10/2026       FS65_ApplyConfig	Configuration tables, only the registers not in effect written
+BRNY001					      19/10/2026       FS65_SaveVkam	Live WD LFSR in the snapshot, VKAM_Clear after a battery loss
+BRNY001					      19/10/2026       FS65_SendBatch	Ceiling released between chunks of FS65_BATCH_CHUNK commands
 
 ---------------------------   ----------    ------------  ------------------------------------------
 ==================================================================================================*/
@@ -70,6 +79,7 @@ BRNY001					      22/04/2016       YBR				Initial creation
 *   DEFINES
 ==================================================================================================*/
 #include "fs65xx.h"
+#include "SEQ.h"
 
 /*==================================================================================================
 *   ERROR TYPES
@@ -90,6 +100,43 @@ BRNY001					      22/04/2016       YBR				Initial creation
 #define FS65_STATUS_FAIL	0xA0
 #define FS65_RELEASE_FS		0xB0
 
+/****************************************************************************\
+* INIT (FS65_InitStep)
+\****************************************************************************/
+#define FS65_INIT_DONE			0			///initialization finished
+#define FS65_INIT_WAIT			1			///call again after the returned wait
+#define FS65_INIT_POLL_US		10			///poll period of FS1B_SNS (FS1B delay running)
+#define FS65_INIT_ABIST2_US		200			///duration of ABIST2 (FS1B, VAUX)
+
+/****************************************************************************\
+* VKAM (warm resume from LPOFF, FS65_SaveVkam)
+\****************************************************************************/
+#define FS65_VKAM_MAGIC			0x564B414DUL	///"VKAM", snapshot saved
+#define FS65_WARM_INIT_NB		16			///INIT registers written by the warm resume
+
+/****************************************************************************\
+* APPLY (configuration tables, FS65_ApplyConfig)
+\****************************************************************************/
+#define FS65_APPLY_MAX			16			///maximal number of registers of a table
+//Item flags
+#define FS65_APPLY_SECURE		0x01		///written with the security bits (fail-safe registers)
+#define FS65_APPLY_NIBBLE		0x02		///value written in the upper nibble, read back in the lower one
+//Sources of the content in effect
+#define FS65_APPLY_READ			0			///registers read in one batch
+#define FS65_APPLY_CACHED		1			///register shadow INTstruct (read since the last FS65 restart)
+//Diff reports (FS65_ConfigReport)
+#define FS65_CONFIG_MSM			0			///FS65_Init_MSM
+#define FS65_CONFIG_FSSM		1			///FS65_Init_FSSM
+#define FS65_CONFIG_NON_INIT	2			///FS65_Config_NonInit
+#define FS65_CONFIG_NB			3
+
+/****************************************************************************\
+* BATCH
+\****************************************************************************/
+#define FS65_BATCH_MAX			64			///maximal number of commands of FS65_SendBatch
+#define FS65_BATCH_CHUNK		8			///commands sent under one INT_CEIL_PRIORITY section (blocking of the WD ISR)
+#define FS65_BATCH_SECURE		0x00010000	///write command needs the security bits
+
 /****************************************************************************\
 * LONG_DURATION_TIMER
 \****************************************************************************/
@@ -153,6 +200,22 @@ BRNY001					      22/04/2016       YBR				Initial creation
 #define	WD_WIN_512			14
 #define	WD_WIN_1024			15
 
+/****************************************************************************\
+* Event latency (FS65_IsrSIUL entry to user callback)
+\****************************************************************************/
+#define	FS65_EVENT_SPI_G		0
+#define	FS65_EVENT_WU			1		///PHYWU, AutoWU and LDTWU callbacks
+#define	FS65_EVENT_CAN_G		2
+#define	FS65_EVENT_LIN_G		3
+#define	FS65_EVENT_IO_G			4
+#define	FS65_EVENT_Vpre_G		5
+#define	FS65_EVENT_Vcore_G		6
+#define	FS65_EVENT_Vothers_G	7		///VXXX callback
+#define	FS65_EVENT_NB			8
+
+#define	FS65_LATENCY_BUCKETS	16		///log2 buckets of a histogram
+#define	FS65_LATENCY_BASE_LOG2	7		///bucket 0 below 2^7 time base ticks (0.64 us at 200 MHz)
+
 /*==================================================================================================
 *   Structures/Type defines
 ==================================================================================================*/
@@ -176,6 +239,17 @@ typedef struct {
     vuint8_t	INIT_VAUX_OVUV_IMPACT;
 } FS65_RegVal_struct;
 
+typedef struct {						///latency histogram of an event [time base ticks]
+	uint32_t	count;					///callbacks called
+	uint32_t	lastTicks;				///latency of the last callback
+	uint32_t	maxTicks;				///longest latency
+	uint32_t	bucket[FS65_LATENCY_BUCKETS];	///0 - below 2^BASE, n - 2^(BASE+n-1) to 2^(BASE+n)-1, last bucket unbounded
+} FS65_Latency_struct;
+
+
+#ifdef MPC5744P_HOST
+#pragma scalar_storage_order big-endian		//host build (Host/SIM): bit fields in the target order
+#endif
 
 typedef union { /* register32_struct */
 	uint32_t R;
@@ -215,24 +289,30 @@ typedef union { /* register32_struct */
 	} B;
 } Status_32B_tag;
 
+typedef union {	///mask for ADC conversion
+	vuint32_t R;
+	struct {
+		vuint32_t				:24;		///reserved bits
+		vuint32_t	Temp	:	1;			///die temperature sensor voltage mask
+		vuint32_t	IO5T	:	1;			///IO5 voltage mask - Tight range
+		vuint32_t	IO0T	:	1;			///IO0 voltage mask - Tight range
+		vuint32_t	VsnsT	:	1;			///battery voltage mask - Tight range
+		vuint32_t	IO5W	:	1;			///IO5 voltage mask - Wide range
+		vuint32_t	IO0W	:	1;			///IO0 voltage mask - Wide range
+		vuint32_t	VsnsW	:	1;			///battery voltage mask - Wide range
+		vuint32_t	Vref	:	1;			///reference voltage mask
+	} B;
+} ScanVoltage_32B_tag;
+
+#ifdef MPC5744P_HOST
+#pragma scalar_storage_order default
+#endif
+
 
 
 struct {
-	union {
-		vuint32_t R;
-		struct {								///mask for ADC conversion
-			vuint32_t				:24;		///reserved bits
-			vuint32_t	Temp	:	1;			///die temperature sensor voltage mask
-			vuint32_t	IO5T	:	1;			///IO5 voltage mask - Tight range
-			vuint32_t	IO0T	:	1;			///IO0 voltage mask - Tight range
-			vuint32_t	VsnsT	:	1;			///battery voltage mask - Tight range
-			vuint32_t	IO5W	:	1;			///IO5 voltage mask - Wide range
-			vuint32_t	IO0W	:	1;			///IO0 voltage mask - Wide range
-			vuint32_t	VsnsW	:	1;			///battery voltage mask - Wide range
-			vuint32_t	Vref	:	1;			///reference voltage mask
-		} B;
-	} scanVoltage;
-	struct {											///last sampled voltages
+	ScanVoltage_32B_tag scanVoltage;				///mask for ADC conversion
+	struct FS65_Voltage_tag {							///last sampled voltages (FS65_VoltagesLock)
 		float	Temp;									///last sampled value of die temperature sensor
 		float	IO5T;									///last sampled value of IO5 - Tight range
 		float	IO0T;									///last sampled value of IO0 - Tight range
@@ -258,8 +338,8 @@ struct {
 	register32_struct currentLFSR;		///last LFSR state
 } PITstruct;
 
-///last received state of the registers
-struct{
+///last received state of the registers (FS65_RegistersLock, with SPIstruct.statusPwSBC)
+struct FS65_INT_tag {
 	INIT_VREG_Rx_32B_tag 			 	INIT_VREG;
 	INIT_WU1_Rx_32B_tag  				INIT_WU1;
 	INIT_WU2_Rx_32B_tag  				INIT_WU2;
@@ -358,6 +438,33 @@ struct{
 	DEVICE_ID_FS_Rx_32B_tag 			DEVICE_ID_FS;
 }INTstructPrevious;
 
+///warm resume snapshot in the keep-alive RAM (FS65_SaveVkam, FS65_CheckVkam)
+typedef struct {
+	uint32_t				magic;				///FS65_VKAM_MAGIC, 0 - no snapshot (used or never saved)
+	uint32_t				configHash;			///CRC-32 of FS65_Registers_InitValues
+	struct FS65_INT_tag		registers;			///INTstruct before the LPOFF
+	uint8_t					wdLfsr;				///WD_LFSR read just before the LPOFF, restored by the warm resume
+	uint8_t					reserved[3];
+	uint32_t				crc;				///CRC-32 of the fields above
+} FS65_Vkam_struct;
+
+///register of a configuration table (FS65_ApplyConfig)
+typedef struct {
+	uint8_t					address;			///register address (FS65xx.h *_ADR)
+	uint8_t					flags;				///FS65_APPLY_SECURE, FS65_APPLY_NIBBLE
+	uint8_t					mask;				///configuration bits of the read back (latched flags excluded)
+	const vuint8_t			*p_value;			///value to write (FS65_Registers_InitValues)
+	const register32_struct	*p_shadow;			///INTstruct item (FS65_APPLY_CACHED)
+} FS65_ConfigItem;
+
+///diff report of FS65_ApplyConfig, bit i - item i of the table
+typedef struct {
+	uint32_t				differ;				///items not in effect, written
+	uint32_t				failed;				///items written but not verified by the read back
+	uint8_t					reads;				///read frames
+	uint8_t					writes;				///write frames
+} FS65_ConfigDiff;
+
 /*==================================================================================================
 *   Function prototypes
 ==================================================================================================*/
@@ -376,6 +483,8 @@ extern uint32_t FS65_SetLPOFFmode_autoWU(void);
 extern uint32_t	FS65_RequestINT(void);
 extern uint32_t	FS65_EnableVKAM(void);
 extern uint32_t	FS65_DisableVKAM(void);
+extern uint32_t FS65_SaveVkam(void);
+extern uint32_t FS65_CheckVkam(void);
 
 extern uint32_t FS65_EnableVcore(void);
 extern uint32_t FS65_DisableVcore(void);
@@ -441,6 +550,7 @@ extern uint32_t FS65_SendCmdW(uint32_t);
 extern uint32_t FS65_SendCmdRW(uint32_t);
 extern uint32_t FS65_SendSecureCmdRW(uint32_t);
 extern uint32_t FS65_SendSecureCmdW(uint32_t);
+extern uint32_t FS65_SendBatch(const uint32_t*, uint16_t*, uint32_t);
 extern void FS65_ProcessSPI(void);
 
 extern float FS65_GetVoltageWide(void);
@@ -452,6 +562,18 @@ extern void FS65_IsrPIT_WD(void);
 extern void FS65_IsrSIUL(void);
 extern void FS65_IsrADC(void);
 
+extern FS65_Latency_struct FS65_Latency[FS65_EVENT_NB];
+extern FS65_Vkam_struct FS65_Vkam;
+extern uint8_t FS65_WarmResume;
+extern void VKAM_Clear(void);			//startup.S: .vkam cleared, ECC initialised
+
+extern SEQ_Lock FS65_RegistersLock;
+extern SEQ_Lock FS65_VoltagesLock;
+extern uint32_t FS65_SnapshotRegisters(struct FS65_INT_tag*, Status_32B_tag*);
+extern uint32_t FS65_SnapshotVoltages(struct FS65_Voltage_tag*);
+extern void FS65_GetLatency(uint32_t, FS65_Latency_struct*);
+extern void FS65_ClearLatency(void);
+
 extern void FS65_UpdateRegisters(void);
 //extern void FS65_IsrUART_Rx(void);
 extern void FS65_ErrorCallback(void);
@@ -459,7 +581,10 @@ extern void FS65_ErrorCallback(void);
 extern uint32_t FS65_Init_FSSM(void);
 extern uint32_t FS65_Init_MSM(void);
 extern uint32_t FS65_Config_NonInit(void);
+extern uint32_t FS65_ApplyConfig(const FS65_ConfigItem*, uint32_t, uint32_t, FS65_ConfigDiff*);
+extern FS65_ConfigDiff FS65_ConfigReport[FS65_CONFIG_NB];
 extern void     FS65_Init(void);
+extern uint32_t FS65_InitStep(uint32_t*);
 extern void	FS65_GetStatus(void);
 
 #endif
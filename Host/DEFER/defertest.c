@@ -0,0 +1,246 @@
+/*******************************************************************************
+*
+* $File Name:       defertest.c$
+* @file             defertest.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Host test of the deferred work queues
+* @brief            Host test of the deferred work queues
+*
+*   Usage:
+*     defertest            - all checks, exit code 1 on a failure
+*
+*   The software interrupt is a flag set by DEFER_PortRaise and cleared by
+*   DEFER_PortClear; the test calls DEFER_IsrSoftware itself. Each handler
+*   appends its argument to a log, the log is compared with the expected
+*   order: urgency of the queues, FIFO in a queue, an item posted by a
+*   handler, full queue, producer preempted before publishing its item and
+*   wrap of the sequence numbers.
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Tool created
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "typedefs.h"
+#include "DEFER.h"
+
+#define TEST_LOG_SIZE			256
+#define TEST_WRAP_START			0xFFFFFFF8u	///queue positions a few items before the wrap
+#define TEST_WRAP_ROUNDS		1000
+#define TEST_REPOST				1000		///argument offset of the item posted by Repost
+
+static uint32_t raised;						///software interrupt flag
+static uint32_t nbRaise;
+static uint32_t testLog[TEST_LOG_SIZE];
+static uint32_t nbLog;
+static uint32_t failures;
+static uint32_t seed = 0x12345678;
+
+void DEFER_PortRaise(void)
+{
+	raised = 1;
+	nbRaise++;
+}
+
+void DEFER_PortClear(void)
+{
+	raised = 0;
+}
+
+static uint32_t Random(void)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	return seed;
+}
+
+static void Record(uint32_t arg)
+{
+	if (nbLog < TEST_LOG_SIZE)
+	{
+		testLog[nbLog] = arg;
+	}
+	nbLog++;
+}
+
+static void Repost(uint32_t arg)
+{
+	Record(arg);
+	(void)DEFER_Post(DEFER_HIGH, Record, arg + TEST_REPOST);
+}
+
+static void Reset(void)
+{
+	DEFER_Init();
+	nbRaise = 0;
+	nbLog = 0;
+}
+
+static void Check(const char *p_name, uint32_t condition)
+{
+	printf("%-36s %s\n", p_name, condition ? "ok" : "FAILED");
+	if (!condition)
+	{
+		failures++;
+	}
+}
+
+static uint32_t LogIs(const uint32_t *p_expected, uint32_t nb)
+{
+	return (nbLog == nb) && (memcmp(testLog, p_expected, nb * sizeof(uint32_t)) == 0);
+}
+
+//items posted to all queues, drained by urgency then FIFO
+static void TestOrder(void)
+{
+	static const uint32_t expected[] = {20, 21, 22, 10, 11, 12, 0, 1, 2};
+	uint32_t i;
+	uint32_t run;
+
+	Reset();
+	for (i = 0; i < 3; i++)
+	{
+		(void)DEFER_Post(DEFER_LOW, Record, i);
+		(void)DEFER_Post(DEFER_NORMAL, Record, 10 + i);
+		(void)DEFER_Post(DEFER_HIGH, Record, 20 + i);
+	}
+	Check("interrupt raised by each post", raised && (nbRaise == 9));
+	DEFER_IsrSoftware();
+	run = DEFERqueue[DEFER_HIGH].head + DEFERqueue[DEFER_NORMAL].head + DEFERqueue[DEFER_LOW].head;
+	Check("order: urgency, then FIFO", LogIs(expected, 9) && (run == 9));
+	Check("interrupt cleared after the run", !raised);
+}
+
+//an item posted by a handler is run in the same call, before the less urgent ones
+static void TestRepost(void)
+{
+	static const uint32_t expected[] = {1, 1 + TEST_REPOST, 2, 2 + TEST_REPOST};
+	uint32_t run;
+
+	Reset();
+	(void)DEFER_Post(DEFER_LOW, Repost, 1);
+	(void)DEFER_Post(DEFER_LOW, Repost, 2);
+	DEFER_PortClear();						//as DEFER_IsrSoftware
+	run = DEFER_RunPending();
+	Check("re-post from a handler", LogIs(expected, 4) && (run == 4));
+	Check("interrupt raised again by the handler", raised);
+	Check("queues empty after the run", DEFER_RunPending() == 0);
+}
+
+//DEFER_QUEUE_SIZE items accepted, the next one refused and counted
+static void TestOverflow(void)
+{
+	uint32_t i;
+	uint32_t accepted = 0;
+	uint32_t result;
+
+	Reset();
+	for (i = 0; i < DEFER_QUEUE_SIZE; i++)
+	{
+		accepted += (DEFER_Post(DEFER_NORMAL, Record, i) == DEFER_OK);
+	}
+	result = DEFER_Post(DEFER_NORMAL, Record, DEFER_QUEUE_SIZE);
+	Check("full queue refuses the item", (accepted == DEFER_QUEUE_SIZE) && (result == DEFER_FULL)
+			&& (DEFERqueue[DEFER_NORMAL].dropped == 1));
+	Check("other queues not affected", DEFER_Post(DEFER_HIGH, Record, 100) == DEFER_OK);
+	Check("all accepted items run", (DEFER_RunPending() == DEFER_QUEUE_SIZE + 1) && (testLog[0] == 100)
+			&& (testLog[DEFER_QUEUE_SIZE] == DEFER_QUEUE_SIZE - 1));
+	Check("item accepted again after the run", DEFER_Post(DEFER_NORMAL, Record, 0) == DEFER_OK);
+}
+
+//the producer claimed the tail and is preempted before publishing: the
+//consumer stops in front of the item, the items after it wait
+static void TestPreempted(void)
+{
+	static const uint32_t expected[] = {1, 2};
+	DEFER_Queue *p_queue = &DEFERqueue[DEFER_LOW];
+	DEFER_Item *p_item;
+	uint32_t position;
+
+	Reset();
+	position = p_queue->tail;
+	p_queue->tail = position + 1;			//claim of the preempted producer
+	(void)DEFER_Post(DEFER_LOW, Record, 2);	//preempting producer
+	Check("unpublished item stops the queue", (DEFER_RunPending() == 0) && (nbLog == 0));
+	p_item = &p_queue->item[position & (DEFER_QUEUE_SIZE - 1)];
+	p_item->handler = Record;				//the preempted producer resumes
+	p_item->arg = 1;
+	p_item->sequence = position + 1;
+	Check("published item and the next one run", (DEFER_RunPending() == 2) && LogIs(expected, 2));
+}
+
+//random bursts with the positions starting just before the wrap
+static void TestWrap(void)
+{
+	DEFER_Queue *p_queue;
+	uint32_t level;
+	uint32_t round;
+	uint32_t burst;
+	uint32_t i;
+	uint32_t next = 0;
+	uint32_t errors = 0;
+
+	Reset();
+	for (level = 0; level < DEFER_LEVELS; level++)
+	{
+		p_queue = &DEFERqueue[level];
+		for (i = 0; i < DEFER_QUEUE_SIZE; i++)
+		{
+			p_queue->item[(TEST_WRAP_START + i) & (DEFER_QUEUE_SIZE - 1)].sequence = TEST_WRAP_START + i;
+		}
+		p_queue->tail = TEST_WRAP_START;
+		p_queue->head = TEST_WRAP_START;
+	}
+	for (round = 0; round < TEST_WRAP_ROUNDS; round++)
+	{
+		burst = 1 + (Random() % DEFER_QUEUE_SIZE);
+		nbLog = 0;
+		for (i = 0; i < burst; i++)
+		{
+			errors += (DEFER_Post(DEFER_LOW, Record, next + i) != DEFER_OK);
+		}
+		errors += (DEFER_RunPending() != burst);
+		for (i = 0; i < burst; i++)
+		{
+			errors += (testLog[i] != next + i);
+		}
+		next += burst;
+	}
+	p_queue = &DEFERqueue[DEFER_LOW];
+	Check("sequence wrap", (errors == 0) && (p_queue->tail == TEST_WRAP_START + next)
+			&& (p_queue->head == p_queue->tail) && (p_queue->dropped == 0));
+}
+
+int main(int argc, char **argv)
+{
+	(void)argv;
+	if (argc > 1)
+	{
+		fprintf(stderr, "usage: defertest\n");
+		return 1;
+	}
+	TestOrder();
+	TestRepost();
+	TestOverflow();
+	TestPreempted();
+	TestWrap();
+	printf("failures          %u\n", failures);
+	return (failures != 0) ? 1 : 0;
+}
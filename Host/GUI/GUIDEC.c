@@ -0,0 +1,422 @@
+/*******************************************************************************
+*
+* $File Name:       GUIDEC.c$
+* @file             GUIDEC.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Host decoder of the GUI telemetry stream
+* @brief            Host decoder of the GUI telemetry stream
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/****************************************************************************//*!
+*
+*  @mainpage Host decoder of the GUI telemetry stream
+*
+*  @section Intro Introduction
+*
+*	This library parses the byte stream sent by the target GUI module
+*	(src/Modules/GUI.c): it splits frames on the 0x00 delimiter, removes the
+*	COBS encoding, checks CRC-16 and sequence numbers and rebuilds absolute
+*	register/measured values and timestamps from the delta encoded records.
+*	A time record is a keyframe: the values are reset to zero first, so the
+*	decoder resynchronizes after a frame lost on the link or dropped by the
+*	target.
+*
+*	The decoder works on arbitrary chunks (capture files, serial port reads)
+*	and keeps no per-record allocation, so a capture file is parsed at
+*	memory bandwidth rather than at record rate.
+*
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : Host (PC)
+*   Dependencies         : C99 standard library.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Decoder created
+BRNY001					      19/10/2026 	   GUIDEC_BuildRequest	  Batched register requests
+BRNY001					      19/10/2026 	   GUIDEC_DecodeFrame	  SPI trace records (GUIDEC_REC_SPI_TRACE)
+BRNY001					      19/10/2026 	   GUIDEC_DecodeFrame	  Values reset to zero on GUIDEC_REC_TIME (keyframe)
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#include <string.h>
+#include "GUIDEC.h"
+
+static uint16_t GUIDEC_CrcTable[8][256];		///slicing-by-8 tables, [k][i] = byte i followed by k zero Bytes
+static int GUIDEC_CrcReady = 0;
+
+static void GUIDEC_BuildCrcTable(void)
+{
+	uint32_t i;
+	uint32_t k;
+	uint32_t bit;
+	uint16_t crc;
+
+	for (i = 0; i < 256; i++)
+	{
+		crc = (uint16_t)(i << 8);
+		for (bit = 0; bit < 8; bit++)
+		{
+			crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+		}
+		GUIDEC_CrcTable[0][i] = crc;
+	}
+	for (k = 1; k < 8; k++)
+	{
+		for (i = 0; i < 256; i++)
+		{
+			crc = GUIDEC_CrcTable[k - 1][i];
+			GUIDEC_CrcTable[k][i] = (uint16_t)((crc << 8) ^ GUIDEC_CrcTable[0][crc >> 8]);
+		}
+	}
+	GUIDEC_CrcReady = 1;
+}
+
+/***************************************************************************//*!
+*   @brief CRC-16/CCITT (poly 0x1021, init 0xFFFF), same as GUI_ComputeCRC.
+*	@remarks 	Slicing-by-8: eight Bytes per iteration with independent
+*				table lookups.
+********************************************************************************/
+uint16_t GUIDEC_ComputeCRC(const uint8_t *data, size_t length)
+{
+	uint32_t crc = 0xFFFF;
+	uint32_t hi;
+	uint32_t lo;
+
+	if (!GUIDEC_CrcReady)
+	{
+		GUIDEC_BuildCrcTable();
+	}
+	while (length >= 8)
+	{
+		hi = ((uint32_t)data[0] << 24 | (uint32_t)data[1] << 16 | (uint32_t)data[2] << 8 | data[3]) ^ (crc << 16);
+		lo = (uint32_t)data[4] << 24 | (uint32_t)data[5] << 16 | (uint32_t)data[6] << 8 | data[7];
+		crc = GUIDEC_CrcTable[7][hi >> 24] ^ GUIDEC_CrcTable[6][(hi >> 16) & 0xFF] ^
+			  GUIDEC_CrcTable[5][(hi >> 8) & 0xFF] ^ GUIDEC_CrcTable[4][hi & 0xFF] ^
+			  GUIDEC_CrcTable[3][lo >> 24] ^ GUIDEC_CrcTable[2][(lo >> 16) & 0xFF] ^
+			  GUIDEC_CrcTable[1][(lo >> 8) & 0xFF] ^ GUIDEC_CrcTable[0][lo & 0xFF];
+		data += 8;
+		length -= 8;
+	}
+	while (length--)
+	{
+		crc = ((crc << 8) ^ GUIDEC_CrcTable[0][((crc >> 8) ^ *data++) & 0xFF]) & 0xFFFF;
+	}
+	return (uint16_t)crc;
+}
+
+/***************************************************************************//*!
+*   @brief Decodes one COBS group sequence (without the delimiter).
+*	@return 	Number of decoded Bytes, 0 on a format error.
+********************************************************************************/
+size_t GUIDEC_DecodeCOBS(const uint8_t *src, size_t length, uint8_t *dst)
+{
+	size_t read = 0;
+	size_t write = 0;
+	uint8_t code;
+	uint8_t count;
+
+	while (read < length)
+	{
+		code = src[read++];
+		if ((code == 0) || ((read + code - 1) > length))
+		{
+			return 0;
+		}
+		for (count = code; count > 1; count--)	//groups are short, a plain loop beats memcpy
+		{
+			dst[write++] = src[read++];
+		}
+		if ((code != 0xFF) && (read < length))
+		{
+			dst[write++] = 0;
+		}
+	}
+	return write;
+}
+
+/***************************************************************************//*!
+*   @brief Encodes a buffer with COBS and appends the 0x00 delimiter
+*			(same as GUI_EncodeCOBS, used to build requests and test streams).
+*	@return 	Number of Bytes written into dst.
+********************************************************************************/
+size_t GUIDEC_EncodeCOBS(const uint8_t *src, size_t length, uint8_t *dst)
+{
+	size_t read = 0;
+	size_t write = 1;
+	size_t codeIndex = 0;
+	uint8_t code = 1;
+
+	while (read < length)
+	{
+		if (src[read] == 0)
+		{
+			dst[codeIndex] = code;
+			codeIndex = write++;
+			code = 1;
+		}
+		else
+		{
+			dst[write++] = src[read];
+			if (++code == 0xFF)
+			{
+				dst[codeIndex] = code;
+				codeIndex = write++;
+				code = 1;
+			}
+		}
+		read++;
+	}
+	dst[codeIndex] = code;
+	dst[write++] = 0x00;
+	return write;
+}
+
+/***************************************************************************//*!
+*   @brief Builds an encoded request frame (tag, commands, CRC, COBS, delimiter).
+*	@param[in] commands 	GUIDEC_CMD_xxx sequence, at most GUIDEC_MAX_FRAME - 3 Bytes.
+*	@param[out] dst 		At least length + length / 254 + 6 Bytes.
+*	@return 	Number of Bytes written into dst.
+********************************************************************************/
+size_t GUIDEC_BuildRequest(uint8_t tag, const uint8_t *commands, size_t length, uint8_t *dst)
+{
+	uint8_t payload[GUIDEC_MAX_FRAME];
+	uint16_t crc;
+
+	payload[0] = tag;
+	memcpy(&payload[1], commands, length);
+	crc = GUIDEC_ComputeCRC(payload, length + 1);
+	payload[length + 1] = (uint8_t)(crc >> 8);
+	payload[length + 2] = (uint8_t)crc;
+	return GUIDEC_EncodeCOBS(payload, length + 3, dst);
+}
+
+static int GUIDEC_GetVarint(const uint8_t **p, const uint8_t *end, uint32_t *value)
+{
+	uint32_t result = 0;
+	uint32_t shift = 0;
+	uint8_t b;
+
+	do
+	{
+		if ((*p >= end) || (shift > 28))
+		{
+			return 0;
+		}
+		b = *(*p)++;
+		result |= (uint32_t)(b & 0x7F) << shift;
+		shift += 7;
+	} while (b & 0x80);
+
+	*value = result;
+	return 1;
+}
+
+void GUIDEC_Init(GUIDEC_Decoder *dec)
+{
+	memset(dec, 0, sizeof(*dec));
+	dec->lastSequence = -1;
+}
+
+/***************************************************************************//*!
+*   @brief Decodes one frame (COBS encoded, without the delimiter).
+*	@return 	0 - frame accepted, 1 - stopped by the callback, -1 - frame rejected.
+********************************************************************************/
+int GUIDEC_DecodeFrame(GUIDEC_Decoder *dec, const uint8_t *encoded, size_t length, GUIDEC_Callback cb, void *context)
+{
+	uint8_t payload[GUIDEC_MAX_FRAME];
+	const uint8_t *p;
+	const uint8_t *end;
+	GUIDEC_Record record = {0};
+	uint32_t dt;
+	uint32_t raw;
+	size_t size;
+
+	size = GUIDEC_DecodeCOBS(encoded, length, payload);
+	if (size < 3)
+	{
+		dec->formatErrors++;
+		return -1;
+	}
+	if (GUIDEC_ComputeCRC(payload, size - 2) != (uint16_t)((payload[size - 2] << 8) | payload[size - 1]))
+	{
+		dec->crcErrors++;
+		return -1;
+	}
+	if ((dec->lastSequence >= 0) && (payload[0] != (uint8_t)(dec->lastSequence + 1)))
+	{
+		dec->sequenceGaps++;
+	}
+	dec->lastSequence = payload[0];
+	dec->frames++;
+
+	p = &payload[1];
+	end = &payload[size - 2];
+	while (p < end)
+	{
+		record.type = *p++;
+		switch (record.type)
+		{
+			case GUIDEC_REC_TIME:
+				if (!GUIDEC_GetVarint(&p, end, &raw))
+					goto format_error;
+				dec->time = raw;
+				memset(dec->reg, 0, sizeof(dec->reg));		//keyframe: deltas against zero follow
+				memset(dec->meas, 0, sizeof(dec->meas));
+				dec->keyframes++;
+				continue;
+
+			case GUIDEC_REC_REGISTER:
+				if (!GUIDEC_GetVarint(&p, end, &dt) || (p >= end))
+					goto format_error;
+				record.id = *p++;
+				if (!GUIDEC_GetVarint(&p, end, &raw) || (record.id >= GUIDEC_REG_NB))
+					goto format_error;
+				dec->reg[record.id] ^= raw;
+				record.value = dec->reg[record.id];
+				break;
+
+			case GUIDEC_REC_MEASURE:
+				if (!GUIDEC_GetVarint(&p, end, &dt) || (p >= end))
+					goto format_error;
+				record.id = *p++;
+				if (!GUIDEC_GetVarint(&p, end, &raw) || (record.id >= GUIDEC_MEAS_NB))
+					goto format_error;
+				dec->meas[record.id] += (int32_t)((raw >> 1) ^ (0U - (raw & 1)));	//zigzag
+				record.value = (uint32_t)dec->meas[record.id];
+				break;
+
+			case GUIDEC_REC_RESPONSE:
+				if (!GUIDEC_GetVarint(&p, end, &dt) || ((end - p) < 3))
+					goto format_error;
+				dec->time += dt;
+				record.time = dec->time;
+				record.tag = p[0];
+				record.status = p[1];
+				raw = p[2];
+				p += 3;
+				if ((size_t)(end - p) < (size_t)raw * 3)
+					goto format_error;
+				if (raw == 0)
+				{
+					record.id = 0xFF;
+					record.value = 0;
+					dec->records++;
+					if ((cb != NULL) && cb(&record, context))
+						return 1;
+				}
+				for (; raw > 0; raw--, p += 3)
+				{
+					record.id = p[0];
+					record.value = (uint32_t)((p[1] << 8) | p[2]);
+					dec->records++;
+					if ((cb != NULL) && cb(&record, context))
+						return 1;
+				}
+				continue;
+
+			case GUIDEC_REC_SPI_TRACE:
+				if (!GUIDEC_GetVarint(&p, end, &dt) || !GUIDEC_GetVarint(&p, end, &record.value)
+						|| !GUIDEC_GetVarint(&p, end, &record.sequence) || (p >= end))
+					goto format_error;
+				dec->time += dt;
+				record.time = dec->time;
+				raw = *p++;
+				if ((size_t)(end - p) < (size_t)raw * GUIDEC_TRACE_SIZE)
+					goto format_error;
+				for (; raw > 0; raw--, p += GUIDEC_TRACE_SIZE, record.sequence++)
+				{
+					memcpy(record.trace, p, GUIDEC_TRACE_SIZE);
+					dec->records++;
+					if ((cb != NULL) && cb(&record, context))
+						return 1;
+				}
+				continue;
+
+			default:
+				goto format_error;
+		}
+		dec->time += dt;
+		record.time = dec->time;
+		dec->records++;
+		if ((cb != NULL) && cb(&record, context))
+		{
+			return 1;
+		}
+	}
+	return 0;
+
+format_error:
+	dec->formatErrors++;
+	return -1;
+}
+
+/***************************************************************************//*!
+*   @brief Feeds a chunk of the received byte stream into the decoder.
+* 	@par Description
+*					Frames are split on the 0x00 delimiter; Bytes of an
+*					incomplete frame are kept for the next call.
+*	@return 	Number of consumed Bytes (less than length only if the
+*				callback requested to stop).
+********************************************************************************/
+size_t GUIDEC_Feed(GUIDEC_Decoder *dec, const uint8_t *data, size_t length, GUIDEC_Callback cb, void *context)
+{
+	const uint8_t *p = data;
+	const uint8_t *end = data + length;
+	const uint8_t *delimiter;
+	size_t chunk;
+	int result;
+
+	while (p < end)
+	{
+		delimiter = memchr(p, 0, (size_t)(end - p));
+		if (delimiter == NULL)
+		{
+			chunk = (size_t)(end - p);
+			if ((dec->length + chunk) > sizeof(dec->frame))
+				dec->overflow = 1;
+			else
+				memcpy(&dec->frame[dec->length], p, chunk);
+			dec->length += chunk;
+			break;
+		}
+
+		chunk = (size_t)(delimiter - p);
+		if (dec->overflow || ((dec->length + chunk) > sizeof(dec->frame)))
+		{
+			dec->formatErrors++;
+			result = 0;
+		}
+		else if (dec->length == 0)
+		{
+			result = (chunk != 0) ? GUIDEC_DecodeFrame(dec, p, chunk, cb, context) : 0;	//zero copy path
+		}
+		else
+		{
+			memcpy(&dec->frame[dec->length], p, chunk);
+			result = GUIDEC_DecodeFrame(dec, dec->frame, dec->length + chunk, cb, context);
+		}
+		dec->length = 0;
+		dec->overflow = 0;
+		p = delimiter + 1;
+		if (result == 1)
+		{
+			return (size_t)(p - data);
+		}
+	}
+	return length;
+}
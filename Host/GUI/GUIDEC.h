@@ -0,0 +1,111 @@
+/*******************************************************************************
+*
+* $File Name:       GUIDEC.h$
+* @file             GUIDEC.h
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Host decoder of the GUI telemetry stream
+* @brief            Host decoder of the GUI telemetry stream
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : Host (PC)
+*   Dependencies         : C99 standard library.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Decoder created
+BRNY001					      19/10/2026 	   GUIDEC_BuildRequest	  Batched register requests
+BRNY001					      19/10/2026 	   GUIDEC_Record	  SPI trace records (GUIDEC_REC_SPI_TRACE)
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#ifndef _GUIDEC_H_
+#define _GUIDEC_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*==================================================================================================
+*   NON - configurable parameters (shall match GUI.h of the target)
+==================================================================================================*/
+
+#define GUIDEC_REC_REGISTER		0x01
+#define GUIDEC_REC_MEASURE		0x02
+#define GUIDEC_REC_TIME			0x03
+#define GUIDEC_REC_RESPONSE		0x04
+#define GUIDEC_REC_SPI_TRACE	0x05
+
+#define GUIDEC_CMD_READ			0x10	///+ address
+#define GUIDEC_CMD_WRITE		0x11	///+ address, data
+#define GUIDEC_CMD_WRITE_SECURE	0x12	///+ address, data
+#define GUIDEC_CMD_READ_ALL		0x13
+#define GUIDEC_CMD_KEYFRAME		0x14
+#define GUIDEC_CMD_SPI_TRACE	0x15	///+ first record (4 Bytes, MSB first)
+
+#define GUIDEC_MAX_FRAME		1024	///longest accepted frame (decoded Bytes)
+#define GUIDEC_REG_NB			64		///FS65 register address space
+#define GUIDEC_MEAS_NB			8		///measured channels
+#define GUIDEC_TRACE_SIZE		16		///packed SPI trace record (SPITRACE_RECORD_SIZE)
+
+/*==================================================================================================
+*   Structures/Type defines
+==================================================================================================*/
+
+typedef struct {
+	uint8_t		type;		///GUIDEC_REC_xxx
+	uint8_t		id;			///register address or measured channel
+	uint64_t	time;		///absolute time [us]
+	uint32_t	value;		///new register value / measured value in milli-units (two's complement) / FS65 answer
+	uint8_t		tag;		///GUIDEC_REC_RESPONSE: tag of the request
+	uint8_t		status;		///GUIDEC_REC_RESPONSE: status of the request (id = 0xFF if no answer is attached)
+	uint32_t	sequence;	///GUIDEC_REC_SPI_TRACE: record number (value = SPITRACEhead when sent)
+	uint8_t		trace[GUIDEC_TRACE_SIZE];	///GUIDEC_REC_SPI_TRACE: packed record (decoded by Host/SPITRACE)
+} GUIDEC_Record;
+
+/** Called for each decoded record; return non-zero to stop decoding. */
+typedef int (*GUIDEC_Callback)(const GUIDEC_Record *record, void *context);
+
+typedef struct {
+	uint8_t		frame[GUIDEC_MAX_FRAME];	///encoded Bytes of the frame being received
+	size_t		length;
+	uint32_t	overflow;					///1 - current frame too long, skipped until delimiter
+	uint64_t	time;						///time of the last record [us]
+	uint32_t	reg[GUIDEC_REG_NB];			///reconstructed register values
+	int32_t		meas[GUIDEC_MEAS_NB];		///reconstructed measured values
+	int			lastSequence;				///-1 before the first frame
+	/* statistics */
+	uint64_t	frames;
+	uint64_t	records;
+	uint64_t	crcErrors;
+	uint64_t	formatErrors;
+	uint64_t	sequenceGaps;
+	uint64_t	keyframes;
+} GUIDEC_Decoder;
+
+/*==================================================================================================
+*   Function prototypes
+==================================================================================================*/
+
+void GUIDEC_Init(GUIDEC_Decoder *dec);
+size_t GUIDEC_Feed(GUIDEC_Decoder *dec, const uint8_t *data, size_t length, GUIDEC_Callback cb, void *context);
+int GUIDEC_DecodeFrame(GUIDEC_Decoder *dec, const uint8_t *encoded, size_t length, GUIDEC_Callback cb, void *context);
+uint16_t GUIDEC_ComputeCRC(const uint8_t *data, size_t length);
+size_t GUIDEC_DecodeCOBS(const uint8_t *src, size_t length, uint8_t *dst);
+size_t GUIDEC_EncodeCOBS(const uint8_t *src, size_t length, uint8_t *dst);
+size_t GUIDEC_BuildRequest(uint8_t tag, const uint8_t *commands, size_t length, uint8_t *dst);
+
+#endif
@@ -0,0 +1,181 @@
+/*******************************************************************************
+*
+* $File Name:       guidump.c$
+* @file             guidump.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Command line dump of a GUI telemetry capture
+* @brief            Command line dump of a GUI telemetry capture
+*
+*   Usage:
+*     guidump capture.bin          - print all records
+*     guidump -q capture.bin       - print statistics and parse rate only
+*     guidump -g 256 out.bin       - generate a 256 MB synthetic capture
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Tool created
+BRNY001					      19/10/2026 	   PrintRecord	  SPI trace records (raw, see Host/SPITRACE/spidump)
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "GUIDEC.h"
+
+static int PrintRecord(const GUIDEC_Record *record, void *context)
+{
+	(void)context;
+	if (record->type == GUIDEC_REC_REGISTER)
+		printf("%12llu us  REG  0x%02X = 0x%04X\n", (unsigned long long)record->time, record->id, record->value);
+	else if (record->type == GUIDEC_REC_MEASURE)
+		printf("%12llu us  MEAS %u = %d\n", (unsigned long long)record->time, record->id, (int32_t)record->value);
+	else if (record->type == GUIDEC_REC_SPI_TRACE)
+	{
+		int i;
+
+		printf("%12llu us  SPI  #%u ", (unsigned long long)record->time, record->sequence);
+		for (i = 0; i < GUIDEC_TRACE_SIZE; i++)
+			printf(" %02X", record->trace[i]);
+		printf("\n");
+	}
+	else
+		printf("%12llu us  RESP tag %u status %u  0x%02X : 0x%04X\n", (unsigned long long)record->time,
+			   record->tag, record->status, record->id, record->value);
+	return 0;
+}
+
+static size_t PutVarint(uint8_t *p, uint32_t value)
+{
+	size_t n = 0;
+
+	while (value >= 0x80)
+	{
+		p[n++] = (uint8_t)(value | 0x80);
+		value >>= 7;
+	}
+	p[n++] = (uint8_t)value;
+	return n;
+}
+
+/* Synthetic stream with the record mix of a running target (few registers and
+ * measured values changing per frame). */
+static int Generate(const char *path, size_t megabytes)
+{
+	uint8_t payload[256];
+	uint8_t encoded[300];
+	size_t target = megabytes * 1024 * 1024;
+	size_t written = 0;
+	size_t length;
+	size_t n;
+	uint32_t seed = 1;
+	uint8_t sequence = 0;
+	uint16_t crc;
+	FILE *f;
+	int i;
+
+	f = fopen(path, "wb");
+	if (f == NULL)
+	{
+		perror(path);
+		return 1;
+	}
+	while (written < target)
+	{
+		length = 0;
+		payload[length++] = sequence++;
+		for (i = 0; i < 12; i++)
+		{
+			seed = seed * 1103515245u + 12345u;
+			if (seed & 0x10000)
+			{
+				payload[length++] = GUIDEC_REC_REGISTER;
+				length += PutVarint(&payload[length], (seed >> 8) & 0x3FF);
+				payload[length++] = (uint8_t)((seed >> 20) & 0x3F);
+				length += PutVarint(&payload[length], (seed >> 4) & 0xFFFF);
+			}
+			else
+			{
+				payload[length++] = GUIDEC_REC_MEASURE;
+				length += PutVarint(&payload[length], (seed >> 8) & 0x3FF);
+				payload[length++] = (uint8_t)((seed >> 20) & 0x7);
+				length += PutVarint(&payload[length], (seed >> 4) & 0xFF);
+			}
+		}
+		crc = GUIDEC_ComputeCRC(payload, length);
+		payload[length++] = (uint8_t)(crc >> 8);
+		payload[length++] = (uint8_t)crc;
+		n = GUIDEC_EncodeCOBS(payload, length, encoded);
+		fwrite(encoded, 1, n, f);
+		written += n;
+	}
+	fclose(f);
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	static uint8_t buffer[1 << 20];
+	GUIDEC_Decoder dec;
+	struct timespec start, stop;
+	size_t total = 0;
+	size_t n;
+	double seconds;
+	int quiet = 0;
+	FILE *f;
+
+	if ((argc == 4) && (strcmp(argv[1], "-g") == 0))
+	{
+		return Generate(argv[3], (size_t)strtoul(argv[2], NULL, 0));
+	}
+	if ((argc == 3) && (strcmp(argv[1], "-q") == 0))
+	{
+		quiet = 1;
+		argv++;
+	}
+	else if (argc != 2)
+	{
+		fprintf(stderr, "usage: %s [-q] capture.bin | -g MB out.bin\n", argv[0]);
+		return 2;
+	}
+
+	f = fopen(argv[1], "rb");
+	if (f == NULL)
+	{
+		perror(argv[1]);
+		return 1;
+	}
+	GUIDEC_Init(&dec);
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0)
+	{
+		GUIDEC_Feed(&dec, buffer, n, quiet ? NULL : PrintRecord, NULL);
+		total += n;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &stop);
+	fclose(f);
+
+	seconds = (double)(stop.tv_sec - start.tv_sec) + (double)(stop.tv_nsec - start.tv_nsec) * 1e-9;
+	fprintf(stderr, "%zu bytes, %llu frames, %llu records, %llu CRC errors, %llu format errors, %llu sequence gaps, %llu keyframes\n",
+			total, (unsigned long long)dec.frames, (unsigned long long)dec.records,
+			(unsigned long long)dec.crcErrors, (unsigned long long)dec.formatErrors,
+			(unsigned long long)dec.sequenceGaps, (unsigned long long)dec.keyframes);
+	if (seconds > 0)
+	{
+		fprintf(stderr, "%.1f MB/s\n", (double)total / (1024.0 * 1024.0) / seconds);
+	}
+	return ((dec.crcErrors != 0) || (dec.formatErrors != 0)) ? 1 : 0;
+}
@@ -0,0 +1,228 @@
+/*******************************************************************************
+*
+* $File Name:       seqstress.c$
+* @file             seqstress.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Host stress test of the sequence lock
+* @brief            Host stress test of the sequence lock
+*
+*   Usage:
+*     seqstress            - 2 s run
+*     seqstress 10         - given run time [s]
+*     seqstress 2 nolock   - writers without the lock (the test shall see torn copies)
+*
+*   A single thread reproduces the single core: two timer signals are the
+*   interrupts, level 2 (SIGRTMIN+1) preempts level 1 (SIGRTMIN), both
+*   preempt the main loop (level 0), never the reverse. Each level writes
+*   its own region of the protected data with one stamp in all words; the
+*   main loop and level 2 read the whole data. A copy accepted by SEQ_Read
+*   with two different stamps in one region is torn.
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Tool created
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include "typedefs.h"
+#include "SEQ.h"
+
+#define STRESS_LEVELS			3
+#define STRESS_WORDS			16			///words of a region
+#define STRESS_LEVEL1_NS		20000		///period of the level 1 writer
+#define STRESS_LEVEL2_NS		31000		///period of the level 2 writer/reader
+
+typedef struct {
+	vuint32_t	region[STRESS_LEVELS][STRESS_WORDS];
+} StressData;
+
+typedef struct {
+	uint32_t	writes;
+	uint32_t	reads;
+	uint32_t	busy;
+	uint32_t	torn;
+} StressCount;
+
+static SEQ_Lock lock;
+static StressData shared;
+static StressCount count[STRESS_LEVELS];
+static volatile sig_atomic_t useLock = 1;
+
+/***************************************************************************//*!
+*   @brief Writes the region of a level, one stamp in all words.
+********************************************************************************/
+static void Stress_Write(uint32_t level)
+{
+	uint32_t stamp = ++count[level].writes;
+	uint32_t token = 0;
+	uint32_t i;
+
+	if (useLock)
+	{
+		token = SEQ_WriteBegin(&lock);
+	}
+	for (i = 0; i < STRESS_WORDS; i++)
+	{
+		shared.region[level][i] = stamp;
+	}
+	if (useLock)
+	{
+		SEQ_WriteEnd(&lock, token);
+	}
+}
+
+/***************************************************************************//*!
+*   @brief Reads the whole data and checks every region.
+********************************************************************************/
+static void Stress_Read(uint32_t level)
+{
+	StressData copy;
+	uint32_t region;
+	uint32_t i;
+
+	if (SEQ_Read(&lock, &shared, &copy, sizeof(copy)) != SEQ_OK)
+	{
+		count[level].busy++;
+		return;
+	}
+	count[level].reads++;
+	for (region = 0; region < STRESS_LEVELS; region++)
+	{
+		for (i = 1; i < STRESS_WORDS; i++)
+		{
+			if (copy.region[region][i] != copy.region[region][0])
+			{
+				count[level].torn++;
+				return;
+			}
+		}
+	}
+}
+
+static void Stress_Level1(int signal)
+{
+	(void)signal;
+	Stress_Write(1);
+}
+
+static void Stress_Level2(int signal)
+{
+	(void)signal;
+	Stress_Read(2);
+	Stress_Write(2);
+}
+
+/***************************************************************************//*!
+*   @brief Installs a level: handler, blocked lower levels and periodic timer.
+********************************************************************************/
+static int Stress_Start(int signal, void (*handler)(int), const sigset_t *p_mask, long periodNs)
+{
+	struct sigaction action;
+	struct sigevent event;
+	struct itimerspec period;
+	timer_t timer;
+
+	memset(&action, 0, sizeof(action));
+	action.sa_handler = handler;
+	action.sa_mask = *p_mask;
+	action.sa_flags = SA_RESTART;
+	if (sigaction(signal, &action, 0) != 0)
+	{
+		return -1;
+	}
+
+	memset(&event, 0, sizeof(event));
+	event.sigev_notify = SIGEV_SIGNAL;
+	event.sigev_signo = signal;
+	if (timer_create(CLOCK_MONOTONIC, &event, &timer) != 0)
+	{
+		return -1;
+	}
+	period.it_interval.tv_sec = 0;
+	period.it_interval.tv_nsec = periodNs;
+	period.it_value = period.it_interval;
+	return timer_settime(timer, 0, &period, 0);
+}
+
+int main(int argc, char *argv[])
+{
+	double runSeconds = (argc > 1) ? atof(argv[1]) : 2.0;
+	struct timespec start;
+	struct timespec now;
+	sigset_t mask;
+	uint32_t loop = 0;
+	uint32_t torn;
+	uint32_t level;
+
+	if ((argc > 2) && (strcmp(argv[2], "nolock") == 0))
+	{
+		useLock = 0;
+	}
+
+	sigemptyset(&mask);
+	if (Stress_Start(SIGRTMIN, Stress_Level1, &mask, STRESS_LEVEL1_NS) != 0)
+	{
+		perror("level 1");
+		return 2;
+	}
+	sigaddset(&mask, SIGRTMIN);			//level 1 cannot preempt level 2
+	if (Stress_Start(SIGRTMIN + 1, Stress_Level2, &mask, STRESS_LEVEL2_NS) != 0)
+	{
+		perror("level 2");
+		return 2;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	do
+	{
+		if ((++loop & 7) == 0)
+		{
+			Stress_Write(0);
+		}
+		else
+		{
+			Stress_Read(0);
+		}
+		clock_gettime(CLOCK_MONOTONIC, &now);
+	}
+	while ((double)(now.tv_sec - start.tv_sec) + (now.tv_nsec - start.tv_nsec) * 1e-9 < runSeconds);
+
+	signal(SIGRTMIN, SIG_IGN);
+	signal(SIGRTMIN + 1, SIG_IGN);
+
+	printf("%s, %.1f s\n", useLock ? "sequence lock" : "no lock", runSeconds);
+	printf("level  writes      reads       busy        torn\n");
+	torn = 0;
+	for (level = 0; level < STRESS_LEVELS; level++)
+	{
+		printf("%-5u  %-10u  %-10u  %-10u  %u\n", level, count[level].writes,
+				count[level].reads, count[level].busy, count[level].torn);
+		torn += count[level].torn;
+	}
+
+	if (useLock)
+	{
+		printf("%s\n", (torn == 0) ? "PASS: no torn copy" : "FAIL: torn copies accepted");
+		return (torn == 0) ? 0 : 1;
+	}
+	printf("%s\n", (torn != 0) ? "torn copies detected without the lock" : "no torn copy seen, run longer");
+	return 0;
+}
@@ -0,0 +1,799 @@
+/*******************************************************************************
+*
+* $File Name:       SIM.c$
+* @file             SIM.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Register window simulator of the MPC5744P (host build)
+* @brief            Register window simulator of the MPC5744P (host build)
+*
+*   Access of a register (see SIM.h):
+*     SIGSEGV  - window opened, time advanced, read hook, old word kept,
+*                trap flag set so the faulting instruction is single stepped
+*     SIGTRAP  - write hook with the old and the new word, window closed,
+*                pending interrupts dispatched
+*   SIGALRM (idle timer) is blocked during both handlers. A write of
+*   CPR0 opens or closes the ceiling section of the running level (blocking
+*   of SIM_Stats). Supplies the host
+*   ports of the firmware: TIME_PortRead (TIME.c) and INTC_PortEnable
+*   (MPC57xx__Interrupt_Init.c). A power-on reset of the MCU ends the run,
+*   the registers of the model blocks and the INTC are cleared.
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Tool created
+BRNY001					      19/10/2026 	   SIM_PowerOnReset  Power-on reset of the MCU (SIM_END_RESET)
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#define _GNU_SOURCE
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <setjmp.h>
+#include <time.h>
+#include <ucontext.h>
+#include <sys/mman.h>
+#include "MPC5744P.h"
+#include "TRACE.h"
+#include "SIM.h"
+
+#define SIM_EFLAGS_TF			0x100		///x86 trap flag (single step)
+#define SIM_FAULT_WRITE			0x2			///page fault error code: write access
+#define SIM_NESTING_MAX			16
+#define SIM_SSCIR_SET			0x02
+#define SIM_SSCIR_CLR			0x01
+
+//vector file of src/Interrupts
+extern const uintptr_t IntcIsrVectorTable[];
+void dummy(void);
+
+SIM_Stats SIMstats;
+
+static SIM_Model *p_simModels;
+static SIM_Model simIntc;
+static uint64_t simNow;
+static uint64_t simLimit;
+static uint32_t simEE;							///MSR[EE] of the simulated core
+static uint32_t simRequest[SIM_VECTORS / 32];	///interrupt request lines
+static uint32_t simCpr[SIM_NESTING_MAX];		///CPR of the preempted levels (INTC LIFO)
+static uint32_t simNesting;
+static uint64_t simArrival[SIM_VECTORS];		///arrival not served yet, SIM_NEVER - none
+static uint64_t simPreempted[SIM_NESTING_MAX + 1];	///time of the nested ISRs per level
+static struct {
+	uint32_t	base;							///priority of the level (0 - task)
+	uint32_t	ceiling;						///highest CPR of the open section, 0 - none
+	uint64_t	start;
+	uint64_t	preempted;						///simPreempted of the level at the start
+} simSection[SIM_NESTING_MAX + 1];				///CPR raised above the level (resource ceiling)
+static sigjmp_buf simEnd;
+static timer_t simIdleTimer;
+
+static volatile sig_atomic_t simRunning;
+static volatile sig_atomic_t simOpen;			///window open count
+static volatile sig_atomic_t simBusy;			///simulator code running (no idle jump)
+static volatile sig_atomic_t simActivity;		///accesses since the last idle tick
+
+//access being single stepped
+static volatile sig_atomic_t simPending;
+static uintptr_t simAddress;
+static uint32_t simWrite;
+static uint32_t simOld;
+static SIM_Model *p_simAccess;
+
+/***************************************************************************//*!
+*   @brief Opens the register window (nested).
+********************************************************************************/
+void SIM_Open(void)
+{
+	if (simOpen++ == 0)
+	{
+		(void)mprotect((void *)SIM_WINDOW_BASE, SIM_WINDOW_SIZE, PROT_READ | PROT_WRITE);
+	}
+}
+
+/***************************************************************************//*!
+*   @brief Closes the register window, the next access faults again.
+********************************************************************************/
+void SIM_Close(void)
+{
+	if (--simOpen == 0)
+	{
+		(void)mprotect((void *)SIM_WINDOW_BASE, SIM_WINDOW_SIZE, PROT_NONE);
+	}
+}
+
+/***************************************************************************//*!
+*   @brief Reads the aligned word of an address in the target order.
+*	@remarks 	Window open.
+********************************************************************************/
+uint32_t SIM_Word(uintptr_t address)
+{
+	return __builtin_bswap32(*(volatile uint32_t *)(address & ~(uintptr_t)3));
+}
+
+uint64_t SIM_Now(void)
+{
+	return simNow;
+}
+
+SIM_Model *SIM_Models(void)
+{
+	return p_simModels;
+}
+
+void SIM_AddModel(SIM_Model *p_model)
+{
+	p_model->p_next = p_simModels;
+	p_simModels = p_model;
+}
+
+void SIM_Wake(SIM_Model *p_model, uint64_t when)
+{
+	p_model->due = when;
+}
+
+/***************************************************************************//*!
+*   @brief Sets or clears the request line of an interrupt vector.
+********************************************************************************/
+void SIM_Request(uint32_t vector, uint32_t level)
+{
+	if (vector >= SIM_VECTORS)
+	{
+		return;
+	}
+	if (level != 0)
+	{
+		if ((simRequest[vector / 32] & (1u << (vector % 32))) == 0)
+		{
+			SIM_Response *p_response = &SIMstats.response[vector];
+
+			if ((p_response->arrivals != 0) && (simNow - p_response->lastArrival < p_response->minInterarrival))
+			{
+				p_response->minInterarrival = simNow - p_response->lastArrival;
+			}
+			p_response->arrivals++;
+			p_response->lastArrival = simNow;
+			simArrival[vector] = simNow;
+		}
+		simRequest[vector / 32] |= 1u << (vector % 32);
+	}
+	else
+	{
+		simRequest[vector / 32] &= ~(1u << (vector % 32));
+	}
+}
+
+static SIM_Model *SIM_ModelOf(uintptr_t address)
+{
+	SIM_Model *p_model;
+
+	for (p_model = p_simModels; p_model != 0; p_model = p_model->p_next)
+	{
+		if ((address >= p_model->base) && (address < p_model->base + p_model->size))
+		{
+			return p_model;
+		}
+	}
+	return 0;
+}
+
+/***************************************************************************//*!
+*   @brief Runs the model events due up to the current time, in time order.
+********************************************************************************/
+static void SIM_Events(void)
+{
+	SIM_Model *p_model;
+	SIM_Model *p_first;
+	uint64_t due;
+
+	SIM_Open();
+	for (;;)
+	{
+		p_first = 0;
+		for (p_model = p_simModels; p_model != 0; p_model = p_model->p_next)
+		{
+			if ((p_model->due <= simNow) && ((p_first == 0) || (p_model->due < p_first->due)))
+			{
+				p_first = p_model;
+			}
+		}
+		if (p_first == 0)
+		{
+			break;
+		}
+		due = p_first->due;
+		p_first->due = SIM_NEVER;
+		SIMstats.events++;
+		p_first->step(p_first, due);
+	}
+	SIM_Close();
+}
+
+static void SIM_Advance(uint64_t ticks)
+{
+	simNow += ticks;
+	SIM_Events();
+}
+
+static uint64_t SIM_NextEvent(void)
+{
+	SIM_Model *p_model;
+	uint64_t next = SIM_NEVER;
+
+	for (p_model = p_simModels; p_model != 0; p_model = p_model->p_next)
+	{
+		if (p_model->due < next)
+		{
+			next = p_model->due;
+		}
+	}
+	return next;
+}
+
+static void SIM_CheckLimit(void)
+{
+	if ((simRunning != 0) && (simNow >= simLimit))
+	{
+		siglongjmp(simEnd, SIM_END_LIMIT);
+	}
+}
+
+/***************************************************************************//*!
+*   @brief Returns the requested vector of the highest priority above CPR
+*			(lowest vector number first), SIM_VECTORS if none.
+*	@remarks 	Window open.
+********************************************************************************/
+static uint32_t SIM_Highest(uint32_t current, uint32_t *p_priority)
+{
+	uint32_t best = SIM_VECTORS;
+	uint32_t bestPriority = current;
+	uint32_t word;
+	uint32_t bits;
+	uint32_t vector;
+	uint32_t priority;
+
+	for (word = 0; word < SIM_VECTORS / 32; word++)
+	{
+		for (bits = simRequest[word]; bits != 0; bits &= bits - 1)
+		{
+			vector = word * 32 + (uint32_t)__builtin_ctz(bits);
+			priority = INTC_0.PSR[vector].B.PRIN;
+			if (priority > bestPriority)
+			{
+				best = vector;
+				bestPriority = priority;
+			}
+		}
+	}
+	*p_priority = bestPriority;
+	return best;
+}
+
+/***************************************************************************//*!
+*   @brief Opens or closes the ceiling section of the running level.
+* 	@par Description
+*					The section opens when CPR is raised above the priority
+*					of the level and closes when it returns to it. Its time
+*					without the nested ISRs blocks every priority from above
+*					the level up to the highest CPR of the section.
+********************************************************************************/
+static void SIM_Ceiling(uint32_t priority)
+{
+	uint32_t level = (simNesting <= SIM_NESTING_MAX) ? simNesting : SIM_NESTING_MAX;
+	uint64_t ticks;
+	uint32_t i;
+
+	if (priority > simSection[level].base)
+	{
+		if (simSection[level].ceiling == 0)
+		{
+			simSection[level].start = simNow;
+			simSection[level].preempted = simPreempted[level];
+		}
+		if (priority > simSection[level].ceiling)
+		{
+			simSection[level].ceiling = priority;
+		}
+	}
+	else if (simSection[level].ceiling != 0)
+	{
+		ticks = simNow - simSection[level].start - (simPreempted[level] - simSection[level].preempted);
+		for (i = simSection[level].base + 1; (i <= simSection[level].ceiling) && (i < SIM_PRIORITIES); i++)
+		{
+			if (ticks > SIMstats.blocking[i])
+			{
+				SIMstats.blocking[i] = ticks;
+			}
+		}
+		simSection[level].ceiling = 0;
+	}
+}
+
+/***************************************************************************//*!
+*   @brief Runs the ISR of a vector like the IVOR4 dispatcher, trace record
+*			included (TRACE_ISR).
+*	@param[in] vector - Vector of the ISR.
+*	@param[in] priority - Priority of the vector (CPR of the ISR).
+********************************************************************************/
+static void SIM_Interrupt(uint32_t vector, uint32_t priority)
+{
+	uintptr_t handler = IntcIsrVectorTable[vector];
+	SIM_Response *p_response = &SIMstats.response[vector];
+	uint64_t arrival = simArrival[vector];
+	uint64_t start = simNow;
+	uint64_t ticks;
+#if TRACE_ISR
+	TRACE_Record *p_record;
+	uint32_t entry;
+	uint32_t depth;
+	uint32_t sequence;
+#endif
+
+	if (handler == (uintptr_t)&dummy)
+	{
+		SIMstats.faultVector = vector;
+		if (simRunning == 0)
+		{
+			fprintf(stderr, "SIM: vector %u requested without handler\n", vector);
+			abort();
+		}
+		siglongjmp(simEnd, SIM_END_FAULT);
+	}
+
+	SIMstats.interrupts[vector]++;
+	if (simNesting > SIMstats.maxNesting)
+	{
+		SIMstats.maxNesting = simNesting;
+	}
+	simArrival[vector] = SIM_NEVER;
+	simPreempted[simNesting] = 0;
+	simSection[simNesting].base = priority;
+	simSection[simNesting].ceiling = 0;
+	SIM_Advance(SIM_TICKS_PER_ISR / 2);
+	if ((arrival != SIM_NEVER) && (simNow - arrival > p_response->maxLatency))
+	{
+		p_response->maxLatency = simNow - arrival;
+	}
+#if TRACE_ISR
+	entry = (uint32_t)simNow;
+	TRACEdepth = TRACEdepth + 1;
+#endif
+	((void (*)(void))handler)();
+	SIM_Advance(SIM_TICKS_PER_ISR / 2);
+
+	ticks = simNow - start;
+	simPreempted[simNesting - 1] += ticks;
+	p_response->totalExec += ticks - simPreempted[simNesting];
+	if (ticks - simPreempted[simNesting] > p_response->maxExec)
+	{
+		p_response->maxExec = ticks - simPreempted[simNesting];
+	}
+	if (arrival != SIM_NEVER)
+	{
+		p_response->served++;
+		if (simNow - arrival < p_response->minResponse)
+		{
+			p_response->minResponse = simNow - arrival;
+		}
+		if (simNow - arrival > p_response->maxResponse)
+		{
+			p_response->maxResponse = simNow - arrival;
+		}
+	}
+#if TRACE_ISR
+	depth = TRACEdepth - 1;
+	TRACEdepth = depth;
+	sequence = TRACEhead;
+	TRACEhead = sequence + 1;
+	p_record = &TRACEbuffer[sequence & (TRACE_SIZE - 1)];
+	p_record->entry = entry;
+	p_record->exit = (uint32_t)simNow;
+	p_record->vector = (uint16_t)vector;
+	p_record->depth = (uint16_t)depth;
+	p_record->sequence = sequence;
+#endif
+}
+
+/***************************************************************************//*!
+*   @brief Dispatches the pending interrupts, nested by priority.
+********************************************************************************/
+static void SIM_Dispatch(void)
+{
+	uint32_t current;
+	uint32_t priority;
+	uint32_t vector;
+
+	while ((simEE != 0) && (simOpen == 0) && (simPending == 0) && (simNesting < SIM_NESTING_MAX))
+	{
+		SIM_Open();
+		current = INTC_0.CPR0.B.PRI;
+		vector = SIM_Highest(current, &priority);
+		if (vector < SIM_VECTORS)
+		{
+			INTC_0.CPR0.B.PRI = priority;				//IACKR read
+			INTC_0.IACKR0.B.INTVEC = vector;
+		}
+		SIM_Close();
+		if (vector >= SIM_VECTORS)
+		{
+			return;
+		}
+
+		simCpr[simNesting++] = current;
+		SIM_Interrupt(vector, priority);
+		simNesting--;
+
+		SIM_Open();
+		INTC_0.CPR0.B.PRI = current;					//EOIR write
+		SIM_Close();
+	}
+}
+
+/***************************************************************************//*!
+*   @brief INTC block: software settable interrupts (SSCIR).
+* 	@par Description
+*					The byte of the faulting address is always written, the
+*					other Bytes of the word only if changed (word writes of
+*					SSCIR are not used). A SSCIR Byte reads as its flag (CLR).
+********************************************************************************/
+static void SIM_IntcWrite(SIM_Model *p_model, uint32_t offset, uint32_t old, uint32_t value)
+{
+	uint32_t first = offsetof(struct INTC_tag, SSCIR);
+	uint32_t byte;
+	uint32_t index;
+	uint32_t written;
+	uint32_t shift;
+
+	(void)p_model;
+	if ((offset & ~3u) == offsetof(struct INTC_tag, CPR0))
+	{
+		SIM_Ceiling(INTC_0.CPR0.B.PRI);
+		return;
+	}
+	if ((offset < (first & ~3u)) || (offset >= first + sizeof(INTC_0.SSCIR)))
+	{
+		return;
+	}
+	for (byte = 0; byte < 4; byte++)
+	{
+		index = (offset & ~3u) + byte - first;
+		shift = 24 - 8 * byte;
+		written = (value >> shift) & 0xFF;
+		if ((index >= sizeof(INTC_0.SSCIR)) ||
+			(((offset & 3u) != byte) && (written == ((old >> shift) & 0xFF))))
+		{
+			continue;
+		}
+		if (written & SIM_SSCIR_CLR)
+		{
+			SIM_Request(index, 0);
+		}
+		if (written & SIM_SSCIR_SET)
+		{
+			SIM_Request(index, 1);
+		}
+		INTC_0.SSCIR[index].R = ((simRequest[0] >> index) & 1u) ? SIM_SSCIR_CLR : 0;
+	}
+}
+
+/***************************************************************************//*!
+*   @brief SIGSEGV: start of a register access.
+********************************************************************************/
+static void SIM_Fault(int number, siginfo_t *p_info, void *p_context)
+{
+	ucontext_t *p_uc = (ucontext_t *)p_context;
+	uintptr_t address = (uintptr_t)p_info->si_addr;
+
+	if ((address < SIM_WINDOW_BASE) || (address >= SIM_WINDOW_BASE + SIM_WINDOW_SIZE) ||
+		(simPending != 0) || (simOpen != 0))
+	{
+		(void)signal(number, SIG_DFL);				//real fault, crash on return
+		return;
+	}
+
+	simPending = 1;
+	simActivity = 1;
+	simAddress = address;
+	simWrite = ((p_uc->uc_mcontext.gregs[REG_ERR] & SIM_FAULT_WRITE) != 0) ? 1 : 0;
+	p_simAccess = SIM_ModelOf(address);
+
+	SIM_Open();
+	SIM_Advance(SIM_TICKS_PER_ACCESS);
+	if ((simWrite == 0) && (p_simAccess != 0) && (p_simAccess->read != 0))
+	{
+		p_simAccess->read(p_simAccess, (uint32_t)(address - p_simAccess->base));
+	}
+	simOld = SIM_Word(address);
+	p_uc->uc_mcontext.gregs[REG_EFL] |= SIM_EFLAGS_TF;
+}
+
+/***************************************************************************//*!
+*   @brief SIGTRAP: end of a register access (faulting instruction done).
+********************************************************************************/
+static void SIM_Trap(int number, siginfo_t *p_info, void *p_context)
+{
+	ucontext_t *p_uc = (ucontext_t *)p_context;
+	SIM_Model *p_model = p_simAccess;
+	uint32_t offset;
+
+	(void)number;
+	(void)p_info;
+	p_uc->uc_mcontext.gregs[REG_EFL] &= ~(greg_t)SIM_EFLAGS_TF;
+	if (simPending == 0)
+	{
+		return;
+	}
+
+	if (p_model == 0)
+	{
+		SIMstats.unmodelled++;
+		(simWrite != 0) ? SIMstats.writes++ : SIMstats.reads++;
+	}
+	else
+	{
+		offset = (uint32_t)(simAddress - p_model->base);
+		if (simWrite != 0)
+		{
+			SIMstats.writes++;
+			p_model->writes++;
+			if (p_model->write != 0)
+			{
+				p_model->write(p_model, offset, simOld, SIM_Word(simAddress));
+			}
+		}
+		else
+		{
+			SIMstats.reads++;
+			p_model->reads++;
+			if (p_model->readDone != 0)
+			{
+				p_model->readDone(p_model, offset);
+			}
+		}
+	}
+	simPending = 0;
+	SIM_Close();
+
+	SIM_Dispatch();
+	SIM_CheckLimit();
+}
+
+/***************************************************************************//*!
+*   @brief SIGALRM: idle detection, the time jumps to the next model event if
+*			no register was accessed during a whole period.
+********************************************************************************/
+static void SIM_Idle(int number)
+{
+	uint64_t next;
+
+	(void)number;
+	if ((simRunning == 0) || (simOpen != 0) || (simPending != 0) || (simBusy != 0))
+	{
+		return;
+	}
+	if (simActivity != 0)
+	{
+		simActivity = 0;
+		return;
+	}
+	simBusy = 1;
+	next = SIM_NextEvent();
+	if (next > simLimit)
+	{
+		next = simLimit;
+	}
+	if (next > simNow)
+	{
+		SIMstats.idleJumps++;
+		SIMstats.idleTicks += next - simNow;
+		SIM_Advance(next - simNow);
+	}
+	SIM_Dispatch();
+	simBusy = 0;
+	SIM_CheckLimit();
+}
+
+/***************************************************************************//*!
+*   @brief Time base of the host build (TIME.c).
+********************************************************************************/
+uint64_t TIME_PortRead(void)
+{
+	simBusy++;
+	simActivity = 1;
+	SIMstats.timeReads++;
+	SIM_Advance(SIM_TICKS_PER_READ_TB);
+	SIM_Dispatch();
+	simBusy--;
+	SIM_CheckLimit();
+	return simNow;
+}
+
+/***************************************************************************//*!
+*   @brief MSR[EE] set (enableIrq of MPC57xx__Interrupt_Init.c).
+********************************************************************************/
+void INTC_PortEnable(void)
+{
+	simEE = 1;
+	SIM_Dispatch();
+}
+
+/***************************************************************************//*!
+*   @brief Maps the register window and installs the access handlers.
+*	@return 0 - done, -1 - window or handlers not available.
+********************************************************************************/
+int SIM_Init(void)
+{
+	struct sigaction action;
+	struct sigevent event;
+	void *p_window;
+	uint32_t vector;
+
+	p_window = mmap((void *)SIM_WINDOW_BASE, SIM_WINDOW_SIZE, PROT_NONE,
+					MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED_NOREPLACE, -1, 0);
+	if (p_window != (void *)SIM_WINDOW_BASE)
+	{
+		return -1;
+	}
+
+	memset(&action, 0, sizeof(action));
+	sigemptyset(&action.sa_mask);
+	sigaddset(&action.sa_mask, SIGALRM);
+	action.sa_flags = SA_SIGINFO | SA_NODEFER;		//ISRs dispatched at the end of an access fault again
+	action.sa_sigaction = SIM_Fault;
+	if (sigaction(SIGSEGV, &action, 0) != 0)
+	{
+		return -1;
+	}
+	action.sa_sigaction = SIM_Trap;
+	if (sigaction(SIGTRAP, &action, 0) != 0)
+	{
+		return -1;
+	}
+
+	memset(&action, 0, sizeof(action));
+	sigemptyset(&action.sa_mask);
+	action.sa_flags = SA_RESTART;
+	action.sa_handler = SIM_Idle;
+	if (sigaction(SIGALRM, &action, 0) != 0)
+	{
+		return -1;
+	}
+	memset(&event, 0, sizeof(event));
+	event.sigev_notify = SIGEV_SIGNAL;
+	event.sigev_signo = SIGALRM;
+	if (timer_create(CLOCK_PROCESS_CPUTIME_ID, &event, &simIdleTimer) != 0)
+	{
+		return -1;
+	}
+
+	for (vector = 0; vector < SIM_VECTORS; vector++)
+	{
+		SIMstats.response[vector].minInterarrival = SIM_NEVER;
+		SIMstats.response[vector].minResponse = SIM_NEVER;
+		simArrival[vector] = SIM_NEVER;
+	}
+
+	memset(&simIntc, 0, sizeof(simIntc));
+	simIntc.name = "INTC_0";
+	simIntc.base = (uintptr_t)&INTC_0;
+	simIntc.size = sizeof(struct INTC_tag);
+	simIntc.write = SIM_IntcWrite;
+	simIntc.due = SIM_NEVER;
+	SIM_AddModel(&simIntc);
+	return 0;
+}
+
+static void SIM_IdleTimer(long periodNs)
+{
+	struct itimerspec period;
+
+	period.it_interval.tv_sec = 0;
+	period.it_interval.tv_nsec = periodNs;
+	period.it_value = period.it_interval;
+	(void)timer_settime(simIdleTimer, 0, &period, 0);
+}
+
+/*
+*	Registers of the model blocks (INTC included) and interrupt state after a
+*	power-on reset. Plain memory blocks keep their content.
+*/
+static void SIM_ResetModels(void)
+{
+	SIM_Model *p_model;
+	uint32_t vector;
+
+	SIM_Open();
+	for (p_model = p_simModels; p_model != 0; p_model = p_model->p_next)
+	{
+		if (p_model->size != 0)
+		{
+			memset((void *)p_model->base, 0, p_model->size);
+		}
+	}
+	SIM_Close();
+	memset(simRequest, 0, sizeof(simRequest));
+	for (vector = 0; vector < SIM_VECTORS; vector++)
+	{
+		simArrival[vector] = SIM_NEVER;
+	}
+	memset(simSection, 0, sizeof(simSection));
+	simEE = 0;
+}
+
+/***************************************************************************//*!
+*   @brief Power-on reset of the MCU (e.g. Vcore back after the LPOFF of the
+*			FS65): SIM_Run ends with SIM_END_RESET.
+*	@remarks 	Called from a model step. The owners of the models set their
+*				reset values again (SIMDEV_Reset) before the next SIM_Run.
+********************************************************************************/
+void SIM_PowerOnReset(void)
+{
+	if (simRunning != 0)
+	{
+		siglongjmp(simEnd, SIM_END_RESET);
+	}
+}
+
+/***************************************************************************//*!
+*   @brief Runs a function of the firmware for a simulated duration.
+*	@param[in] p_entry - Function (e.g. main of the firmware).
+*	@param[in] ticks - Simulated duration [core ticks].
+*	@return SIM_END_RETURN / SIM_END_LIMIT / SIM_END_FAULT / SIM_END_RESET.
+*	@remarks 	On SIM_END_LIMIT, SIM_END_FAULT and SIM_END_RESET the running
+*				ISRs are abandoned, CPR returns to the level of the interrupted
+*				code (0 after SIM_END_RESET).
+********************************************************************************/
+int SIM_Run(void (*p_entry)(void), uint64_t ticks)
+{
+	int result;
+
+	simLimit = simNow + ticks;
+	result = sigsetjmp(simEnd, 1);
+	if (result == 0)
+	{
+		simRunning = 1;
+		SIM_IdleTimer(SIM_IDLE_PERIOD_US * 1000L);
+		p_entry();
+		result = SIM_END_RETURN;
+	}
+	simRunning = 0;
+	SIM_IdleTimer(0);
+
+	simPending = 0;
+	simBusy = 0;
+	if (simOpen != 0)
+	{
+		simOpen = 1;
+		SIM_Close();
+	}
+	if (simNesting != 0)
+	{
+		SIM_Open();
+		INTC_0.CPR0.B.PRI = simCpr[0];
+		SIM_Close();
+		simNesting = 0;
+		simSection[0].ceiling = 0;
+#if TRACE_ISR
+		TRACEdepth = 0;
+#endif
+	}
+	if (result == SIM_END_RESET)
+	{
+		SIM_ResetModels();
+	}
+	return result;
+}
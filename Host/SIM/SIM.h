@@ -0,0 +1,152 @@
+/*******************************************************************************
+*
+* $File Name:       SIM.h$
+* @file             SIM.h
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Register window simulator of the MPC5744P (host build)
+* @brief            Register window simulator of the MPC5744P (host build)
+*
+*   The firmware is compiled for the host with MPC5744P_HOST: the peripheral
+*   macros of MPC5744P.h keep their addresses and the structures keep the
+*   target byte and bit field order. The simulator maps the peripheral
+*   window (0xF8000000 - 0xFFFFFFFF) without access rights, so every
+*   register access faults: the access is completed by single stepping the
+*   faulting instruction with the window open, and the model owning the
+*   address is called before a read and after a write.
+*
+*   Time is simulated: SIM_TICKS_PER_ACCESS core ticks per register access,
+*   one tick per time base read (TIME_PortRead), no time for the code
+*   between them. A code running without register access (RAM polling loop,
+*   idle loop) is detected by the idle timer and the time jumps to the next
+*   model event.
+*
+*   The virtual INTC requests the ISR of the vector table (vector file of
+*   src/Interrupts) when MSR[EE] is set (INTC_PortEnable) and the priority
+*   of the vector is above INTC_0.CPR0, nested like the IVOR4 dispatcher.
+*   Per vector it records the arrivals (rising edges of the request line),
+*   the response (arrival to the end of the ISR) and the execution time of
+*   the ISR without the nested ISRs; per priority the longest section of
+*   code running below it with CPR raised to or above it (blocking). These
+*   are the inputs of the response-time analysis of simwcrt.c.
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Tool created
+BRNY001					      19/10/2026 	   SIM_PowerOnReset  Power-on reset of the MCU (SIM_END_RESET)
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#ifndef _SIM_H_
+#define _SIM_H_
+
+#include <stdint.h>
+
+/*==================================================================================================
+*   Configurable parameters
+==================================================================================================*/
+
+#define SIM_TICKS_PER_ACCESS	16			///core ticks of a peripheral register access (bridge wait states)
+#define SIM_TICKS_PER_READ_TB	1			///core ticks of a time base read
+#define SIM_TICKS_PER_ISR		40			///core ticks of the IVOR4 prologue and epilogue
+#define SIM_IDLE_PERIOD_US		50			///host period of the idle detection [us]
+
+/*==================================================================================================
+*   NON - configurable parameters
+==================================================================================================*/
+
+#define SIM_WINDOW_BASE			0xF8000000UL	///peripheral window of the MPC5744P
+#define SIM_WINDOW_SIZE			0x08000000UL
+#define SIM_VECTORS				1024			///INTC vectors (PSR registers)
+#define SIM_PRIORITIES			16				///INTC priorities (PSR[PRIN], CPR[PRI])
+#define SIM_NEVER				0xFFFFFFFFFFFFFFFFULL
+
+//SIM_Run results
+#define SIM_END_RETURN			0		///entry function returned
+#define SIM_END_LIMIT			1		///time limit reached
+#define SIM_END_FAULT			2		///vector without handler (dummy) requested
+#define SIM_END_RESET			3		///power-on reset of the MCU (SIM_PowerOnReset)
+
+/*==================================================================================================
+*   Structures/Type defines
+==================================================================================================*/
+
+typedef struct SIM_Model SIM_Model;
+
+/*
+*	Behavior model of a register block. The hooks are called with the window
+*	open, the model accesses its registers through the MPC5744P.h structures.
+*	Offsets are relative to base, values are the aligned 32-bit word of the
+*	access in the target (big-endian) order.
+*/
+struct SIM_Model {
+	const char	*name;
+	uintptr_t	base;
+	uint32_t	size;
+	void		(*read)(SIM_Model *p_model, uint32_t offset);							///before a read (0 - none)
+	void		(*readDone)(SIM_Model *p_model, uint32_t offset);						///after a read (0 - none)
+	void		(*write)(SIM_Model *p_model, uint32_t offset, uint32_t old, uint32_t value);	///after a write (0 - none)
+	void		(*step)(SIM_Model *p_model, uint64_t now);								///event due (0 - none)
+	uint64_t	due;					///time of the next event, SIM_NEVER - none
+	uint32_t	reads;
+	uint32_t	writes;
+	SIM_Model	*p_next;
+};
+
+typedef struct {						///[core ticks]
+	uint32_t	arrivals;				///rising edges of the request line
+	uint32_t	served;					///ISR runs started by an arrival
+	uint64_t	lastArrival;
+	uint64_t	minInterarrival;		///SIM_NEVER - less than two arrivals
+	uint64_t	maxLatency;				///arrival to the entry of the ISR
+	uint64_t	minResponse;			///arrival to the end of the ISR, SIM_NEVER - not served
+	uint64_t	maxResponse;
+	uint64_t	maxExec;				///ISR (prologue and epilogue included) without the nested ISRs
+	uint64_t	totalExec;				///sum of the execution times (CPU load of the vector)
+} SIM_Response;
+
+typedef struct {
+	uint64_t	reads;					///register reads (all blocks)
+	uint64_t	writes;					///register writes (all blocks)
+	uint64_t	unmodelled;				///accesses out of the model blocks (plain memory)
+	uint64_t	timeReads;				///TIME_PortRead calls
+	uint64_t	events;					///model steps
+	uint64_t	idleJumps;				///time jumps of the idle detection
+	uint64_t	idleTicks;				///time skipped by the idle detection
+	uint32_t	interrupts[SIM_VECTORS];	///ISR calls per vector
+	uint32_t	maxNesting;				///deepest interrupt nesting
+	uint32_t	faultVector;			///vector of SIM_END_FAULT
+	SIM_Response response[SIM_VECTORS];
+	uint64_t	blocking[SIM_PRIORITIES];	///longest CPR raise covering the priority by a lower level [core ticks]
+} SIM_Stats;
+
+extern SIM_Stats SIMstats;
+
+/*==================================================================================================
+*   Function prototypes
+==================================================================================================*/
+
+int SIM_Init(void);
+void SIM_AddModel(SIM_Model *p_model);
+int SIM_Run(void (*p_entry)(void), uint64_t ticks);
+uint64_t SIM_Now(void);
+void SIM_Wake(SIM_Model *p_model, uint64_t when);
+void SIM_Request(uint32_t vector, uint32_t level);
+void SIM_Open(void);
+void SIM_Close(void);
+uint32_t SIM_Word(uintptr_t address);
+void SIM_PowerOnReset(void);
+SIM_Model *SIM_Models(void);
+
+#endif
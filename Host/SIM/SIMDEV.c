@@ -0,0 +1,1104 @@
+/*******************************************************************************
+*
+* $File Name:       SIMDEV.c$
+* @file             SIMDEV.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Peripheral models of the register window simulator
+* @brief            Peripheral models of the register window simulator
+*
+*   The models keep their state in the registers (MPC5744P.h structures,
+*   window open in the hooks) and in a small context for what the registers
+*   do not show (FIFOs, shift register, line input). W1C registers are
+*   rebuilt from the old word and the written value.
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Tool created
+BRNY001					      19/10/2026 	   SIMDEV_PitFire  PIT expiry on demand (LIN tick arrivals)
+BRNY001					      19/10/2026 	   SIMDEV_Reset	  Reset values set again after a power-on reset of the MCU
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#include <stddef.h>
+#include <string.h>
+#include "MPC5744P_drv.h"
+#include "FCCU.h"
+#include "SIM.h"
+#include "SIMDEV.h"
+
+///offset of a register of a block
+#define SIMDEV_AT(offset, block, reg)	(((offset) & ~3u) == offsetof(struct block, reg))
+///offset in a register array of a block
+#define SIMDEV_IN(offset, block, reg)	(((offset) >= offsetof(struct block, reg)) && \
+										 ((offset) < offsetof(struct block, reg) + sizeof(((struct block *)0)->reg)))
+///core ticks of a number of cycles of a clock
+#define SIMDEV_TICKS(cycles, hz)		((((uint64_t)(cycles) * CLOCK_SYS_HZ) + (hz) - 1) / (hz))
+#define SIMDEV_US(us)					((uint64_t)(us) * (CLOCK_SYS_HZ / 1000000))
+
+#define SIMDEV_FIFO_DEPTH		4			///DSPI TX and RX FIFOs
+#define SIMDEV_UART_LINE		256			///Bytes waiting on the UART line
+#define SIMDEV_PIT_VECTOR		226
+#define SIMDEV_SIUL_VECTOR		243			///EIRQ 0 - 7, next vectors for 8 - 31
+#define SIMDEV_ADC_VECTOR		496			///ADC_0 EOC, + 4 per module
+#define SIMDEV_LINFLEX_VECTOR	376			///LINFlexD_0 RXI, + 4 per module (TXI + 1, ERR + 2)
+#define SIMDEV_PADS				156
+#define SIMDEV_ME_KEY			0x5AF0
+#define SIMDEV_ME_KEY_INV		0xA50F
+#define SIMDEV_CAN_TX_DATA		0xC			///CODE of a TX buffer to send
+#define SIMDEV_CAN_TX_INACTIVE	0x8
+
+typedef struct {
+	SIM_Model					model;		///first member (hooks get the model)
+	volatile struct SPI_tag		*p_regs;
+	uint32_t					number;
+	uint32_t					tx[SIMDEV_FIFO_DEPTH];
+	uint32_t					txCount;
+	uint32_t					rx[SIMDEV_FIFO_DEPTH];
+	uint32_t					rxCount;
+	uint32_t					shift;		///command being transferred
+	uint32_t					busy;
+} SIMDEV_Spi;
+
+typedef struct {
+	SIM_Model					model;
+	volatile struct ADC_tag		*p_regs;
+	uint32_t					number;
+	uint32_t					chain;		///channels left in the chain
+	uint32_t					channel;	///channel being converted
+	uint32_t					running;
+} SIMDEV_Adc;
+
+typedef struct {
+	SIM_Model					model;
+	volatile struct LINFlexD_tag *p_regs;
+	uint32_t					number;
+	uint32_t					txWord;
+	uint32_t					txBytes;
+	uint64_t					txDue;
+	uint8_t						line[SIMDEV_UART_LINE];
+	uint32_t					lineHead;
+	uint32_t					lineTail;
+	uint64_t					rxDue;
+	uint64_t					timeoutDue;
+	uint32_t					rdc;		///Bytes in the buffer (LINSR[RDC])
+} SIMDEV_Uart;
+
+typedef struct {
+	SIM_Model					model;
+	volatile struct CAN_tag		*p_regs;
+	uint32_t					number;
+	uint64_t					pending;	///TX buffers to send
+	int32_t						current;	///buffer on the bus, -1 - none
+} SIMDEV_Can;
+
+typedef struct {
+	uint64_t	expiry;
+	uint32_t	running;
+} SIMDEV_PitChannel;
+
+SIMDEV_Stats SIMDEVstats;
+uint32_t (*SIMDEV_SpiSlave)(uint32_t dspi, uint32_t pcs, uint32_t tx);
+uint32_t (*SIMDEV_AdcInput)(uint32_t adc, uint32_t channel);
+void (*SIMDEV_UartSink)(uint32_t linflex, uint8_t data);
+void (*SIMDEV_CanSink)(uint32_t module, uint32_t buffer, uint32_t id, uint32_t dataHigh, uint32_t dataLow);
+
+static SIM_Model meModel;
+static uint32_t meTarget;
+static uint32_t meKey;
+static SIM_Model fccuModel;
+static SIM_Model pitModel;
+static SIMDEV_PitChannel pitChannel[4];
+static SIM_Model siulModel;
+static uint8_t siulDriven[SIMDEV_PADS];
+static uint8_t siulLevel[SIMDEV_PADS];
+static SIMDEV_Spi spi[4];
+static SIMDEV_Adc adc[4];
+static SIMDEV_Uart uart[2];
+static SIMDEV_Can can[3];
+
+//W1C and flag masks, built from the structures (target bit order)
+static uint32_t spiSrW1C;
+static uint32_t canEsr1W1C;
+
+/*==================================================================================================
+*   MC_ME: mode transition
+==================================================================================================*/
+
+static void SIMDEV_MeWrite(SIM_Model *p_model, uint32_t offset, uint32_t old, uint32_t value)
+{
+	(void)old;
+	if (!SIMDEV_AT(offset, MC_ME_tag, MCTL))
+	{
+		return;
+	}
+	if ((value & 0xFFFF) == SIMDEV_ME_KEY)
+	{
+		meTarget = value >> 28;
+		meKey = 1;
+	}
+	else if (((value & 0xFFFF) == SIMDEV_ME_KEY_INV) && (meKey != 0) && ((value >> 28) == meTarget))
+	{
+		MC_ME.GS.B.S_MTRANS = 1;
+		SIM_Wake(p_model, SIM_Now() + SIMDEV_US(SIMDEV_ME_TRANSITION_US));
+		meKey = 0;
+	}
+	else
+	{
+		meKey = 0;
+	}
+}
+
+static void SIMDEV_MeStep(SIM_Model *p_model, uint64_t now)
+{
+	(void)p_model;
+	(void)now;
+	MC_ME.GS.B.S_CURRENT_MODE = meTarget;
+	MC_ME.GS.B.S_XOSC = MC_ME.DRUN_MC.B.XOSCON;
+	MC_ME.GS.B.S_PLL0 = MC_ME.DRUN_MC.B.PLL0ON;
+	MC_ME.GS.B.S_PLL1 = MC_ME.DRUN_MC.B.PLL1ON;
+	MC_ME.GS.B.S_SYSCLK = MC_ME.DRUN_MC.B.SYSCLK;
+	MC_ME.GS.B.S_MTRANS = 0;
+}
+
+/*==================================================================================================
+*   FCCU: operations
+==================================================================================================*/
+
+static void SIMDEV_FccuWrite(SIM_Model *p_model, uint32_t offset, uint32_t old, uint32_t value)
+{
+	(void)old;
+	if (SIMDEV_AT(offset, FCCU_tag, CTRL) && ((value & 0x1F) != 0))
+	{
+		FCCU.CTRL.B.OPS = 1;								//in progress
+		SIM_Wake(p_model, SIM_Now() + SIMDEV_US(SIMDEV_FCCU_OPERATION_US));
+	}
+}
+
+static void SIMDEV_FccuStep(SIM_Model *p_model, uint64_t now)
+{
+	(void)p_model;
+	(void)now;
+	FCCU.CTRL.B.OPR = 0;
+	FCCU.CTRL.B.OPS = FCCU_OPS_SUCCESS;
+}
+
+/*==================================================================================================
+*   PIT_0: periodic channels
+==================================================================================================*/
+
+static uint64_t SIMDEV_PitPeriod(uint32_t channel)
+{
+	return ((uint64_t)PIT_0.TIMER[channel].LDVAL.R + 1) * SIMDEV_TICKS(1, CLOCK_PBRIDGE_HZ);
+}
+
+static void SIMDEV_PitUpdate(SIM_Model *p_model)
+{
+	uint64_t next = SIM_NEVER;
+	uint32_t channel;
+
+	for (channel = 0; channel < 4; channel++)
+	{
+		if ((pitChannel[channel].running != 0) && (pitChannel[channel].expiry < next))
+		{
+			next = pitChannel[channel].expiry;
+		}
+		SIM_Request(SIMDEV_PIT_VECTOR + channel,
+					PIT_0.TIMER[channel].TCTRL.B.TIE & PIT_0.TIMER[channel].TFLG.B.TIF);
+	}
+	SIM_Wake(p_model, next);
+}
+
+static void SIMDEV_PitRead(SIM_Model *p_model, uint32_t offset)
+{
+	uint32_t channel;
+
+	(void)p_model;
+	if (!SIMDEV_IN(offset, PIT_tag, TIMER))
+	{
+		return;
+	}
+	channel = (offset - offsetof(struct PIT_tag, TIMER)) / sizeof(PIT_TIMER_tag);
+	if (pitChannel[channel].running != 0)
+	{
+		PIT_0.TIMER[channel].CVAL.R = (uint32_t)((pitChannel[channel].expiry - SIM_Now()) /
+										SIMDEV_TICKS(1, CLOCK_PBRIDGE_HZ));
+	}
+}
+
+static void SIMDEV_PitWrite(SIM_Model *p_model, uint32_t offset, uint32_t old, uint32_t value)
+{
+	uint32_t channel;
+	uint32_t reg;
+
+	if (!SIMDEV_IN(offset, PIT_tag, TIMER))
+	{
+		return;
+	}
+	channel = (offset - offsetof(struct PIT_tag, TIMER)) / sizeof(PIT_TIMER_tag);
+	reg = (offset - offsetof(struct PIT_tag, TIMER)) % sizeof(PIT_TIMER_tag) & ~3u;
+
+	if (reg == offsetof(PIT_TIMER_tag, TCTRL))
+	{
+		if ((PIT_0.TIMER[channel].TCTRL.B.TEN != 0) && (pitChannel[channel].running == 0))
+		{
+			pitChannel[channel].running = 1;
+			pitChannel[channel].expiry = SIM_Now() + SIMDEV_PitPeriod(channel);
+		}
+		else if (PIT_0.TIMER[channel].TCTRL.B.TEN == 0)
+		{
+			pitChannel[channel].running = 0;
+		}
+	}
+	else if (reg == offsetof(PIT_TIMER_tag, TFLG))
+	{
+		PIT_0.TIMER[channel].TFLG.R = old & ~value & 1u;	//w1c
+	}
+	//LDVAL: new period from the next reload
+	SIMDEV_PitUpdate(p_model);
+}
+
+static void SIMDEV_PitStep(SIM_Model *p_model, uint64_t now)
+{
+	uint32_t channel;
+
+	for (channel = 0; channel < 4; channel++)
+	{
+		if ((pitChannel[channel].running != 0) && (pitChannel[channel].expiry <= now))
+		{
+			PIT_0.TIMER[channel].TFLG.B.TIF = 1;
+			pitChannel[channel].expiry += SIMDEV_PitPeriod(channel);
+			SIMDEVstats.pitExpiries[channel]++;
+		}
+	}
+	SIMDEV_PitUpdate(p_model);
+}
+
+/***************************************************************************//*!
+*   @brief Expiry of a PIT channel outside of its period (arrival patterns):
+*			sets TFLG[TIF] and enables its request (TCTRL[TIE]).
+********************************************************************************/
+void SIMDEV_PitFire(uint32_t channel)
+{
+	SIM_Open();
+	PIT_0.TIMER[channel & 3].TCTRL.B.TIE = 1;
+	PIT_0.TIMER[channel & 3].TFLG.B.TIF = 1;
+	SIMDEVstats.pitExpiries[channel & 3]++;
+	SIMDEV_PitUpdate(&pitModel);
+	SIM_Close();
+}
+
+/*==================================================================================================
+*   ADC: normal conversion chain
+==================================================================================================*/
+
+static void SIMDEV_AdcUpdate(SIMDEV_Adc *p_adc)
+{
+	volatile struct ADC_tag *p_regs = p_adc->p_regs;
+	uint32_t eoc;
+	uint32_t ech;
+
+	eoc = p_regs->IMR.B.MSKEOC & p_regs->ISR.B.EOC & ((p_regs->CEOCFR0.R & p_regs->CIMR0.R) != 0);
+	ech = p_regs->IMR.B.MSKECH & p_regs->ISR.B.ECH;
+	SIM_Request(SIMDEV_ADC_VECTOR + 4 * p_adc->number, eoc | ech);
+}
+
+static void SIMDEV_AdcNext(SIMDEV_Adc *p_adc)
+{
+	volatile struct ADC_tag *p_regs = p_adc->p_regs;
+	uint32_t cycles;
+
+	if (p_adc->chain == 0)
+	{
+		p_regs->ISR.B.ECH = 1;
+		if (p_regs->MCR.B.MODE != 0)
+		{
+			p_adc->chain = p_regs->NCMR0.R & 0xFFFF;		//scan mode: next chain
+		}
+		if (p_adc->chain == 0)
+		{
+			p_adc->running = 0;
+			p_regs->MCR.B.NSTART = 0;
+			p_regs->MSR.B.NSTART = 0;
+			return;
+		}
+	}
+	p_adc->channel = (uint32_t)__builtin_ctz(p_adc->chain);
+	p_adc->chain &= p_adc->chain - 1;
+	p_regs->MSR.B.CHADDR = p_adc->channel;
+
+	//sampling (at least CLOCK_ADC_INPSAMP_MIN cycles) and 14 cycles of evaluation
+	cycles = p_regs->CTR0.B.INPSAMP;
+	if (cycles < CLOCK_ADC_INPSAMP_MIN)
+	{
+		cycles = CLOCK_ADC_INPSAMP_MIN;
+	}
+	SIM_Wake(&p_adc->model, SIM_Now() + SIMDEV_TICKS(cycles + 14, CLOCK_ADC_HZ));
+}
+
+static void SIMDEV_AdcStep(SIM_Model *p_model, uint64_t now)
+{
+	SIMDEV_Adc *p_adc = (SIMDEV_Adc *)p_model;
+	volatile struct ADC_tag *p_regs = p_adc->p_regs;
+	uint32_t channel = p_adc->channel;
+	uint32_t result;
+
+	(void)now;
+	if (p_adc->running == 0)
+	{
+		return;
+	}
+	result = (SIMDEV_AdcInput != 0) ? SIMDEV_AdcInput(p_adc->number, channel) : SIMDEV_ADC_DEFAULT;
+	if (p_regs->CDR[channel].B.VALID != 0)
+	{
+		p_regs->CDR[channel].B.OVERW = 1;
+	}
+	p_regs->CDR[channel].B.VALID = 1;
+	p_regs->CDR[channel].B.RESULT = 0;						//normal conversion
+	p_regs->CDR[channel].B.CDATA = result & 0xFFF;
+	p_regs->CEOCFR0.R = p_regs->CEOCFR0.R | (1u << channel);
+	p_regs->ISR.B.EOC = 1;
+	SIMDEVstats.adcConversions++;
+
+	SIMDEV_AdcNext(p_adc);
+	SIMDEV_AdcUpdate(p_adc);
+}
+
+static void SIMDEV_AdcReadDone(SIM_Model *p_model, uint32_t offset)
+{
+	SIMDEV_Adc *p_adc = (SIMDEV_Adc *)p_model;
+	uint32_t channel;
+
+	if (SIMDEV_IN(offset, ADC_tag, CDR))
+	{
+		channel = (offset - offsetof(struct ADC_tag, CDR)) / sizeof(ADC_CDR_tag);
+		p_adc->p_regs->CDR[channel].B.VALID = 0;			//cleared by the read
+		p_adc->p_regs->CDR[channel].B.OVERW = 0;
+	}
+}
+
+static void SIMDEV_AdcWrite(SIM_Model *p_model, uint32_t offset, uint32_t old, uint32_t value)
+{
+	SIMDEV_Adc *p_adc = (SIMDEV_Adc *)p_model;
+	volatile struct ADC_tag *p_regs = p_adc->p_regs;
+
+	if (SIMDEV_AT(offset, ADC_tag, MCR))
+	{
+		if ((p_regs->MCR.B.NSTART != 0) && (p_adc->running == 0))
+		{
+			p_adc->running = 1;
+			p_adc->chain = p_regs->NCMR0.R & 0xFFFF;
+			p_regs->MSR.B.NSTART = 1;
+			SIMDEV_AdcNext(p_adc);
+		}
+		else if ((p_regs->MCR.B.NSTART == 0) && (p_adc->running != 0))
+		{
+			p_adc->running = 0;								//chain stopped
+			p_regs->MSR.B.NSTART = 0;
+			SIM_Wake(p_model, SIM_NEVER);
+		}
+	}
+	else if (SIMDEV_AT(offset, ADC_tag, ISR))
+	{
+		p_regs->ISR.R = old & ~value & 0x1Fu;				//w1c
+	}
+	else if (SIMDEV_AT(offset, ADC_tag, CEOCFR0))
+	{
+		p_regs->CEOCFR0.R = old & ~value;					//w1c
+	}
+	SIMDEV_AdcUpdate(p_adc);
+}
+
+/***************************************************************************//*!
+*   @brief Hardware trigger of the normal chain (CTU, external trigger):
+*			starts the chain of NCMR0 as MCR[NSTART] does, if not running.
+********************************************************************************/
+void SIMDEV_AdcTrigger(uint32_t number)
+{
+	SIMDEV_Adc *p_adc = &adc[number & 3];
+	volatile struct ADC_tag *p_regs = p_adc->p_regs;
+
+	SIM_Open();
+	if (p_adc->running == 0)
+	{
+		p_adc->running = 1;
+		p_adc->chain = p_regs->NCMR0.R & 0xFFFF;
+		p_regs->MSR.B.NSTART = 1;
+		SIMDEV_AdcNext(p_adc);
+		SIMDEV_AdcUpdate(p_adc);
+	}
+	SIM_Close();
+}
+
+/*==================================================================================================
+*   DSPI: master transfers
+==================================================================================================*/
+
+static uint32_t SIMDEV_SpiDepth(uint32_t disabled)
+{
+	return (disabled != 0) ? 1 : SIMDEV_FIFO_DEPTH;
+}
+
+static void SIMDEV_SpiStatus(SIMDEV_Spi *p_spi)
+{
+	volatile struct SPI_tag *p_regs = p_spi->p_regs;
+
+	p_regs->SR.B.TXCTR = p_spi->txCount;
+	p_regs->SR.B.RXCTR = p_spi->rxCount;
+	p_regs->SR.B.TFFF = (p_spi->txCount < SIMDEV_SpiDepth(p_regs->MCR.B.DIS_TXF)) ? 1 : 0;
+	p_regs->SR.B.TXRXS = (p_regs->MCR.B.HALT == 0) ? 1 : 0;
+	if (p_spi->rxCount != 0)
+	{
+		p_regs->POPR.R = p_spi->rx[0];
+	}
+}
+
+/***************************************************************************//*!
+*   @brief Frame duration of a command: PCS to SCK delay, the bits, after SCK
+*			delay and delay after transfer (CTAR of the command).
+********************************************************************************/
+static uint64_t SIMDEV_SpiFrame(SIMDEV_Spi *p_spi, uint32_t command)
+{
+	static const uint32_t prescaler[4] = {2, 3, 5, 7};
+	static const uint32_t delayPrescaler[4] = {1, 3, 5, 7};
+	static const uint32_t scaler[16] = {2, 4, 6, 8, 16, 32, 64, 128, 256, 512, 1024, 2048,
+										4096, 8192, 16384, 32768};
+	volatile SPI_MODE_CTAR_tag *p_ctar = &p_spi->p_regs->MODE.CTAR[(command >> 28) & 3];
+	uint64_t sck;
+	uint64_t cycles;
+
+	sck = (uint64_t)prescaler[p_ctar->B.PBR] * scaler[p_ctar->B.BR];
+	if (p_ctar->B.DBR != 0)
+	{
+		sck /= 2;
+	}
+	cycles = sck * (p_ctar->B.FMSZ + 1);
+	cycles += (uint64_t)delayPrescaler[p_ctar->B.PCSSCK] << (p_ctar->B.CSSCK + 1);
+	cycles += (uint64_t)delayPrescaler[p_ctar->B.PASC] << (p_ctar->B.ASC + 1);
+	cycles += (uint64_t)delayPrescaler[p_ctar->B.PDT] << (p_ctar->B.DT + 1);
+	return SIMDEV_TICKS(cycles, CLOCK_PBRIDGE_HZ);
+}
+
+static void SIMDEV_SpiStart(SIMDEV_Spi *p_spi)
+{
+	uint64_t ticks;
+	uint32_t i;
+
+	if ((p_spi->busy != 0) || (p_spi->txCount == 0) || (p_spi->p_regs->MCR.B.HALT != 0))
+	{
+		return;
+	}
+	p_spi->shift = p_spi->tx[0];
+	for (i = 1; i < p_spi->txCount; i++)
+	{
+		p_spi->tx[i - 1] = p_spi->tx[i];
+	}
+	p_spi->txCount--;
+	p_spi->busy = 1;
+	ticks = SIMDEV_SpiFrame(p_spi, p_spi->shift);
+	SIMDEVstats.spiTicks += ticks;
+	SIM_Wake(&p_spi->model, SIM_Now() + ticks);
+}
+
+static void SIMDEV_SpiStep(SIM_Model *p_model, uint64_t now)
+{
+	SIMDEV_Spi *p_spi = (SIMDEV_Spi *)p_model;
+	volatile struct SPI_tag *p_regs = p_spi->p_regs;
+	uint32_t bits = p_regs->MODE.CTAR[(p_spi->shift >> 28) & 3].B.FMSZ + 1;
+	uint32_t mask = (bits >= 32) ? 0xFFFFFFFF : ((1u << bits) - 1);
+	uint32_t answer = 0;
+
+	(void)now;
+	if (SIMDEV_SpiSlave != 0)
+	{
+		answer = SIMDEV_SpiSlave(p_spi->number, (p_spi->shift >> 16) & 0xFF, p_spi->shift & mask);
+	}
+	if (p_spi->rxCount < SIMDEV_SpiDepth(p_regs->MCR.B.DIS_RXF))
+	{
+		p_spi->rx[p_spi->rxCount++] = answer & mask;
+	}
+	else
+	{
+		p_regs->SR.B.RFOF = 1;
+		SIMDEVstats.spiOverruns++;
+	}
+	p_regs->SR.B.TCF = 1;
+	p_regs->SR.B.RFDF = 1;
+	if ((p_spi->shift >> 27) & 1)
+	{
+		p_regs->SR.B.EOQF = 1;
+	}
+	p_spi->busy = 0;
+	SIMDEVstats.spiFrames++;
+	SIMDEV_SpiStatus(p_spi);
+	SIMDEV_SpiStart(p_spi);
+}
+
+static void SIMDEV_SpiRead(SIM_Model *p_model, uint32_t offset)
+{
+	SIMDEV_Spi *p_spi = (SIMDEV_Spi *)p_model;
+
+	if (SIMDEV_AT(offset, SPI_tag, POPR) && (p_spi->rxCount != 0))
+	{
+		p_spi->p_regs->POPR.R = p_spi->rx[0];
+	}
+}
+
+static void SIMDEV_SpiReadDone(SIM_Model *p_model, uint32_t offset)
+{
+	SIMDEV_Spi *p_spi = (SIMDEV_Spi *)p_model;
+	uint32_t i;
+
+	if (SIMDEV_AT(offset, SPI_tag, POPR) && (p_spi->rxCount != 0))
+	{
+		for (i = 1; i < p_spi->rxCount; i++)
+		{
+			p_spi->rx[i - 1] = p_spi->rx[i];
+		}
+		p_spi->rxCount--;
+		SIMDEV_SpiStatus(p_spi);
+	}
+}
+
+static void SIMDEV_SpiWrite(SIM_Model *p_model, uint32_t offset, uint32_t old, uint32_t value)
+{
+	SIMDEV_Spi *p_spi = (SIMDEV_Spi *)p_model;
+	volatile struct SPI_tag *p_regs = p_spi->p_regs;
+
+	if (SIMDEV_AT(offset, SPI_tag, PUSHR))
+	{
+		if (p_spi->txCount < SIMDEV_SpiDepth(p_regs->MCR.B.DIS_TXF))
+		{
+			p_spi->tx[p_spi->txCount++] = value;
+		}
+		else
+		{
+			SIMDEVstats.spiOverruns++;						//TX FIFO full, command lost
+		}
+	}
+	else if (SIMDEV_AT(offset, SPI_tag, SR))
+	{
+		p_regs->SR.R = old & ~(value & spiSrW1C);			//w1c
+		if (p_spi->rxCount != 0)
+		{
+			p_regs->SR.B.RFDF = 1;							//set again while the RX FIFO is not empty
+		}
+	}
+	else if (SIMDEV_AT(offset, SPI_tag, MCR))
+	{
+		if (p_regs->MCR.B.CLR_TXF != 0)
+		{
+			p_spi->txCount = 0;
+			p_regs->MCR.B.CLR_TXF = 0;						//self clearing
+		}
+		if (p_regs->MCR.B.CLR_RXF != 0)
+		{
+			p_spi->rxCount = 0;
+			p_regs->MCR.B.CLR_RXF = 0;
+		}
+	}
+	SIMDEV_SpiStatus(p_spi);
+	SIMDEV_SpiStart(p_spi);
+}
+
+/*==================================================================================================
+*   SIUL2: pad inputs and external interrupts
+==================================================================================================*/
+
+static void SIMDEV_SiulUpdate(void)
+{
+	uint32_t pending = SIUL2.DISR0.R & SIUL2.DIRER0.R & ~SIUL2.DIRSR0.R;
+	uint32_t group;
+
+	for (group = 0; group < 4; group++)
+	{
+		SIM_Request(SIMDEV_SIUL_VECTOR + group, ((pending >> (8 * group)) & 0xFF) != 0);
+	}
+}
+
+static void SIMDEV_SiulRead(SIM_Model *p_model, uint32_t offset)
+{
+	uint32_t first = offsetof(struct SIUL2_tag, GPDI);
+	uint32_t pad;
+	uint32_t i;
+
+	(void)p_model;
+	if (!SIMDEV_IN(offset, SIUL2_tag, GPDI))
+	{
+		return;
+	}
+	for (i = 0; i < 4; i++)									//Bytes of the word read
+	{
+		pad = (offset & ~3u) + i - first;
+		if (((offset & ~3u) + i >= first) && (pad < SIMDEV_PADS))
+		{
+			SIUL2.GPDI[pad].R = (siulDriven[pad] != 0) ? siulLevel[pad] : SIUL2.GPDO[pad].R;
+		}
+	}
+}
+
+static void SIMDEV_SiulWrite(SIM_Model *p_model, uint32_t offset, uint32_t old, uint32_t value)
+{
+	(void)p_model;
+	if (SIMDEV_AT(offset, SIUL2_tag, DISR0))
+	{
+		SIUL2.DISR0.R = old & ~value;						//w1c
+	}
+	SIMDEV_SiulUpdate();
+}
+
+/***************************************************************************//*!
+*   @brief Edge on an external interrupt input (EIRQ).
+*	@param[in] eirq - EIRQ number (0 - 31).
+*	@param[in] rising - 1 - rising edge, 0 - falling edge.
+*	@remarks 	The flag is set if the edge is enabled (IREER0/IFEER0), the
+*				interrupt is requested if enabled in DIRER0.
+********************************************************************************/
+void SIMDEV_ExtIrq(uint32_t eirq, uint32_t rising)
+{
+	uint32_t bit = 1u << (eirq & 31);
+	uint32_t enabled;
+
+	SIM_Open();
+	enabled = (rising != 0) ? SIUL2.IREER0.R : SIUL2.IFEER0.R;
+	if ((enabled & bit) != 0)
+	{
+		SIUL2.DISR0.R = SIUL2.DISR0.R | bit;
+		SIMDEVstats.extIrqs++;
+		SIMDEV_SiulUpdate();
+	}
+	SIM_Close();
+}
+
+/***************************************************************************//*!
+*   @brief Drives the input level of a pad (GPDI), instead of its output.
+********************************************************************************/
+void SIMDEV_SetPad(uint32_t pad, uint32_t level)
+{
+	if (pad < SIMDEV_PADS)
+	{
+		siulDriven[pad] = 1;
+		siulLevel[pad] = (level != 0) ? 1 : 0;
+	}
+}
+
+/*==================================================================================================
+*   LINFlexD: UART mode
+==================================================================================================*/
+
+static uint64_t SIMDEV_UartBit(SIMDEV_Uart *p_uart)
+{
+	uint32_t divider = 16 * p_uart->p_regs->LINIBRR.B.IBR + p_uart->p_regs->LINFBRR.B.FBR;
+
+	return SIMDEV_TICKS((divider != 0) ? divider : 16, CLOCK_HALFSYS_HZ);
+}
+
+static uint32_t SIMDEV_UartFrameBits(SIMDEV_Uart *p_uart)
+{
+	volatile struct LINFlexD_tag *p_regs = p_uart->p_regs;
+
+	return 1 + ((p_regs->UARTCR.B.WL0 != 0) ? 8 : 7) + p_regs->UARTCR.B.PCE + 1;	//start, data, parity, stop
+}
+
+static void SIMDEV_UartUpdate(SIMDEV_Uart *p_uart)
+{
+	volatile struct LINFlexD_tag *p_regs = p_uart->p_regs;
+	uint32_t vector = SIMDEV_LINFLEX_VECTOR + 4 * p_uart->number;
+	uint64_t next = p_uart->txDue;
+
+	if (p_uart->rxDue < next)
+	{
+		next = p_uart->rxDue;
+	}
+	if (p_uart->timeoutDue < next)
+	{
+		next = p_uart->timeoutDue;
+	}
+	SIM_Wake(&p_uart->model, next);
+
+	SIM_Request(vector, (p_regs->UARTSR.B.DRFRFE & p_regs->LINIER.B.DRIE) |
+						(p_regs->UARTSR.B.TO & p_regs->LINIER.B.DBEIETOIE));
+	SIM_Request(vector + 1, p_regs->UARTSR.B.DTFTFF & p_regs->LINIER.B.DTIE);
+	SIM_Request(vector + 2, (p_regs->UARTSR.B.BOF & p_regs->LINIER.B.BOIE) |
+							(p_regs->UARTSR.B.FEF & p_regs->LINIER.B.FEIE));
+}
+
+static void SIMDEV_UartRelease(SIMDEV_Uart *p_uart)
+{
+	p_uart->rdc = 0;
+	p_uart->p_regs->LINSR.B.RDC = 0;
+	p_uart->p_regs->BDRM.R = 0;
+}
+
+static void SIMDEV_UartStep(SIM_Model *p_model, uint64_t now)
+{
+	SIMDEV_Uart *p_uart = (SIMDEV_Uart *)p_model;
+	volatile struct LINFlexD_tag *p_regs = p_uart->p_regs;
+	uint8_t data;
+	uint32_t i;
+
+	if (p_uart->txDue <= now)
+	{
+		for (i = 0; i < p_uart->txBytes; i++)
+		{
+			if (SIMDEV_UartSink != 0)
+			{
+				SIMDEV_UartSink(p_uart->number, (uint8_t)(p_uart->txWord >> (8 * i)));
+			}
+		}
+		SIMDEVstats.uartTxBytes += p_uart->txBytes;
+		p_uart->txDue = SIM_NEVER;
+		p_regs->UARTSR.B.DTFTFF = 1;
+	}
+
+	if (p_uart->rxDue <= now)
+	{
+		data = p_uart->line[p_uart->lineTail++ % SIMDEV_UART_LINE];
+		SIMDEVstats.uartRxBytes++;
+		if (p_regs->UARTSR.B.DRFRFE != 0)
+		{
+			p_regs->UARTSR.B.BOF = 1;						//buffer not released
+			SIMDEVstats.uartOverruns++;
+		}
+		else
+		{
+			p_regs->BDRM.R = p_regs->BDRM.R | ((uint32_t)data << (8 * p_uart->rdc));
+			p_uart->rdc++;
+			p_regs->LINSR.B.RDC = p_uart->rdc;
+			if (p_uart->rdc >= (uint32_t)p_regs->UARTCR.B.RDFL_RFC + 1)
+			{
+				p_regs->UARTSR.B.DRFRFE = 1;
+				p_regs->UARTSR.B.RMB = 1;
+			}
+		}
+		p_uart->rxDue = (p_uart->lineTail != p_uart->lineHead) ?
+						now + SIMDEV_UartFrameBits(p_uart) * SIMDEV_UartBit(p_uart) : SIM_NEVER;
+		p_uart->timeoutDue = (p_regs->UARTPTO.B.PTO != 0) ?
+						now + p_regs->UARTPTO.B.PTO * SIMDEV_UartBit(p_uart) : SIM_NEVER;
+	}
+	else if (p_uart->timeoutDue <= now)
+	{
+		p_regs->UARTSR.B.TO = 1;							//idle line after the last Byte
+		p_uart->timeoutDue = SIM_NEVER;
+	}
+	SIMDEV_UartUpdate(p_uart);
+}
+
+static void SIMDEV_UartRead(SIM_Model *p_model, uint32_t offset)
+{
+	SIMDEV_Uart *p_uart = (SIMDEV_Uart *)p_model;
+	volatile struct LINFlexD_tag *p_regs = p_uart->p_regs;
+
+	if (SIMDEV_AT(offset, LINFlexD_tag, LINSR))
+	{
+		if (p_regs->LINCR1.B.INIT != 0)
+		{
+			p_regs->LINSR.B.LINS = 1;						//init
+		}
+		else
+		{
+			p_regs->LINSR.B.LINS = (p_regs->LINCR1.B.SLEEP != 0) ? 0 : 2;	//sleep / idle
+		}
+	}
+}
+
+static void SIMDEV_UartWrite(SIM_Model *p_model, uint32_t offset, uint32_t old, uint32_t value)
+{
+	SIMDEV_Uart *p_uart = (SIMDEV_Uart *)p_model;
+	volatile struct LINFlexD_tag *p_regs = p_uart->p_regs;
+	LINFlexD_UARTSR_tag release;
+
+	if (SIMDEV_AT(offset, LINFlexD_tag, BDRL))
+	{
+		if ((p_regs->UARTCR.B.UART != 0) && (p_regs->UARTCR.B.TxEn != 0) && (p_regs->LINCR1.B.INIT == 0))
+		{
+			p_uart->txWord = value;
+			p_uart->txBytes = p_regs->UARTCR.B.TDFL_TFC + 1;
+			p_uart->txDue = SIM_Now() + p_uart->txBytes * SIMDEV_UartFrameBits(p_uart) * SIMDEV_UartBit(p_uart);
+		}
+	}
+	else if (SIMDEV_AT(offset, LINFlexD_tag, UARTSR))
+	{
+		p_regs->UARTSR.R = old & ~value;					//w1c
+		release.R = 0;
+		release.B.RMB = 1;
+		release.B.DRFRFE = 1;
+		if ((value & release.R) != 0)
+		{
+			SIMDEV_UartRelease(p_uart);
+		}
+	}
+	SIMDEV_UartUpdate(p_uart);
+}
+
+/***************************************************************************//*!
+*   @brief Puts Bytes on the RX line of a LINFlexD module.
+*	@return Number of Bytes accepted (line queue of SIMDEV_UART_LINE Bytes).
+*	@remarks 	The Bytes are received one frame time apart, the idle timeout
+*				(UARTPTO) runs after the last one.
+********************************************************************************/
+uint32_t SIMDEV_UartReceive(uint32_t linflex, const uint8_t *p_data, uint32_t nbBytes)
+{
+	SIMDEV_Uart *p_uart = &uart[linflex & 1];
+	uint32_t accepted = 0;
+
+	SIM_Open();
+	while ((accepted < nbBytes) && ((p_uart->lineHead - p_uart->lineTail) < SIMDEV_UART_LINE))
+	{
+		p_uart->line[p_uart->lineHead++ % SIMDEV_UART_LINE] = p_data[accepted++];
+	}
+	if ((accepted != 0) && (p_uart->rxDue == SIM_NEVER))
+	{
+		p_uart->rxDue = SIM_Now() + SIMDEV_UartFrameBits(p_uart) * SIMDEV_UartBit(p_uart);
+		p_uart->timeoutDue = SIM_NEVER;
+		SIMDEV_UartUpdate(p_uart);
+	}
+	SIM_Close();
+	return accepted;
+}
+
+/*==================================================================================================
+*   FlexCAN: modes and transmission
+==================================================================================================*/
+
+static void SIMDEV_CanStart(SIMDEV_Can *p_can)
+{
+	volatile struct CAN_tag *p_regs = p_can->p_regs;
+	uint32_t buffer;
+	uint32_t tq;
+	uint32_t bits;
+
+	if ((p_can->current >= 0) || (p_can->pending == 0) ||
+		(p_regs->MCR.B.FRZACK != 0) || (p_regs->MCR.B.MDIS != 0))
+	{
+		return;
+	}
+	buffer = (uint32_t)__builtin_ctzll(p_can->pending);
+	p_can->current = (int32_t)buffer;
+
+	tq = 1 + (p_regs->CTRL1.B.PROPSEG + 1) + (p_regs->CTRL1.B.PSEG1 + 1) + (p_regs->CTRL1.B.PSEG2 + 1);
+	bits = ((p_regs->MB[buffer].CS.B.IDE != 0) ? 67 : 47) + 8 * p_regs->MB[buffer].CS.B.DLC + 3;	//frame and intermission
+	SIM_Wake(&p_can->model, SIM_Now() + SIMDEV_TICKS((uint64_t)bits * tq * (p_regs->CTRL1.B.PRESDIV + 1), CLOCK_CAN_HZ));
+}
+
+static void SIMDEV_CanStep(SIM_Model *p_model, uint64_t now)
+{
+	SIMDEV_Can *p_can = (SIMDEV_Can *)p_model;
+	volatile struct CAN_tag *p_regs = p_can->p_regs;
+	uint32_t buffer = (uint32_t)p_can->current;
+
+	(void)now;
+	if (p_can->current < 0)
+	{
+		return;
+	}
+	if (SIMDEV_CanSink != 0)
+	{
+		SIMDEV_CanSink(p_can->number, buffer, p_regs->MB[buffer].ID.R,
+					   p_regs->MB[buffer].DATA.W[0], p_regs->MB[buffer].DATA.W[1]);
+	}
+	p_regs->MB[buffer].CS.B.CODE = SIMDEV_CAN_TX_INACTIVE;
+	if (buffer < 32)
+	{
+		p_regs->IFLAG1.R = p_regs->IFLAG1.R | (1u << buffer);
+	}
+	else
+	{
+		p_regs->IFLAG2.R = p_regs->IFLAG2.R | (1u << (buffer - 32));
+	}
+	SIMDEVstats.canFrames++;
+	p_can->pending &= ~(1ULL << buffer);
+	p_can->current = -1;
+	SIMDEV_CanStart(p_can);
+}
+
+static void SIMDEV_CanWrite(SIM_Model *p_model, uint32_t offset, uint32_t old, uint32_t value)
+{
+	SIMDEV_Can *p_can = (SIMDEV_Can *)p_model;
+	volatile struct CAN_tag *p_regs = p_can->p_regs;
+	uint32_t buffer;
+
+	if (SIMDEV_AT(offset, CAN_tag, MCR))
+	{
+		//acknowledge bits follow the requests (read-only for the software)
+		p_regs->MCR.B.LPMACK = p_regs->MCR.B.MDIS;
+		p_regs->MCR.B.FRZACK = p_regs->MCR.B.FRZ & p_regs->MCR.B.HALT & !p_regs->MCR.B.MDIS;
+		p_regs->MCR.B.NOTRDY = p_regs->MCR.B.MDIS | p_regs->MCR.B.FRZACK;
+	}
+	else if (SIMDEV_AT(offset, CAN_tag, IFLAG1) || SIMDEV_AT(offset, CAN_tag, IFLAG2))
+	{
+		*(volatile uint32_t *)((uintptr_t)p_regs + (offset & ~3u)) = __builtin_bswap32(old & ~value);	//w1c
+	}
+	else if (SIMDEV_AT(offset, CAN_tag, ESR1))
+	{
+		p_regs->ESR1.R = old & ~(value & canEsr1W1C);
+	}
+	else if (SIMDEV_IN(offset, CAN_tag, MB) &&
+			 (((offset - offsetof(struct CAN_tag, MB)) % sizeof(CAN_MB_tag)) < sizeof(CAN_MB_CS_tag)))
+	{
+		buffer = (offset - offsetof(struct CAN_tag, MB)) / sizeof(CAN_MB_tag);
+		if (p_regs->MB[buffer].CS.B.CODE == SIMDEV_CAN_TX_DATA)
+		{
+			p_can->pending |= 1ULL << buffer;
+		}
+		else if ((int32_t)buffer != p_can->current)
+		{
+			p_can->pending &= ~(1ULL << buffer);			//buffer rewritten before transmission
+		}
+	}
+	SIMDEV_CanStart(p_can);
+}
+
+/*==================================================================================================
+*   Registration and reset
+==================================================================================================*/
+
+static void SIMDEV_Add(SIM_Model *p_model, const char *name, uintptr_t base, uint32_t size,
+		void (*read)(SIM_Model *, uint32_t), void (*readDone)(SIM_Model *, uint32_t),
+		void (*write)(SIM_Model *, uint32_t, uint32_t, uint32_t), void (*step)(SIM_Model *, uint64_t))
+{
+	p_model->name = name;
+	p_model->base = base;
+	p_model->size = size;
+	p_model->read = read;
+	p_model->readDone = readDone;
+	p_model->write = write;
+	p_model->step = step;
+	p_model->due = SIM_NEVER;
+	SIM_AddModel(p_model);
+}
+
+/***************************************************************************//*!
+*   @brief Sets the reset values used by the drivers and clears the state of
+*			the models.
+*	@remarks 	Called by SIMDEV_Init and after a power-on reset of the MCU
+*				(SIM_END_RESET, registers cleared by SIM_Run). The pads driven
+*				from outside (SIMDEV_SetPad) keep their level.
+********************************************************************************/
+void SIMDEV_Reset(void)
+{
+	uint32_t i;
+
+	meTarget = 0;
+	meKey = 0;
+	memset(pitChannel, 0, sizeof(pitChannel));
+
+	SIM_Open();
+	meModel.due = SIM_NEVER;
+	MC_ME.GS.B.S_CURRENT_MODE = 3;							//DRUN after reset
+	MC_ME.GS.B.S_IRC = 1;
+	fccuModel.due = SIM_NEVER;
+	pitModel.due = SIM_NEVER;
+	PIT_0.MCR.B.MDIS = 1;
+	for (i = 0; i < 4; i++)
+	{
+		memset(&spi[i].tx, 0, sizeof(SIMDEV_Spi) - offsetof(SIMDEV_Spi, tx));
+		spi[i].model.due = SIM_NEVER;
+		spi[i].p_regs->MCR.B.MDIS = 1;
+		spi[i].p_regs->MCR.B.HALT = 1;
+		SIMDEV_SpiStatus(&spi[i]);
+
+		memset(&adc[i].chain, 0, sizeof(SIMDEV_Adc) - offsetof(SIMDEV_Adc, chain));
+		adc[i].model.due = SIM_NEVER;
+		adc[i].p_regs->MCR.B.PWDN = 1;
+	}
+	for (i = 0; i < 2; i++)
+	{
+		memset(&uart[i].txWord, 0, sizeof(SIMDEV_Uart) - offsetof(SIMDEV_Uart, txWord));
+		uart[i].txDue = SIM_NEVER;
+		uart[i].rxDue = SIM_NEVER;
+		uart[i].timeoutDue = SIM_NEVER;
+		uart[i].model.due = SIM_NEVER;
+		uart[i].p_regs->LINCR1.B.SLEEP = 1;
+	}
+	for (i = 0; i < 3; i++)
+	{
+		can[i].pending = 0;
+		can[i].current = -1;
+		can[i].model.due = SIM_NEVER;
+		can[i].p_regs->MCR.B.MDIS = 1;
+		can[i].p_regs->MCR.B.FRZ = 1;
+		can[i].p_regs->MCR.B.HALT = 1;
+		can[i].p_regs->MCR.B.LPMACK = 1;
+		can[i].p_regs->MCR.B.NOTRDY = 1;
+	}
+	SIM_Close();
+}
+
+/***************************************************************************//*!
+*   @brief Registers the peripheral models and sets the reset values used by
+*			the drivers.
+*	@remarks 	Called once after SIM_Init.
+********************************************************************************/
+void SIMDEV_Init(void)
+{
+	static const char *spiName[4] = {"SPI_0", "SPI_1", "SPI_2", "SPI_3"};
+	static const char *adcName[4] = {"ADC_0", "ADC_1", "ADC_2", "ADC_3"};
+	static const char *uartName[2] = {"LINFlexD_0", "LINFlexD_1"};
+	static const char *canName[3] = {"CAN_0", "CAN_1", "CAN_2"};
+	volatile struct SPI_tag *spiBase[4] = {&SPI_0, &SPI_1, &SPI_2, &SPI_3};
+	volatile struct ADC_tag *adcBase[4] = {&ADC_0, &ADC_1, &ADC_2, &ADC_3};
+	volatile struct LINFlexD_tag *uartBase[2] = {&LINFlexD_0, &LINFlexD_1};
+	volatile struct CAN_tag *canBase[3] = {&CAN_0, &CAN_1, &CAN_2};
+	SPI_SR_tag spiSr;
+	CAN_ESR1_tag canEsr1;
+	uint32_t i;
+
+	memset(&SIMDEVstats, 0, sizeof(SIMDEVstats));
+	spiSr.R = 0;
+	spiSr.B.TCF = 1;
+	spiSr.B.EOQF = 1;
+	spiSr.B.TFUF = 1;
+	spiSr.B.TFFF = 1;
+	spiSr.B.RFOF = 1;
+	spiSr.B.RFDF = 1;
+	spiSrW1C = spiSr.R;
+	canEsr1.R = 0;
+	canEsr1.B.ERRINT = 1;
+	canEsr1.B.BOFFINT = 1;
+	canEsr1.B.TWRNINT = 1;
+	canEsr1.B.RWRNINT = 1;
+	canEsr1W1C = canEsr1.R;
+
+	SIMDEV_Add(&meModel, "MC_ME", (uintptr_t)&MC_ME, sizeof(struct MC_ME_tag), 0, 0, SIMDEV_MeWrite, SIMDEV_MeStep);
+	SIMDEV_Add(&fccuModel, "FCCU", (uintptr_t)&FCCU, sizeof(struct FCCU_tag), 0, 0, SIMDEV_FccuWrite, SIMDEV_FccuStep);
+	SIMDEV_Add(&pitModel, "PIT_0", (uintptr_t)&PIT_0, sizeof(struct PIT_tag), SIMDEV_PitRead, 0, SIMDEV_PitWrite, SIMDEV_PitStep);
+	SIMDEV_Add(&siulModel, "SIUL2", (uintptr_t)&SIUL2, sizeof(struct SIUL2_tag), SIMDEV_SiulRead, 0, SIMDEV_SiulWrite, 0);
+	for (i = 0; i < 4; i++)
+	{
+		spi[i].p_regs = spiBase[i];
+		spi[i].number = i;
+		SIMDEV_Add(&spi[i].model, spiName[i], (uintptr_t)spiBase[i], sizeof(struct SPI_tag),
+				   SIMDEV_SpiRead, SIMDEV_SpiReadDone, SIMDEV_SpiWrite, SIMDEV_SpiStep);
+		adc[i].p_regs = adcBase[i];
+		adc[i].number = i;
+		SIMDEV_Add(&adc[i].model, adcName[i], (uintptr_t)adcBase[i], sizeof(struct ADC_tag),
+				   0, SIMDEV_AdcReadDone, SIMDEV_AdcWrite, SIMDEV_AdcStep);
+	}
+	for (i = 0; i < 2; i++)
+	{
+		uart[i].p_regs = uartBase[i];
+		uart[i].number = i;
+		SIMDEV_Add(&uart[i].model, uartName[i], (uintptr_t)uartBase[i], sizeof(struct LINFlexD_tag),
+				   SIMDEV_UartRead, 0, SIMDEV_UartWrite, SIMDEV_UartStep);
+	}
+	for (i = 0; i < 3; i++)
+	{
+		can[i].p_regs = canBase[i];
+		can[i].number = i;
+		SIMDEV_Add(&can[i].model, canName[i], (uintptr_t)canBase[i], sizeof(struct CAN_tag),
+				   0, 0, SIMDEV_CanWrite, SIMDEV_CanStep);
+	}
+	SIMDEV_Reset();
+}
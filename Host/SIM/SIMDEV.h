@@ -0,0 +1,89 @@
+/*******************************************************************************
+*
+* $File Name:       SIMDEV.h$
+* @file             SIMDEV.h
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Peripheral models of the register window simulator
+* @brief            Peripheral models of the register window simulator
+*
+*   Behavior of the blocks used by the drivers of src/Modules:
+*     MC_ME      - mode transition (S_MTRANS, S_CURRENT_MODE, clocks)
+*     FCCU       - CTRL operations (OPS)
+*     PIT_0      - 4 channels, TIF and interrupt (vectors 226 - 229), CVAL
+*     ADC_0 - 3  - normal chain of NCMR0, CDR, EOC/ECH and interrupt (496 + 4 x n)
+*     SPI_0 - 3  - master transfers timed by CTAR, TX/RX FIFOs, SR flags
+*     SIUL2      - GPDI of the outputs, EIRQ edges (vectors 243 - 246)
+*     LINFlexD   - UART mode transmission and reception (376 + 4 x n)
+*     CAN_0 - 2  - freeze/disable acknowledge, transmission of the TX buffers
+*   The slave devices are given by the hooks below. The other blocks
+*   (AIPS, MC_CGM, PLLDIG, XOSC, MC_RGM, ...) are plain memory.
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Tool created
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#ifndef _SIMDEV_H_
+#define _SIMDEV_H_
+
+#include <stdint.h>
+
+/*==================================================================================================
+*   Configurable parameters
+==================================================================================================*/
+
+#define SIMDEV_ME_TRANSITION_US		10		///mode transition (XOSC, PLL lock)
+#define SIMDEV_FCCU_OPERATION_US	1		///FCCU operation
+#define SIMDEV_ADC_DEFAULT			2048	///conversion result without input hook (mid scale)
+
+/*==================================================================================================
+*   Structures/Type defines
+==================================================================================================*/
+
+typedef struct {
+	uint32_t	spiFrames;				///DSPI frames transferred (all modules)
+	uint32_t	spiOverruns;			///DSPI words lost (TX FIFO full, RX FIFO overflow)
+	uint64_t	spiTicks;				///DSPI bus time (frames and delays) [core ticks]
+	uint32_t	adcConversions;
+	uint32_t	pitExpiries[4];
+	uint32_t	uartTxBytes;
+	uint32_t	uartRxBytes;
+	uint32_t	uartOverruns;			///received Bytes lost (buffer not released)
+	uint32_t	canFrames;
+	uint32_t	extIrqs;				///EIRQ edges latched in DISR0
+} SIMDEV_Stats;
+
+extern SIMDEV_Stats SIMDEVstats;
+
+//Hooks of the harness (0 - default behavior)
+extern uint32_t (*SIMDEV_SpiSlave)(uint32_t dspi, uint32_t pcs, uint32_t tx);	///answer of the slave, default 0
+extern uint32_t (*SIMDEV_AdcInput)(uint32_t adc, uint32_t channel);			///conversion result, default SIMDEV_ADC_DEFAULT
+extern void (*SIMDEV_UartSink)(uint32_t linflex, uint8_t data);				///transmitted Byte
+extern void (*SIMDEV_CanSink)(uint32_t module, uint32_t buffer, uint32_t id, uint32_t dataHigh, uint32_t dataLow);
+
+/*==================================================================================================
+*   Function prototypes
+==================================================================================================*/
+
+void SIMDEV_Init(void);
+void SIMDEV_Reset(void);
+void SIMDEV_ExtIrq(uint32_t eirq, uint32_t rising);
+void SIMDEV_SetPad(uint32_t pad, uint32_t level);
+uint32_t SIMDEV_UartReceive(uint32_t linflex, const uint8_t *p_data, uint32_t nbBytes);
+void SIMDEV_AdcTrigger(uint32_t number);
+void SIMDEV_PitFire(uint32_t channel);
+
+#endif
@@ -0,0 +1,1021 @@
+/*******************************************************************************
+*
+* $File Name:       SIMFS65.c$
+* @file             SIMFS65.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      FS65xx (PwSBC) SPI device model of the register window simulator
+* @brief            FS65xx (PwSBC) SPI device model of the register window simulator
+*
+*   Register layouts are the ones of include/FS65xx.h (Rx structures), the
+*   data Byte is modelled, the status Byte is built for every frame. The
+*   model is a behavioral one: it follows the datasheet where the driver
+*   depends on it and keeps the rest plain (no analog supervision, LDT or
+*   CAN/LIN transceiver state).
+*   The battery is connected by SIMFS65_Init (BAT_FAIL set), the wake-up
+*   from LPOFF powers the model up again without BAT_FAIL and brings Vcore
+*   back (SIMFS65_VcoreOn: power-on reset of the MCU). The keep-alive RAM
+*   of the firmware stays supplied.
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Tool created
+BRNY001					      19/10/2026 	   SIMFS65_Step	  LPOFF wake-up without BAT_FAIL, Vcore back (SIMFS65_VcoreOn)
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#include <string.h>
+#include "MPC5744P_drv.h"
+#include "FS65xx.h"
+#include "FS65xx_driver.h"
+#include "SIM.h"
+#include "SIMDEV.h"
+#include "SIMFS65.h"
+
+/*==================================================================================================
+*   Local defines
+==================================================================================================*/
+
+#define SIMFS65_TICKS_US(us)	((uint64_t)(us) * (CLOCK_SYS_HZ / 1000000))
+#define SIMFS65_TICKS_NS(ns)	((uint64_t)(ns) * (CLOCK_SYS_HZ / 1000000) / 1000)
+#define SIMFS65_INJECTIONS		32				///pending SIMFS65_InjectAt
+#define SIMFS65_FLT_ERR_MAX		6
+
+//General status Byte
+#define SIMFS65_SPI_G			0x80
+#define SIMFS65_WU				0x40
+#define SIMFS65_CAN_G			0x20
+#define SIMFS65_LIN_G			0x10
+#define SIMFS65_IO_G			0x08
+#define SIMFS65_VPRE_G			0x04
+#define SIMFS65_VCORE_G			0x02
+#define SIMFS65_VOTHERS_G		0x01
+
+//DIAG_SPI and the SPI_FS nibble of the fail-safe registers (shifted by 4)
+#define SIMFS65_SPI_ERR			0x80
+#define SIMFS65_SPI_CLK			0x20
+#define SIMFS65_SPI_REQ			0x08
+#define SIMFS65_SPI_PARITY		0x02
+#define SIMFS65_SPI_FS_ERR		0x08
+#define SIMFS65_SPI_FS_CLK		0x04
+#define SIMFS65_SPI_FS_REQ		0x02
+#define SIMFS65_SPI_FS_PARITY	0x01
+
+//INIT_INT
+#define SIMFS65_INT_DURATION	0x80
+#define SIMFS65_INH_LIN			0x40
+#define SIMFS65_INH_ALL			0x20
+#define SIMFS65_INH_VPRE		0x08
+#define SIMFS65_INH_VCORE		0x04
+#define SIMFS65_INH_VOTHERS		0x02
+#define SIMFS65_INH_CAN			0x01
+
+//MODE (Tx and Rx)
+#define SIMFS65_VKAM_EN			0x80
+#define SIMFS65_LP_OFF_AUTO_WU	0x40
+#define SIMFS65_GO_LPOFF		0x20
+#define SIMFS65_INT_REQ			0x10
+#define SIMFS65_MODE_INIT		0x08
+#define SIMFS65_MODE_NORMAL		0x04
+
+//BIST
+#define SIMFS65_ABIST2_FS1B		0x40
+#define SIMFS65_ABIST2_VAUX		0x20
+#define SIMFS65_LBIST_OK		0x08
+#define SIMFS65_ABIST2_FS1B_OK	0x04
+#define SIMFS65_ABIST2_VAUX_OK	0x02
+#define SIMFS65_ABIST1_OK		0x01
+
+//WD_ANSWER (Rx)
+#define SIMFS65_WD_RSTB			0x80
+#define SIMFS65_WD_FSXB			0x40
+#define SIMFS65_WD_BAD_DATA		0x20
+#define SIMFS65_WD_BAD_TIMING	0x04
+
+//SF_OUTPUT_REQUEST (Tx)
+#define SIMFS65_FS1B_LOW_REQ	0x80
+#define SIMFS65_FS0B_LOW_REQ	0x20
+#define SIMFS65_RSTB_REQ		0x10
+
+//Register classes
+#define SIMFS65_REG_NONE		0				///unknown address
+#define SIMFS65_REG_INIT_MAIN	1				///writable in INIT main
+#define SIMFS65_REG_MAIN		2				///writable in normal mode
+#define SIMFS65_REG_READ		3				///read only
+#define SIMFS65_REG_INIT_FS		4				///secured, writable in INIT_FS, SPI_FS nibble
+#define SIMFS65_REG_FS			5				///writable in normal mode, SPI_FS nibble
+#define SIMFS65_REG_FS_READ		6				///read only (fail-safe)
+#define SIMFS65_SECURED			0x80			///class flag: security bits checked
+
+/*==================================================================================================
+*   Global variables
+==================================================================================================*/
+
+SIMFS65_Config SIMFS65config = {
+	DSPI_NB, DSPI_CS, 0, 0,
+	SIMFS65_FS_WRITE_GAP_NS, SIMFS65_FRAME_GAP_NS, SIMFS65_INIT_FS_US, SIMFS65_ABIST2_US, SIMFS65_LPOFF_WAKE_US,
+	SIMFS65_DEVICE_ID, SIMFS65_DEVICE_ID_FS, SIMFS65_HW_CONFIG
+};
+SIMFS65_Stats SIMFS65stats;
+void (*SIMFS65_VcoreOn)(void);
+
+/*==================================================================================================
+*   Local variables
+==================================================================================================*/
+
+static const uint8_t regClass[64] = {
+	[INIT_VREG_ADR] = SIMFS65_REG_INIT_MAIN,
+	[INIT_WU1_ADR] = SIMFS65_REG_INIT_MAIN,
+	[INIT_WU2_ADR] = SIMFS65_REG_INIT_MAIN,
+	[INIT_INT_ADR] = SIMFS65_REG_INIT_MAIN,
+	[INIT_INH_INT_ADR] = SIMFS65_REG_INIT_MAIN,
+	[LONG_DURATION_TIMER_ADR] = SIMFS65_REG_MAIN,
+	[HW_CONFIG_ADR] = SIMFS65_REG_READ,
+	[WU_SOURCE_ADR] = SIMFS65_REG_READ,
+	[DEVICE_ID_ADR] = SIMFS65_REG_READ,
+	[IO_INPUT_ADR] = SIMFS65_REG_READ,
+	[DIAG_VPRE_ADR] = SIMFS65_REG_READ,
+	[DIAG_VCORE_ADR] = SIMFS65_REG_READ,
+	[DIAG_VCCA_ADR] = SIMFS65_REG_READ,
+	[DIAG_VAUX_ADR] = SIMFS65_REG_READ,
+	[DIAG_VSUP_VCAN_ADR] = SIMFS65_REG_READ,
+	[DIAG_CAN_FD_ADR] = SIMFS65_REG_READ,
+	[DIAG_CAN_LIN_ADR] = SIMFS65_REG_READ,
+	[DIAG_SPI_ADR] = SIMFS65_REG_READ,
+	[MODE_ADR] = SIMFS65_REG_MAIN | SIMFS65_SECURED,
+	[REG_MODE_ADR] = SIMFS65_REG_MAIN | SIMFS65_SECURED,
+	[IO_OUT_AMUX_ADR] = SIMFS65_REG_MAIN,
+	[CAN_LIN_MODE_ADR] = SIMFS65_REG_MAIN,
+	[LDT_AFTER_RUN_1_ADR] = SIMFS65_REG_MAIN,
+	[LDT_AFTER_RUN_2_ADR] = SIMFS65_REG_MAIN,
+	[LDT_WAKE_UP_1_ADR] = SIMFS65_REG_MAIN,
+	[LDT_WAKE_UP_2_ADR] = SIMFS65_REG_MAIN,
+	[LDT_WAKE_UP_3_ADR] = SIMFS65_REG_MAIN,
+	[INIT_FS1B_TIMING_ADR] = SIMFS65_REG_INIT_FS | SIMFS65_SECURED,
+	[BIST_ADR] = SIMFS65_REG_FS | SIMFS65_SECURED,
+	[INIT_SUPERVISOR_ADR] = SIMFS65_REG_INIT_FS | SIMFS65_SECURED,
+	[INIT_FAULT_ADR] = SIMFS65_REG_INIT_FS | SIMFS65_SECURED,
+	[INIT_FSSM_ADR] = SIMFS65_REG_INIT_FS | SIMFS65_SECURED,
+	[INIT_SF_IMPACT_ADR] = SIMFS65_REG_INIT_FS | SIMFS65_SECURED,
+	[WD_WINDOW_ADR] = SIMFS65_REG_FS | SIMFS65_SECURED,
+	[WD_LFSR_ADR] = SIMFS65_REG_FS,
+	[WD_ANSWER_ADR] = SIMFS65_REG_FS,
+	[RELEASE_FSxB_ADR] = SIMFS65_REG_FS,
+	[SF_OUTPUT_REQUEST_ADR] = SIMFS65_REG_FS | SIMFS65_SECURED,
+	[INIT_WD_CNT_ADR] = SIMFS65_REG_INIT_FS | SIMFS65_SECURED,
+	[DIAG_SF_IOS_ADR] = SIMFS65_REG_FS_READ,
+	[WD_COUNTER_ADR] = SIMFS65_REG_FS_READ,
+	[DIAG_SF_ERR_ADR] = SIMFS65_REG_FS_READ,
+	[INIT_VCORE_OVUV_IMPACT_ADR] = SIMFS65_REG_INIT_FS | SIMFS65_SECURED,
+	[INIT_VCCA_OVUV_IMPACT_ADR] = SIMFS65_REG_INIT_FS | SIMFS65_SECURED,
+	[INIT_VAUX_OVUV_IMPACT_ADR] = SIMFS65_REG_INIT_FS | SIMFS65_SECURED,
+	[DEVICE_ID_FS_ADR] = SIMFS65_REG_FS_READ,
+};
+
+static const uint16_t wdWindowMs[16] = {0, 1, 2, 3, 4, 6, 8, 12, 16, 24, 32, 64, 128, 256, 512, 1024};
+static const uint8_t wdErrLimit[4] = {6, 6, 4, 2};		///INIT_WD_CNT[WD_CNT_ERR]
+static const uint8_t wdRfrLimit[4] = {6, 4, 2, 1};		///INIT_WD_CNT[WD_CNT_RFR]
+
+static const char *faultName[SIMFS65_FAULT_NB] = {"parity", "spi_clk", "no_answer", "vpre_uv", "vpre_ov",
+	"vcore_uv", "vcore_ov", "vcca_uv", "vcca_ov", "vaux_uv", "vaux_ov", "wd_data", "wd_timing", "can", "io"};
+
+static const uint8_t faultRegister[SIMFS65_FAULT_NB] = {DIAG_SPI_ADR, DIAG_SPI_ADR, DIAG_SPI_ADR,
+	DIAG_VPRE_ADR, DIAG_VPRE_ADR, DIAG_VCORE_ADR, DIAG_VCORE_ADR, DIAG_VCCA_ADR, DIAG_VCCA_ADR,
+	DIAG_VAUX_ADR, DIAG_VAUX_ADR, WD_COUNTER_ADR, WD_COUNTER_ADR, DIAG_CAN_FD_ADR, IO_INPUT_ADR};
+
+static uint32_t (*p_prevSlave)(uint32_t dspi, uint32_t pcs, uint32_t tx);
+static SIM_Model fs65Model;
+
+static uint8_t reg[64];					///stored data Byte (written part)
+static uint8_t diag[64];				///latched flags, clear on read
+static uint8_t spiFsFlags;				///SPI_FS nibble, clear on read of a fail-safe register
+static uint8_t batFail;
+static uint8_t initMain;				///INIT main phase (until INIT_INT is written)
+static uint8_t initFs;					///INIT_FS phase (until the first good WD refresh)
+static uint8_t lpoff;
+static uint8_t bist;
+static uint8_t bistRunning;			///ABIST2 requests of the BIST write
+static uint8_t lfsr;
+static uint8_t wdErr;
+static uint8_t wdRfr;
+static uint8_t fltErr;
+static uint8_t fsxbAsserted;
+static uint8_t ioLevel;
+static uint8_t intbLow;
+static uint8_t intbPending;
+static uint8_t armed[SIMFS65_FAULT_NB];		///one shot faults waiting for their frame
+static uint8_t intbWaiting[SIMFS65_FAULT_NB];	///faults without INTb yet
+
+static uint64_t wdStart;				///start of the current window
+static uint64_t wdEnd;					///end of the open window, SIM_NEVER - disabled
+static uint64_t initFsEnd;
+static uint64_t intbEnd;
+static uint64_t wakeAt;
+static uint64_t bistEnd;
+static uint64_t lastFsWrite;
+static uint64_t lastFrame;
+static uint64_t occurred[SIMFS65_FAULT_NB];	///time of the fault, SIM_NEVER - none pending
+
+static struct {
+	uint32_t	fault;
+	uint64_t	when;
+} injection[SIMFS65_INJECTIONS];
+static uint32_t injections;
+
+/*==================================================================================================
+*   Local functions
+==================================================================================================*/
+
+static void SIMFS65_Schedule(void)
+{
+	uint64_t due = SIM_NEVER;
+	uint32_t i;
+
+	if ((lpoff == 0) && (initFs == 0) && (wdEnd < due))
+	{
+		due = wdEnd;
+	}
+	if ((lpoff == 0) && (initFs != 0) && (initFsEnd < due))
+	{
+		due = initFsEnd;
+	}
+	if (intbEnd < due)
+	{
+		due = intbEnd;
+	}
+	if (wakeAt < due)
+	{
+		due = wakeAt;
+	}
+	if (bistEnd < due)
+	{
+		due = bistEnd;
+	}
+	for (i = 0; i < injections; i++)
+	{
+		if (injection[i].when < due)
+		{
+			due = injection[i].when;
+		}
+	}
+	SIM_Wake(&fs65Model, due);
+}
+
+static uint32_t SIMFS65_Status(void)
+{
+	uint32_t status = 0;
+
+	if (diag[DIAG_SPI_ADR] != 0)
+	{
+		status |= SIMFS65_SPI_G;
+	}
+	if (diag[WU_SOURCE_ADR] != 0)
+	{
+		status |= SIMFS65_WU;
+	}
+	if (diag[DIAG_CAN_FD_ADR] != 0)
+	{
+		status |= SIMFS65_CAN_G;
+	}
+	if (diag[DIAG_CAN_LIN_ADR] != 0)
+	{
+		status |= SIMFS65_LIN_G;
+	}
+	if (diag[IO_INPUT_ADR] != 0)
+	{
+		status |= SIMFS65_IO_G;
+	}
+	if (diag[DIAG_VPRE_ADR] != 0)
+	{
+		status |= SIMFS65_VPRE_G;
+	}
+	if (diag[DIAG_VCORE_ADR] != 0)
+	{
+		status |= SIMFS65_VCORE_G;
+	}
+	if ((diag[DIAG_VCCA_ADR] | diag[DIAG_VAUX_ADR] | diag[DIAG_VSUP_VCAN_ADR]) != 0)
+	{
+		status |= SIMFS65_VOTHERS_G;
+	}
+	return status;
+}
+
+/*
+*	Content of a register as read by the driver, without side effects.
+*/
+static uint32_t SIMFS65_Content(uint32_t address)
+{
+	uint32_t value;
+
+	switch (address)
+	{
+	case INIT_VREG_ADR:			return (reg[address] & 0xF2) | batFail;
+	case HW_CONFIG_ADR:			return SIMFS65config.hwConfig;
+	case DEVICE_ID_ADR:			return SIMFS65config.deviceId;
+	case DEVICE_ID_FS_ADR:		return SIMFS65config.deviceIdFs;
+	case IO_INPUT_ADR:			return ioLevel;
+	case MODE_ADR:
+		value = reg[address] & SIMFS65_VKAM_EN;
+		return value | ((initMain != 0) ? SIMFS65_MODE_INIT : SIMFS65_MODE_NORMAL) | lpoff;
+	case REG_MODE_ADR:			return reg[address] & 0x0F;
+	case IO_OUT_AMUX_ADR:		return reg[address] & 0xC7;
+	case CAN_LIN_MODE_ADR:		return reg[address] & 0xFC;
+	case BIST_ADR:				return ((uint32_t)spiFsFlags << 4) | bist;
+	case WD_LFSR_ADR:			return lfsr;
+	case WD_ANSWER_ADR:			return diag[address] | ((fsxbAsserted != 0) ? SIMFS65_WD_FSXB : 0);
+	case RELEASE_FSxB_ADR:		//RSTB_SNS high, FS0B/FS1B low while asserted
+		return ((uint32_t)spiFsFlags << 4) | ((fsxbAsserted != 0) ? 0x1 : 0x7);
+	case WD_COUNTER_ADR:		return ((uint32_t)((wdErr > 7) ? 7 : wdErr) << 5) | ((uint32_t)wdRfr << 1);
+	case DIAG_SF_ERR_ADR:		return (uint32_t)fltErr << 5;
+	case DIAG_SF_IOS_ADR:		return 0;
+	default:
+		break;
+	}
+	switch (regClass[address] & ~SIMFS65_SECURED)
+	{
+	case SIMFS65_REG_INIT_FS:
+	case SIMFS65_REG_FS:
+		return ((uint32_t)spiFsFlags << 4) | (reg[address] & 0x0F);
+	case SIMFS65_REG_READ:
+		return diag[address];
+	default:
+		return reg[address];
+	}
+}
+
+static void SIMFS65_Int(uint32_t inhibit)
+{
+	uint32_t i;
+
+	if ((inhibit != 0) && ((reg[INIT_INT_ADR] & (inhibit | SIMFS65_INH_ALL)) != 0))
+	{
+		SIMFS65stats.intInhibited++;
+		return;
+	}
+	if (intbLow != 0)
+	{
+		intbPending = 1;									//next pulse after the current one
+		return;
+	}
+	for (i = 0; i < SIMFS65_FAULT_NB; i++)
+	{
+		if (intbWaiting[i] != 0)
+		{
+			intbWaiting[i] = 0;
+			SIMFS65stats.reaction[i].intb++;
+			SIMFS65stats.reaction[i].intbTicks = SIM_Now() - occurred[i];
+		}
+	}
+	intbLow = 1;
+	intbEnd = SIM_Now() + SIMFS65_TICKS_US(((reg[INIT_INT_ADR] & SIMFS65_INT_DURATION) != 0) ? 25 : 100);
+	SIMDEV_SetPad(SIMFS65config.pad, 0);
+	SIMDEV_ExtIrq(SIMFS65config.eirq, 0);
+	SIMFS65stats.intPulses++;
+}
+
+static void SIMFS65_Occur(uint32_t fault, uint32_t intb)
+{
+	occurred[fault] = SIM_Now();
+	intbWaiting[fault] = (uint8_t)intb;
+	SIMFS65stats.reaction[fault].injected++;
+}
+
+/*
+*	SPI error: DIAG_SPI (SPI_G, INTb), and the SPI_FS nibble for the frames
+*	of the fail-safe registers.
+*/
+static void SIMFS65_SpiError(uint32_t address, uint32_t mainFlag, uint32_t fsFlag, uint32_t fault)
+{
+	if ((regClass[address] & ~SIMFS65_SECURED) >= SIMFS65_REG_INIT_FS)
+	{
+		spiFsFlags |= fsFlag;
+	}
+	diag[DIAG_SPI_ADR] |= mainFlag;
+	if (fault < SIMFS65_FAULT_NB)
+	{
+		SIMFS65_Occur(fault, 1);
+	}
+	SIMFS65_Int(0);
+}
+
+static void SIMFS65_WdStart(uint64_t now)
+{
+	uint32_t ms = wdWindowMs[reg[WD_WINDOW_ADR] & 0x0F];
+
+	wdStart = now;
+	wdEnd = (ms != 0) ? now + SIMFS65_TICKS_US(1000 * ms) : SIM_NEVER;
+}
+
+static void SIMFS65_Reset(void)
+{
+	SIMFS65stats.resets++;
+	diag[WD_ANSWER_ADR] |= SIMFS65_WD_RSTB;
+	initFs = 1;
+	initFsEnd = SIM_Now() + SIMFS65_TICKS_US(SIMFS65config.initFsUs);
+	wdErr = 0;
+	wdRfr = 0;
+	if (fltErr < SIMFS65_FLT_ERR_MAX)
+	{
+		fltErr++;
+	}
+	fsxbAsserted = 1;
+}
+
+static void SIMFS65_WdBad(uint32_t flag)
+{
+	diag[WD_ANSWER_ADR] |= flag;
+	wdRfr = 0;
+	wdErr += 2;
+	if (wdErr >= wdErrLimit[(reg[INIT_WD_CNT_ADR] >> 2) & 3])
+	{
+		SIMFS65_Reset();
+	}
+	else
+	{
+		SIMFS65_WdStart(SIM_Now());
+	}
+}
+
+static void SIMFS65_WdAnswer(uint32_t answer)
+{
+	uint64_t now = SIM_Now();
+	uint32_t closed = (wdEnd != SIM_NEVER) && (now < wdStart + (wdEnd - wdStart) / 2);
+	uint32_t feedback;
+
+	if (armed[SIMFS65_FAULT_WD_DATA] != 0)
+	{
+		armed[SIMFS65_FAULT_WD_DATA] = 0;
+		answer ^= 0x01;
+		SIMFS65_Occur(SIMFS65_FAULT_WD_DATA, 0);
+	}
+	if ((armed[SIMFS65_FAULT_WD_TIMING] != 0) && (initFs == 0))
+	{
+		armed[SIMFS65_FAULT_WD_TIMING] = 0;
+		closed = 1;
+		SIMFS65_Occur(SIMFS65_FAULT_WD_TIMING, 0);
+	}
+
+	if (answer != ((~(uint32_t)lfsr) & 0xFF))
+	{
+		SIMFS65stats.wdBadData++;
+		SIMFS65_WdBad(SIMFS65_WD_BAD_DATA);
+		return;
+	}
+	if ((initFs == 0) && (closed != 0))
+	{
+		SIMFS65stats.wdBadTiming++;
+		SIMFS65_WdBad(SIMFS65_WD_BAD_TIMING);
+		return;
+	}
+
+	SIMFS65stats.wdGood++;
+	if (wdEnd != SIM_NEVER)
+	{
+		SIMFS65stats.wdWindow = wdEnd - wdStart;
+	}
+	if (initFs != 0)
+	{
+		initFs = 0;
+		if (SIMFS65stats.initFsEnd == 0)
+		{
+			SIMFS65stats.initFsEnd = SIMFS65stats.frames;
+		}
+	}
+	feedback = ((lfsr >> 7) ^ (lfsr >> 5) ^ (lfsr >> 4) ^ (lfsr >> 3)) & 1;	//x^8 + x^6 + x^5 + x^4 + 1
+	lfsr = (uint8_t)((lfsr << 1) | feedback);
+	if (++wdRfr >= wdRfrLimit[reg[INIT_WD_CNT_ADR] & 3])
+	{
+		wdRfr = 0;
+		if (wdErr > 0)
+		{
+			wdErr--;
+		}
+		else if (fltErr > 0)
+		{
+			fltErr--;
+		}
+	}
+	SIMFS65_WdStart(now);
+}
+
+/*
+*	RELEASE_FSxB code: inverted LFSR bits b4..b0 taken in the order of p_bits.
+*/
+static uint32_t SIMFS65_ReleaseCode(const uint8_t *p_bits)
+{
+	uint32_t code = 0;
+	uint32_t i;
+
+	for (i = 0; i < 5; i++)
+	{
+		code = (code << 1) | ((~(uint32_t)lfsr >> p_bits[i]) & 1);
+	}
+	return code;
+}
+
+static void SIMFS65_Release(uint32_t value)
+{
+	static const uint8_t fs0b[5] = {0, 1, 2, 3, 4};
+	static const uint8_t fs1b[5] = {3, 4, 5, 6, 7};
+	static const uint8_t both[5] = {0, 1, 2, 6, 7};
+	uint32_t expected;
+
+	switch (value & 0xE0)
+	{
+	case 0x60:	expected = SIMFS65_ReleaseCode(fs0b); break;
+	case 0xC0:	expected = SIMFS65_ReleaseCode(fs1b); break;
+	case 0xA0:	expected = SIMFS65_ReleaseCode(both); break;
+	default:	expected = 0x100; break;
+	}
+	if (((value & 0x1F) == expected) && (fltErr == 0))
+	{
+		fsxbAsserted = 0;
+		SIMFS65stats.releases++;
+	}
+	else
+	{
+		SIMFS65stats.releaseErrors++;
+	}
+}
+
+/*
+*	battery: 1 - battery connected (BAT_FAIL), 0 - wake-up from LPOFF
+*/
+static void SIMFS65_PowerUp(uint32_t battery)
+{
+	memset(reg, 0, sizeof(reg));
+	memset(diag, 0, sizeof(diag));
+	reg[REG_MODE_ADR] = 0x0F;
+	spiFsFlags = 0;
+	batFail = (uint8_t)battery;
+	initMain = 1;
+	initFs = 1;
+	lpoff = 0;
+	bist = SIMFS65_LBIST_OK | SIMFS65_ABIST1_OK;
+	bistRunning = 0;
+	lfsr = 0xB2;
+	wdErr = 0;
+	wdRfr = 0;
+	fltErr = 1;
+	fsxbAsserted = 1;
+	wdEnd = SIM_NEVER;
+	initFsEnd = SIM_Now() + SIMFS65_TICKS_US(SIMFS65config.initFsUs);
+	bistEnd = SIM_NEVER;
+	wakeAt = SIM_NEVER;
+}
+
+static void SIMFS65_Write(uint32_t address, uint32_t value)
+{
+	uint32_t regClassW = regClass[address] & ~SIMFS65_SECURED;
+
+	switch (address)
+	{
+	case INIT_VREG_ADR:			reg[address] = (uint8_t)(value & 0xF2); return;
+	case INIT_WU2_ADR:			reg[address] = (uint8_t)(value & 0xF7); return;
+	case INIT_INH_INT_ADR:		reg[address] = (uint8_t)(value & 0x1F); return;
+	case INIT_INT_ADR:
+		reg[address] = (uint8_t)value;
+		initMain = 0;
+		SIMFS65stats.initMainEnd = SIMFS65stats.frames;
+		return;
+	case MODE_ADR:
+		reg[address] = (uint8_t)(value & SIMFS65_VKAM_EN);
+		if ((value & SIMFS65_INT_REQ) != 0)
+		{
+			SIMFS65_Int(0);
+		}
+		if ((value & (SIMFS65_GO_LPOFF | SIMFS65_LP_OFF_AUTO_WU)) != 0)
+		{
+			lpoff = 1;
+			SIMFS65stats.lpoff++;
+			wakeAt = ((value & SIMFS65_LP_OFF_AUTO_WU) != 0)
+					 ? SIM_Now() + SIMFS65_TICKS_US(SIMFS65config.lpoffWakeUs) : SIM_NEVER;
+		}
+		return;
+	case REG_MODE_ADR:			reg[address] = (uint8_t)(value >> 4); return;
+	case BIST_ADR:
+		bistRunning |= (uint8_t)(value & (SIMFS65_ABIST2_FS1B | SIMFS65_ABIST2_VAUX));
+		if ((value & SIMFS65_ABIST2_FS1B) != 0)
+		{
+			bist &= ~SIMFS65_ABIST2_FS1B_OK;
+		}
+		if ((value & SIMFS65_ABIST2_VAUX) != 0)
+		{
+			bist &= ~SIMFS65_ABIST2_VAUX_OK;
+		}
+		bistEnd = SIM_Now() + SIMFS65_TICKS_US(SIMFS65config.abistUs);
+		return;
+	case WD_WINDOW_ADR:
+		reg[address] = (uint8_t)(value >> 4);
+		SIMFS65_WdStart(SIM_Now());
+		return;
+	case WD_LFSR_ADR:
+		if (value == 0)
+		{
+			SIMFS65_SpiError(address, SIMFS65_SPI_REQ, SIMFS65_SPI_FS_REQ, SIMFS65_FAULT_NB);
+		}
+		else
+		{
+			lfsr = (uint8_t)value;
+		}
+		return;
+	case WD_ANSWER_ADR:			SIMFS65_WdAnswer(value); return;
+	case RELEASE_FSxB_ADR:		SIMFS65_Release(value); return;
+	case SF_OUTPUT_REQUEST_ADR:
+		reg[address] = (uint8_t)(value >> 4);
+		if ((value & (SIMFS65_FS1B_LOW_REQ | SIMFS65_FS0B_LOW_REQ)) != 0)
+		{
+			fsxbAsserted = 1;
+		}
+		if ((value & SIMFS65_RSTB_REQ) != 0)
+		{
+			SIMFS65_Reset();
+		}
+		return;
+	default:
+		break;
+	}
+	reg[address] = (uint8_t)((regClassW == SIMFS65_REG_INIT_FS) ? (value >> 4) : value);
+}
+
+/*
+*	Clear on read part of a read frame and reaction time of the driver.
+*/
+static void SIMFS65_Read(uint32_t address)
+{
+	uint64_t now = SIM_Now();
+	uint32_t cls = regClass[address] & ~SIMFS65_SECURED;
+	uint32_t i;
+
+	for (i = 0; i < SIMFS65_FAULT_NB; i++)
+	{
+		if ((occurred[i] != SIM_NEVER) && (faultRegister[i] == address))
+		{
+			SIMFS65_Reaction *p_reaction = &SIMFS65stats.reaction[i];
+
+			p_reaction->observed++;
+			p_reaction->lastTicks = now - occurred[i];
+			if (p_reaction->lastTicks > p_reaction->maxTicks)
+			{
+				p_reaction->maxTicks = p_reaction->lastTicks;
+			}
+			occurred[i] = SIM_NEVER;
+		}
+	}
+
+	if (address == INIT_VREG_ADR)
+	{
+		batFail = 0;
+	}
+	if ((cls == SIMFS65_REG_READ) || (address == WD_ANSWER_ADR))
+	{
+		diag[address] = 0;
+	}
+	if (((cls == SIMFS65_REG_INIT_FS) || (cls == SIMFS65_REG_FS)) && (address != WD_LFSR_ADR) && (address != WD_ANSWER_ADR))
+	{
+		spiFsFlags = 0;
+	}
+}
+
+static uint32_t SIMFS65_Frame(uint32_t tx)
+{
+	uint64_t now = SIM_Now();
+	uint32_t write = (tx >> 15) & 1;
+	uint32_t address = (tx >> 9) & 0x3F;
+	uint32_t value = tx & 0xFF;
+	uint32_t cls = regClass[address];
+	uint32_t secured = cls & SIMFS65_SECURED;
+	uint32_t answer;
+	uint32_t ones;
+	uint32_t noAnswer = 0;
+
+	SIMFS65stats.frames++;
+	if (lpoff != 0)
+	{
+		return 0xFFFF;										//device off: MISO pulled up
+	}
+
+	answer = (SIMFS65_Status() << 8) | SIMFS65_Content(address);
+	if (armed[SIMFS65_FAULT_NO_ANSWER] != 0)
+	{
+		armed[SIMFS65_FAULT_NO_ANSWER] = 0;
+		SIMFS65_Occur(SIMFS65_FAULT_NO_ANSWER, 0);
+		noAnswer = 1;
+	}
+
+	if ((SIMFS65config.frameGapNs != 0) && (lastFrame != 0) && (now - lastFrame < SIMFS65_TICKS_NS(SIMFS65config.frameGapNs)))
+	{
+		lastFrame = now;
+		SIMFS65stats.requestErrors++;
+		SIMFS65_SpiError(address, SIMFS65_SPI_ERR, SIMFS65_SPI_FS_ERR, SIMFS65_FAULT_NB);
+		return (noAnswer != 0) ? 0xFFFF : answer;
+	}
+	lastFrame = now;
+	if (armed[SIMFS65_FAULT_SPI_CLK] != 0)
+	{
+		armed[SIMFS65_FAULT_SPI_CLK] = 0;
+		SIMFS65stats.clockErrors++;
+		SIMFS65_SpiError(address, SIMFS65_SPI_CLK, SIMFS65_SPI_FS_CLK, SIMFS65_FAULT_SPI_CLK);
+		return (noAnswer != 0) ? 0xFFFF : answer;
+	}
+
+	if (write == 0)
+	{
+		SIMFS65stats.reads++;
+		if ((cls & ~SIMFS65_SECURED) == SIMFS65_REG_NONE)
+		{
+			SIMFS65stats.requestErrors++;
+			SIMFS65_SpiError(address, SIMFS65_SPI_REQ, 0, SIMFS65_FAULT_NB);
+		}
+		else
+		{
+			SIMFS65_Read(address);
+		}
+		return (noAnswer != 0) ? 0xFFFF : answer;
+	}
+
+	SIMFS65stats.writes++;
+	if (armed[SIMFS65_FAULT_PARITY] != 0)
+	{
+		armed[SIMFS65_FAULT_PARITY] = 0;
+		tx ^= 0x100;
+	}
+	for (ones = 0; tx != 0; tx &= tx - 1)
+	{
+		ones++;
+	}
+	if ((ones & 1) == 0)
+	{
+		SIMFS65stats.parityErrors++;
+		SIMFS65_SpiError(address, SIMFS65_SPI_PARITY, SIMFS65_SPI_FS_PARITY, SIMFS65_FAULT_PARITY);
+	}
+	else if ((secured != 0) && ((value & 0x0F) != ((((value >> 6) & 1) | (((value >> 7) & 1) << 1)
+			 | (((~value >> 4) & 1) << 2) | (((~value >> 5) & 1) << 3)))))
+	{
+		SIMFS65stats.secureErrors++;
+		SIMFS65_SpiError(address, SIMFS65_SPI_REQ, SIMFS65_SPI_FS_REQ, SIMFS65_FAULT_NB);
+	}
+	else if (((cls & ~SIMFS65_SECURED) == SIMFS65_REG_NONE) || ((cls & ~SIMFS65_SECURED) == SIMFS65_REG_READ)
+			 || ((cls & ~SIMFS65_SECURED) == SIMFS65_REG_FS_READ)
+			 || (((cls & ~SIMFS65_SECURED) == SIMFS65_REG_INIT_MAIN) && (initMain == 0))
+			 || (((cls & ~SIMFS65_SECURED) == SIMFS65_REG_INIT_FS) && (initFs == 0))
+			 || (((cls & ~SIMFS65_SECURED) >= SIMFS65_REG_INIT_FS) && (lastFsWrite != 0)
+				 && (now - lastFsWrite < SIMFS65_TICKS_NS(SIMFS65config.fsWriteGapNs))))
+	{
+		SIMFS65stats.requestErrors++;
+		SIMFS65_SpiError(address, SIMFS65_SPI_REQ, SIMFS65_SPI_FS_REQ, SIMFS65_FAULT_NB);
+	}
+	else
+	{
+		if ((cls & ~SIMFS65_SECURED) >= SIMFS65_REG_INIT_FS)
+		{
+			lastFsWrite = now;
+		}
+		SIMFS65_Write(address, value);
+	}
+	return (noAnswer != 0) ? 0xFFFF : answer;
+}
+
+static uint32_t SIMFS65_Slave(uint32_t dspi, uint32_t pcs, uint32_t tx)
+{
+	if ((dspi == SIMFS65config.dspi) && ((pcs & SIMFS65config.pcs) != 0))
+	{
+		uint32_t answer = SIMFS65_Frame(tx & 0xFFFF);
+
+		SIMFS65_Schedule();
+		return answer;
+	}
+	return (p_prevSlave != 0) ? p_prevSlave(dspi, pcs, tx) : 0;
+}
+
+static void SIMFS65_Apply(uint32_t fault)
+{
+	static const uint8_t flag[SIMFS65_FAULT_NB] = {0, 0, 0, 0x04, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x08};	//UV, OV
+	static const uint8_t inhibit[SIMFS65_FAULT_NB] = {0, 0, 0, SIMFS65_INH_VPRE, SIMFS65_INH_VPRE,
+		SIMFS65_INH_VCORE, SIMFS65_INH_VCORE, SIMFS65_INH_VOTHERS, SIMFS65_INH_VOTHERS,
+		SIMFS65_INH_VOTHERS, SIMFS65_INH_VOTHERS};
+
+	switch (fault)
+	{
+	case SIMFS65_FAULT_PARITY:
+	case SIMFS65_FAULT_SPI_CLK:
+	case SIMFS65_FAULT_NO_ANSWER:
+	case SIMFS65_FAULT_WD_DATA:
+	case SIMFS65_FAULT_WD_TIMING:
+		armed[fault] = 1;
+		return;
+	case SIMFS65_FAULT_CAN:
+		diag[DIAG_CAN_FD_ADR] |= 0x40;						//CANH_GND
+		SIMFS65_Occur(fault, 1);
+		SIMFS65_Int(SIMFS65_INH_CAN);
+		return;
+	case SIMFS65_FAULT_IO:
+		ioLevel ^= 0x01;									//IO_0
+		diag[IO_INPUT_ADR] = 1;
+		SIMFS65_Occur(fault, 1);
+		if ((reg[INIT_INH_INT_ADR] & 0x01) != 0)
+		{
+			SIMFS65stats.intInhibited++;
+		}
+		else
+		{
+			SIMFS65_Int(0);
+		}
+		return;
+	default:
+		break;
+	}
+	if (fault < SIMFS65_FAULT_NB)
+	{
+		diag[faultRegister[fault]] |= flag[fault];
+		SIMFS65_Occur(fault, 1);
+		SIMFS65_Int(inhibit[fault]);
+	}
+}
+
+static void SIMFS65_Step(SIM_Model *p_model, uint64_t now)
+{
+	uint32_t vcoreOn = 0;
+	uint32_t i;
+
+	(void)p_model;
+	for (i = 0; i < injections; )
+	{
+		if (injection[i].when <= now)
+		{
+			uint32_t fault = injection[i].fault;
+
+			injection[i] = injection[--injections];
+			SIMFS65_Apply(fault);
+		}
+		else
+		{
+			i++;
+		}
+	}
+	if (intbEnd <= now)
+	{
+		intbLow = 0;
+		intbEnd = SIM_NEVER;
+		SIMDEV_SetPad(SIMFS65config.pad, 1);
+		SIMDEV_ExtIrq(SIMFS65config.eirq, 1);
+		if (intbPending != 0)
+		{
+			intbPending = 0;
+			SIMFS65_Int(0);
+		}
+	}
+	if (bistEnd <= now)
+	{
+		bistEnd = SIM_NEVER;
+		if ((bistRunning & SIMFS65_ABIST2_FS1B) != 0)
+		{
+			bist |= SIMFS65_ABIST2_FS1B_OK;
+		}
+		if ((bistRunning & SIMFS65_ABIST2_VAUX) != 0)
+		{
+			bist |= SIMFS65_ABIST2_VAUX_OK;
+		}
+		bistRunning = 0;
+	}
+	if (wakeAt <= now)
+	{
+		SIMFS65_PowerUp(0);
+		diag[WU_SOURCE_ADR] = 0x04;							//AUTO_WU
+		vcoreOn = 1;
+	}
+	if ((lpoff == 0) && (initFs != 0) && (initFsEnd <= now))
+	{
+		SIMFS65stats.wdTimeouts++;
+		SIMFS65_Reset();									//no good refresh in INIT_FS
+	}
+	if ((lpoff == 0) && (initFs == 0) && (wdEnd <= now))
+	{
+		SIMFS65stats.wdTimeouts++;
+		SIMFS65_WdBad(SIMFS65_WD_BAD_TIMING);
+	}
+	SIMFS65_Schedule();
+	if ((vcoreOn != 0) && (SIMFS65_VcoreOn != 0))
+	{
+		SIMFS65_VcoreOn();									//power-on reset of the MCU, last
+	}
+}
+
+/*==================================================================================================
+*   Global functions
+==================================================================================================*/
+
+/***************************************************************************//*!
+*   @brief Keep-alive RAM cleared, host part of the startup routine
+*			(Project_Settings/Startup_Code/startup.S).
+*	@remarks 	The keep-alive RAM of the firmware is FS65_Vkam.
+********************************************************************************/
+void VKAM_Clear(void)
+{
+	memset(&FS65_Vkam, 0, sizeof(FS65_Vkam));
+}
+
+/***************************************************************************//*!
+*   @brief Connects the model to the DSPI model and powers the device up.
+*	@remarks 	Called after SIMDEV_Init, SIMFS65config may be changed before.
+*				Frames of other modules and chip selects are passed to the
+*				previous SIMDEV_SpiSlave hook.
+********************************************************************************/
+void SIMFS65_Init(void)
+{
+	uint32_t i;
+
+	memset(&SIMFS65stats, 0, sizeof(SIMFS65stats));
+	memset(armed, 0, sizeof(armed));
+	memset(intbWaiting, 0, sizeof(intbWaiting));
+	for (i = 0; i < SIMFS65_FAULT_NB; i++)
+	{
+		occurred[i] = SIM_NEVER;
+	}
+	injections = 0;
+	intbLow = 0;
+	intbPending = 0;
+	intbEnd = SIM_NEVER;
+	ioLevel = 0;
+	lastFsWrite = 0;
+	lastFrame = 0;
+	SIMFS65_PowerUp(1);
+
+	fs65Model.name = "FS65";
+	fs65Model.base = 0;
+	fs65Model.size = 0;										//no registers: timed events only
+	fs65Model.step = SIMFS65_Step;
+	fs65Model.due = SIM_NEVER;
+	SIM_AddModel(&fs65Model);
+	SIMDEV_SetPad(SIMFS65config.pad, 1);					//INTb released
+	p_prevSlave = SIMDEV_SpiSlave;
+	SIMDEV_SpiSlave = SIMFS65_Slave;
+	SIMFS65_Schedule();
+}
+
+/***************************************************************************//*!
+*   @brief Injects a fault now.
+*	@param[in] fault - SIMFS65_FAULT_xxx.
+*	@remarks 	SPI and WD faults apply to the next frame or WD answer, the
+*				others set their diagnostic flag and request INTb.
+********************************************************************************/
+void SIMFS65_Inject(uint32_t fault)
+{
+	SIMFS65_Apply(fault);
+	SIMFS65_Schedule();
+}
+
+/***************************************************************************//*!
+*   @brief Injects a fault at a given time [core ticks].
+********************************************************************************/
+void SIMFS65_InjectAt(uint32_t fault, uint64_t when)
+{
+	if ((fault < SIMFS65_FAULT_NB) && (injections < SIMFS65_INJECTIONS))
+	{
+		injection[injections].fault = fault;
+		injection[injections].when = when;
+		injections++;
+		SIMFS65_Schedule();
+	}
+}
+
+/***************************************************************************//*!
+*   @brief Fault of a name ("parity", "vcore_uv", ...), SIMFS65_FAULT_NB if unknown.
+********************************************************************************/
+uint32_t SIMFS65_Fault(const char *name)
+{
+	uint32_t i;
+
+	for (i = 0; i < SIMFS65_FAULT_NB; i++)
+	{
+		if (strcmp(name, faultName[i]) == 0)
+		{
+			break;
+		}
+	}
+	return i;
+}
+
+const char *SIMFS65_FaultName(uint32_t fault)
+{
+	return (fault < SIMFS65_FAULT_NB) ? faultName[fault] : "?";
+}
+
+/***************************************************************************//*!
+*   @brief Content of a register (data Byte), without clear on read.
+********************************************************************************/
+uint32_t SIMFS65_Register(uint32_t address)
+{
+	return SIMFS65_Content(address & 0x3F);
+}
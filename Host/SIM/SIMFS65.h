@@ -0,0 +1,154 @@
+/*******************************************************************************
+*
+* $File Name:       SIMFS65.h$
+* @file             SIMFS65.h
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      FS65xx (PwSBC) SPI device model of the register window simulator
+* @brief            FS65xx (PwSBC) SPI device model of the register window simulator
+*
+*   The model answers the frames of the DSPI model (SIMDEV_SpiSlave) on the
+*   chip select of the FS65 driver:
+*     - 16-bit frames: R/W, 6-bit address, odd parity (writes), 8-bit data;
+*       MISO is the general status byte and the content of the addressed
+*       register before the frame. Parity, security bits, unknown address
+*       and INIT locked writes are rejected and flagged in DIAG_SPI (SPI_G,
+*       INTb) and, for the fail-safe registers, in their SPI_FS flags.
+*     - Register map of FS65xx.h: main INIT registers writable until
+*       INIT_INT is written, fail-safe INIT registers until the first good
+*       WD refresh (INIT_FS, 256 ms), clear on read diagnostics.
+*     - Watchdog: window of WD_WINDOW (closed then open half), answer
+*       ~WD_LFSR, 8-bit LFSR stepped by each good refresh, WD error and
+*       refresh counters (INIT_WD_CNT), fault error counter, FS0B/FS1B
+*       release by RELEASE_FSxB.
+*     - INTb pulse (EIRQ, falling edge) for the events of the status byte
+*       not inhibited by INIT_INT/INIT_INH_INT, and for MODE[INT_REQ].
+*   Faults are injected by SIMFS65_Inject; the time from the injection to
+*   the first read of the register reporting it is the driver reaction.
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Tool created
+BRNY001					      19/10/2026 	   SIMFS65_VcoreOn  Vcore back after the LPOFF wake-up
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#ifndef _SIMFS65_H_
+#define _SIMFS65_H_
+
+#include <stdint.h>
+
+/*==================================================================================================
+*   Configurable parameters (defaults of SIMFS65_Config)
+==================================================================================================*/
+
+#define SIMFS65_FS_WRITE_GAP_NS		3000	///fail-safe write accepted this long after the previous one
+#define SIMFS65_FRAME_GAP_NS		0		///shortest time between two frame ends, 0 - not checked
+#define SIMFS65_INIT_FS_US			256000	///INIT_FS phase without good WD refresh
+#define SIMFS65_ABIST2_US			100		///ABIST2 duration
+#define SIMFS65_LPOFF_WAKE_US		1000	///LPOFF with automatic wake-up
+#define SIMFS65_DEVICE_ID			0x5A	///DEVICE_ID: VCORE, PHY, VKAM, DEV_REV
+#define SIMFS65_DEVICE_ID_FS		0x01	///DEVICE_ID_FS: FS1B implemented
+#define SIMFS65_HW_CONFIG			0x18	///HW_CONFIG: Vcca and Vaux populated
+
+/*==================================================================================================
+*   NON - configurable parameters
+==================================================================================================*/
+
+//Faults of SIMFS65_Inject
+#define SIMFS65_FAULT_PARITY		0		///next frame received with a wrong parity
+#define SIMFS65_FAULT_SPI_CLK		1		///next frame received with a wrong number of clocks
+#define SIMFS65_FAULT_NO_ANSWER		2		///next frame not answered (MISO high)
+#define SIMFS65_FAULT_VPRE_UV		3
+#define SIMFS65_FAULT_VPRE_OV		4
+#define SIMFS65_FAULT_VCORE_UV		5
+#define SIMFS65_FAULT_VCORE_OV		6
+#define SIMFS65_FAULT_VCCA_UV		7
+#define SIMFS65_FAULT_VCCA_OV		8
+#define SIMFS65_FAULT_VAUX_UV		9
+#define SIMFS65_FAULT_VAUX_OV		10
+#define SIMFS65_FAULT_WD_DATA		11		///next WD answer received corrupted
+#define SIMFS65_FAULT_WD_TIMING		12		///next WD refresh seen in the closed window
+#define SIMFS65_FAULT_CAN			13		///CAN bus failure (CANH to GND)
+#define SIMFS65_FAULT_IO			14		///edge on IO0
+#define SIMFS65_FAULT_NB			15
+
+/*==================================================================================================
+*   Structures/Type defines
+==================================================================================================*/
+
+typedef struct {
+	uint32_t	dspi;				///DSPI module of the FS65 (DSPI_NB)
+	uint32_t	pcs;				///chip select mask (DSPI_CS)
+	uint32_t	eirq;				///EIRQ of INTb (SIUL_INT_EIRQ)
+	uint32_t	pad;				///pad of INTb (GPDI)
+	uint32_t	fsWriteGapNs;
+	uint32_t	frameGapNs;
+	uint32_t	initFsUs;
+	uint32_t	abistUs;
+	uint32_t	lpoffWakeUs;
+	uint8_t		deviceId;
+	uint8_t		deviceIdFs;
+	uint8_t		hwConfig;
+} SIMFS65_Config;
+
+typedef struct {					///reaction of the driver to a fault [core ticks]
+	uint32_t	injected;
+	uint32_t	observed;			///fault register read by the driver
+	uint64_t	lastTicks;
+	uint64_t	maxTicks;
+	uint32_t	intb;				///faults signalled by an INTb pulse
+	uint64_t	intbTicks;			///injection to the last INTb falling edge
+} SIMFS65_Reaction;
+
+typedef struct {
+	uint32_t	frames;
+	uint32_t	reads;
+	uint32_t	writes;
+	uint32_t	parityErrors;
+	uint32_t	secureErrors;		///wrong security bits
+	uint32_t	requestErrors;		///unknown address, INIT locked or early fail-safe write
+	uint32_t	clockErrors;
+	uint32_t	wdGood;
+	uint32_t	wdBadData;
+	uint32_t	wdBadTiming;		///refresh in the closed window
+	uint32_t	wdTimeouts;			///no refresh in the open window
+	uint64_t	wdWindow;			///WD window of the last good refresh in a window [core ticks], 0 - none
+	uint32_t	resets;				///RSTB pulses (WD error counter, INIT_FS timeout, request)
+	uint32_t	intPulses;
+	uint32_t	intInhibited;		///events without INTb (INIT_INT)
+	uint32_t	releases;			///FS0B/FS1B released by RELEASE_FSxB
+	uint32_t	releaseErrors;		///wrong code or fault error counter not 0
+	uint32_t	lpoff;
+	uint32_t	initMainEnd;		///frame number of the end of INIT main, 0 - not ended
+	uint32_t	initFsEnd;			///frame number of the end of INIT_FS, 0 - not ended
+	SIMFS65_Reaction reaction[SIMFS65_FAULT_NB];
+} SIMFS65_Stats;
+
+extern SIMFS65_Config SIMFS65config;
+extern SIMFS65_Stats SIMFS65stats;
+extern void (*SIMFS65_VcoreOn)(void);	///Vcore back after the LPOFF wake-up (power-on reset of the MCU), 0 - none
+
+/*==================================================================================================
+*   Function prototypes
+==================================================================================================*/
+
+void SIMFS65_Init(void);
+void SIMFS65_Inject(uint32_t fault);
+void SIMFS65_InjectAt(uint32_t fault, uint64_t when);
+uint32_t SIMFS65_Fault(const char *name);
+const char *SIMFS65_FaultName(uint32_t fault);
+uint32_t SIMFS65_Register(uint32_t address);
+
+#endif
@@ -0,0 +1,514 @@
+/*******************************************************************************
+*
+* $File Name:       simbench.c$
+* @file             simbench.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Driver benchmark on the register window simulator
+* @brief            Driver benchmark on the register window simulator
+*
+*   Usage:
+*     simbench                     - print the cost of each case
+*     simbench -b simbench.baseline  - compare with the baseline, exit 1 on
+*                                    a regression
+*     simbench -w simbench.baseline  - write the baseline
+*
+*   The platform is initialized like src/main.c (without the WD refresh
+*   channel and the ADC interrupt, so nothing runs between the cases), then
+*   each case calls one driver API on the FS65xx model of SIMFS65.c. Per
+*   case: SPI frames, DSPI bus time, simulated duration, peripheral register
+*   accesses (all deterministic) and the host instructions of the run
+*   (perf counter, 0 if not available).
+*   Budgets: frames and accesses may not grow, bus and simulated time may
+*   grow by BENCH_TIME_TOLERANCE %, host instructions by
+*   BENCH_INSTR_TOLERANCE % (they depend on the host and the compiler).
+*   The continuous UART transmission case also prints the CPU load of the
+*   Tx ISR (its execution time over the duration of the transmission).
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Tool created
+BRNY001					      19/10/2026 	   Bench_LpoffWake  LPOFF with snapshot and warm FS65_Init cases
+BRNY001					      19/10/2026 	   benchCase	  Configuration applied again (FS65_ApplyConfig, reads only)
+BRNY001					      19/10/2026 	   Bench_UartStream  CPU load of a continuous UART transmission
+BRNY001					      19/10/2026 	   Bench_Entry	  No case run if the FCCU or mode entry setup times out
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include "derivative.h"
+#include "FS65xx_driver.h"
+#include "MPC5744P_drv.h"
+#include "DSPI.h"
+#include "ME.h"
+#include "LINFLEX.h"
+#include "ADC.h"
+#include "FCCU.h"
+#include "SIUL.h"
+#include "PIT.h"
+#include "CAN.h"
+#include "GUI.h"
+#include "TIME.h"
+#include "TIMER.h"
+#include "DEFER.h"
+#include "SIM.h"
+#include "SIMDEV.h"
+#include "SIMFS65.h"
+
+#define BENCH_TIME_TOLERANCE	2			///allowed growth of the bus and simulated time [%]
+#define BENCH_INSTR_TOLERANCE	25			///allowed growth of the host instructions [%]
+#define BENCH_LIMIT_MS			2000		///simulated time of the whole run
+#define BENCH_BATCH				8			///commands of the batch cases
+#define BENCH_UART_BYTES		16
+#define BENCH_UART_STREAM		4096		///Bytes of the continuous UART transmission
+#define BENCH_UART_TX_VECTOR	381			///LINFlex_1 TXI (LINFLEX_UART_NB = 1)
+
+typedef struct {
+	const char	*name;
+	void		(*run)(void);
+} Bench_Case;
+
+typedef struct {
+	uint64_t	frames;
+	uint64_t	busTicks;
+	uint64_t	simTicks;
+	uint64_t	accesses;
+	uint64_t	instructions;
+} Bench_Cost;
+
+typedef struct {
+	uint32_t	bytes;
+	uint32_t	interrupts;
+	uint64_t	busy;				///Tx ISR execution [core ticks]
+	uint64_t	duration;			///[core ticks]
+} Bench_Stream;
+
+static Bench_Stream uartStream;
+
+extern void xcptn_xmpl(void);
+
+static int perfFd = -1;
+
+/*==================================================================================================
+*   Cases
+==================================================================================================*/
+
+static const uint16_t diagReads[BENCH_BATCH] = {DIAG_VPRE_ADR << 9, DIAG_VCORE_ADR << 9, DIAG_VCCA_ADR << 9,
+	DIAG_VAUX_ADR << 9, DIAG_VSUP_VCAN_ADR << 9, DIAG_CAN_FD_ADR << 9, DIAG_CAN_LIN_ADR << 9, DIAG_SPI_ADR << 9};
+
+static void Bench_DspiInit(void)				{ DSPI_Init(DSPI_NB, MASTER, DSPI_CLK, 1000000, 0); }
+static void Bench_FS65Init(void)				{ FS65_Init(); }
+static void Bench_ConfigNonInit(void)			{ (void)FS65_Config_NonInit(); }
+static void Bench_InitFSSM(void)				{ (void)FS65_Init_FSSM(); }
+static void Bench_GetStatus(void)				{ FS65_GetStatus(); }
+static void Bench_UpdateRegisterContent(void)	{ (void)FS65_UpdateRegisterContent(DIAG_VPRE_ADR); }
+static void Bench_SendCmdR(void)				{ (void)FS65_SendCmdR(DEVICE_ID_ADR << 9); }
+static void Bench_IsrPIT_WD(void)				{ FS65_IsrPIT_WD(); }
+static void Bench_IsrADC(void)					{ FS65_IsrADC(); }
+static void Bench_GetVoltage(void)				{ (void)FS65_GetVoltage(); }
+static void Bench_SwitchAMUX(void)				{ (void)FS65_SwitchAMUXchannel(AMUX_VSNS_WIDE); }
+static void Bench_SetOUT4(void)					{ (void)FS65_SetOUT4(); }
+static void Bench_ClearOUT4(void)				{ (void)FS65_ClearOUT4(); }
+static void Bench_EnableVaux(void)				{ (void)FS65_EnableVaux(); }
+static void Bench_SetAutoCANTxDisable(void)		{ (void)FS65_SetAutoCANTxDisable(); }
+static void Bench_SetLDTNormalMode(void)		{ (void)FS65_SetLDTNormalMode(); }
+static void Bench_ConfAfterRunValue(void)		{ (void)FS65_ConfAfterRunValue(0x0000000F); }
+static void Bench_ReleaseFS0andFS1out(void)		{ (void)FS65_ReleaseFS0andFS1out(); }
+static void Bench_CanSend(void)					{ CAN_Send(0, 0, 0xA0A0A0A0A0A0A0A0ULL, 0x15555555); }
+static void Bench_CanErrorTask(void)			{ (void)CAN_ErrorTask(0); }
+
+static void Bench_SendBatch(void)
+{
+	uint32_t cmd[BENCH_BATCH];
+	uint16_t answer[BENCH_BATCH];
+	uint32_t i;
+
+	for (i = 0; i < BENCH_BATCH; i++)
+	{
+		cmd[i] = diagReads[i];
+	}
+	(void)FS65_SendBatch(cmd, answer, BENCH_BATCH);
+}
+
+static void Bench_SnapshotRegisters(void)
+{
+	static struct FS65_INT_tag registers;
+	static Status_32B_tag status;
+
+	(void)FS65_SnapshotRegisters(&registers, &status);
+}
+
+static void Bench_DspiSendRead(void)
+{
+	DSPI_Send(DSPI_NB, DSPI_CS, DEVICE_ID_ADR << 9);
+	(void)DSPI_Read(DSPI_NB);
+}
+
+/*
+*	Snapshot in the keep-alive RAM, LPOFF with automatic wake-up and wait
+*	for the power-up of the model: the next FS65_Init resumes warm. The
+*	MCU keeps running (no SIMFS65_VcoreOn), the reset path is run by simrun.
+*/
+static void Bench_LpoffWake(void)
+{
+	FS65_EnableVKAM();
+	(void)FS65_SaveVkam();
+	FS65_SetLPOFFmode_autoWU();
+	PIT_wait_micsec(SIMFS65config.lpoffWakeUs + 100);
+}
+
+static void Bench_DspiSendBatch(void)
+{
+	uint16_t answer[BENCH_BATCH];
+
+	(void)DSPI_SendBatch(DSPI_NB, DSPI_CS, diagReads, answer, BENCH_BATCH);
+}
+
+/*
+*	INTb from the model (Vcore UV): interrupt, deferred status read and
+*	callbacks. The register read lets the simulator dispatch the request.
+*/
+static void Bench_IsrSIUL(void)
+{
+	SIMFS65_Inject(SIMFS65_FAULT_VCORE_UV);
+	(void)INTC_0.CPR0.R;
+}
+
+static void Bench_AdcConversion(void)
+{
+	ADC_StartNormalConversion(ADC_NB, ADC_MASK);
+	while (ADC_IsNormalConvRunning(ADC_NB) != 0)
+	{}
+}
+
+static void Bench_UartWrite(void)
+{
+	static const uint8_t data[BENCH_UART_BYTES] = "simbench UART Tx";
+
+	(void)LINFLEX_WriteUART(LINFLEX_UART_NB, data, BENCH_UART_BYTES);
+	while (LINFLEX_GetTxFreeUART() != LINFLEX_UART_TX_BUFFER_SIZE)	//Tx interrupts up to the last Byte
+	{
+		(void)LINFLEX_IsIdle(LINFLEX_UART_NB);
+	}
+}
+
+/*
+*	Continuous transmission: the ring is kept full, the CPU load of the
+*	transmission is the execution time of the Tx ISR over the duration.
+*/
+static void Bench_UartStream(void)
+{
+	static const uint8_t data[64] = "simbench UART Tx stream";
+	uint64_t exec = SIMstats.response[BENCH_UART_TX_VECTOR].totalExec;
+	uint64_t start = SIM_Now();
+	uint32_t isrCount = LINFLEXtxRing.isrCount;
+	uint32_t sent = 0;
+
+	while (sent < BENCH_UART_STREAM)
+	{
+		sent += LINFLEX_WriteUART(LINFLEX_UART_NB, data, sizeof(data));
+		(void)LINFLEX_IsIdle(LINFLEX_UART_NB);
+	}
+	while (LINFLEX_GetTxFreeUART() != LINFLEX_UART_TX_BUFFER_SIZE)
+	{
+		(void)LINFLEX_IsIdle(LINFLEX_UART_NB);
+	}
+	uartStream.bytes = sent;
+	uartStream.interrupts = LINFLEXtxRing.isrCount - isrCount;
+	uartStream.busy = SIMstats.response[BENCH_UART_TX_VECTOR].totalExec - exec;
+	uartStream.duration = SIM_Now() - start;
+}
+
+static const Bench_Case benchCase[] = {
+	{"DSPI_Init", Bench_DspiInit},
+	{"FS65_Init", Bench_FS65Init},
+	{"FS65_Config_NonInit", Bench_ConfigNonInit},
+	{"FS65_GetStatus", Bench_GetStatus},
+	{"FS65_UpdateRegisterContent", Bench_UpdateRegisterContent},
+	{"FS65_SendCmdR", Bench_SendCmdR},
+	{"FS65_SendBatch", Bench_SendBatch},
+	{"FS65_SnapshotRegisters", Bench_SnapshotRegisters},
+	{"FS65_IsrPIT_WD", Bench_IsrPIT_WD},
+	{"FS65_IsrSIUL", Bench_IsrSIUL},
+	{"FS65_IsrADC", Bench_IsrADC},
+	{"FS65_GetVoltage", Bench_GetVoltage},
+	{"FS65_SwitchAMUXchannel", Bench_SwitchAMUX},
+	{"FS65_SetOUT4", Bench_SetOUT4},
+	{"FS65_ClearOUT4", Bench_ClearOUT4},
+	{"FS65_EnableVaux", Bench_EnableVaux},
+	{"FS65_SetAutoCANTxDisable", Bench_SetAutoCANTxDisable},
+	{"FS65_SetLDTNormalMode", Bench_SetLDTNormalMode},
+	{"FS65_ConfAfterRunValue", Bench_ConfAfterRunValue},
+	{"FS65_ReleaseFS0andFS1out", Bench_ReleaseFS0andFS1out},
+	{"DSPI_Send_Read", Bench_DspiSendRead},
+	{"DSPI_SendBatch", Bench_DspiSendBatch},
+	{"ADC_NormalConversion", Bench_AdcConversion},
+	{"CAN_Send", Bench_CanSend},
+	{"CAN_ErrorTask", Bench_CanErrorTask},
+	{"LINFLEX_WriteUART", Bench_UartWrite},
+	{"LINFLEX_WriteUART_stream", Bench_UartStream},
+	{"FS65_LPOFF_wake", Bench_LpoffWake},
+	{"FS65_Init_warm", Bench_FS65Init},
+	{"FS65_Config_NonInit_warm", Bench_ConfigNonInit},
+	{"FS65_Config_NonInit_again", Bench_ConfigNonInit},
+	{"FS65_Init_FSSM_again", Bench_InitFSSM},
+};
+
+#define BENCH_CASES		(sizeof(benchCase) / sizeof(benchCase[0]))
+
+static Bench_Cost benchCost[BENCH_CASES];
+static uint32_t benchDone;
+
+/*==================================================================================================
+*   Measurement
+==================================================================================================*/
+
+static uint64_t Bench_Instructions(void)
+{
+	uint64_t count = 0;
+
+	if ((perfFd < 0) || (read(perfFd, &count, sizeof(count)) != sizeof(count)))
+	{
+		return 0;
+	}
+	return count;
+}
+
+static void Bench_Sample(Bench_Cost *p_cost)
+{
+	p_cost->frames = SIMDEVstats.spiFrames;
+	p_cost->busTicks = SIMDEVstats.spiTicks;
+	p_cost->simTicks = SIM_Now();
+	p_cost->accesses = SIMstats.reads + SIMstats.writes;
+	p_cost->instructions = Bench_Instructions();
+}
+
+/*
+*	Platform of src/main.c up to FS65_Init, then the cases.
+*/
+static void Bench_Entry(void)
+{
+	Bench_Cost start;
+	Bench_Cost end;
+	uint32_t i;
+
+	TIME_Init();
+	AIPS_0.MPRA.R = 0x77777777;
+	AIPS_1.MPRA.R = 0x77777777;
+	if ((FCCU_SetProtocol(FCCU_BI_STABLE) != FCCU_RETURN_OK) || (MC_MODE_INIT() != ME_RETURN_OK))
+	{
+		return;												//platform not set up, no case run
+	}
+	DEFER_Init();
+	xcptn_xmpl();
+	SIUL_DigitalInput(SIUL_PA0, 173, 0, 1);
+	SIUL_EnableExtIntFallingEdge(1);
+	SIUL_EnableExtInt(1);
+	CAN_Init(0);
+	CAN_ConfigurePads(0);
+	ADCstruct.scanVoltage.R = 0x8F;
+	ADC_Init(ADC_NB, ADC_MASK, 0, ONE_SHOT);
+	PIT_Init();
+	PIT_Setup(PIT_WD_CH, PIT_CLK / 1000000, 3000);
+	TIMER_Init();
+	LINFLEX_InitUART(LINFLEX_UART_NB, LINFLEX_CLK, LINFLEX_UART_BR);
+	GUI_Init();
+
+	for (i = 0; i < BENCH_CASES; i++)
+	{
+		Bench_Sample(&start);
+		benchCase[i].run();
+		Bench_Sample(&end);
+		benchCost[i].frames = end.frames - start.frames;
+		benchCost[i].busTicks = end.busTicks - start.busTicks;
+		benchCost[i].simTicks = end.simTicks - start.simTicks;
+		benchCost[i].accesses = end.accesses - start.accesses;
+		benchCost[i].instructions = ((start.instructions | end.instructions) != 0) ? end.instructions - start.instructions : 0;
+		benchDone++;
+	}
+}
+
+static void Bench_OpenCounter(void)
+{
+	struct perf_event_attr attr;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.size = sizeof(attr);
+	attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	perfFd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+/*==================================================================================================
+*   Baseline
+==================================================================================================*/
+
+static int Bench_Write(const char *path)
+{
+	FILE *p_file = fopen(path, "w");
+	uint32_t i;
+
+	if (p_file == 0)
+	{
+		perror(path);
+		return 2;
+	}
+	fprintf(p_file, "# simbench baseline: case frames bus_ticks sim_ticks accesses host_instructions\n");
+	for (i = 0; i < benchDone; i++)
+	{
+		fprintf(p_file, "%s %llu %llu %llu %llu %llu\n", benchCase[i].name,
+				(unsigned long long)benchCost[i].frames, (unsigned long long)benchCost[i].busTicks,
+				(unsigned long long)benchCost[i].simTicks, (unsigned long long)benchCost[i].accesses,
+				(unsigned long long)benchCost[i].instructions);
+	}
+	fclose(p_file);
+	printf("\nbaseline written to %s\n", path);
+	return 0;
+}
+
+static int Bench_Over(uint64_t value, uint64_t budget, uint32_t tolerance)
+{
+	return value * 100 > budget * (100 + tolerance);
+}
+
+static int Bench_Compare(const char *path)
+{
+	FILE *p_file = fopen(path, "r");
+	char line[256];
+	char name[64];
+	unsigned long long v[5];
+	uint32_t failed = 0;
+	uint32_t found = 0;
+	uint32_t i;
+
+	if (p_file == 0)
+	{
+		perror(path);
+		return 2;
+	}
+	printf("\ncase                        budget\n");
+	while (fgets(line, sizeof(line), p_file) != 0)
+	{
+		if ((line[0] == '#') || (sscanf(line, "%63s %llu %llu %llu %llu %llu", name, &v[0], &v[1], &v[2], &v[3], &v[4]) != 6))
+		{
+			continue;
+		}
+		for (i = 0; i < benchDone; i++)
+		{
+			if (strcmp(name, benchCase[i].name) == 0)
+			{
+				const Bench_Cost *p_cost = &benchCost[i];
+				char reason[128] = "";
+
+				if (p_cost->frames > v[0])
+				{
+					snprintf(reason + strlen(reason), sizeof(reason) - strlen(reason), " frames %llu>%llu", (unsigned long long)p_cost->frames, v[0]);
+				}
+				if (Bench_Over(p_cost->busTicks, v[1], BENCH_TIME_TOLERANCE))
+				{
+					snprintf(reason + strlen(reason), sizeof(reason) - strlen(reason), " bus %llu>%llu", (unsigned long long)p_cost->busTicks, v[1]);
+				}
+				if (Bench_Over(p_cost->simTicks, v[2], BENCH_TIME_TOLERANCE))
+				{
+					snprintf(reason + strlen(reason), sizeof(reason) - strlen(reason), " time %llu>%llu", (unsigned long long)p_cost->simTicks, v[2]);
+				}
+				if (p_cost->accesses > v[3])
+				{
+					snprintf(reason + strlen(reason), sizeof(reason) - strlen(reason), " accesses %llu>%llu", (unsigned long long)p_cost->accesses, v[3]);
+				}
+				if ((p_cost->instructions != 0) && (v[4] != 0) && Bench_Over(p_cost->instructions, v[4], BENCH_INSTR_TOLERANCE))
+				{
+					snprintf(reason + strlen(reason), sizeof(reason) - strlen(reason), " instructions %llu>%llu", (unsigned long long)p_cost->instructions, v[4]);
+				}
+				printf("%-26s  %s%s\n", name, (reason[0] != 0) ? "FAIL" : "ok", reason);
+				failed += (reason[0] != 0);
+				found++;
+				break;
+			}
+		}
+	}
+	fclose(p_file);
+	printf("\n%u cases checked, %u without baseline, %u over budget\n", found, benchDone - found, failed);
+	return (failed != 0) ? 1 : 0;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *p_baseline = 0;
+	const char *p_write = 0;
+	int result;
+	uint32_t i;
+
+	if ((argc > 2) && (strcmp(argv[1], "-b") == 0))
+	{
+		p_baseline = argv[2];
+	}
+	else if ((argc > 2) && (strcmp(argv[1], "-w") == 0))
+	{
+		p_write = argv[2];
+	}
+	if (SIM_Init() != 0)
+	{
+		perror("register window");
+		return 2;
+	}
+	SIMDEV_Init();
+	SIMFS65_Init();
+	Bench_OpenCounter();
+	if (perfFd >= 0)
+	{
+		(void)ioctl(perfFd, PERF_EVENT_IOC_RESET, 0);
+		(void)ioctl(perfFd, PERF_EVENT_IOC_ENABLE, 0);
+	}
+
+	result = SIM_Run(Bench_Entry, (uint64_t)BENCH_LIMIT_MS * (CLOCK_SYS_HZ / 1000));
+
+	printf("case                        frames  bus [us]    time [us]   accesses  host instr\n");
+	for (i = 0; i < benchDone; i++)
+	{
+		printf("%-26s  %-6llu  %-10.2f  %-10.2f  %-8llu  %llu\n", benchCase[i].name,
+			   (unsigned long long)benchCost[i].frames, (double)benchCost[i].busTicks / TIME_TICKS_PER_US,
+			   (double)benchCost[i].simTicks / TIME_TICKS_PER_US, (unsigned long long)benchCost[i].accesses,
+			   (unsigned long long)benchCost[i].instructions);
+	}
+	if (uartStream.duration != 0)
+	{
+		printf("\nUART Tx stream: %u Bytes in %.2f us, %u Tx interrupts, ISR busy %.2f %% (CPU free %.2f %%)\n",
+			   uartStream.bytes, (double)uartStream.duration / TIME_TICKS_PER_US, uartStream.interrupts,
+			   100.0 * uartStream.busy / uartStream.duration, 100.0 - 100.0 * uartStream.busy / uartStream.duration);
+	}
+	if ((result != SIM_END_RETURN) || (benchDone != BENCH_CASES))
+	{
+		printf("run ended after %u of %u cases (%s)\n", benchDone, (uint32_t)BENCH_CASES,
+			   (result == SIM_END_LIMIT) ? "time limit" : "vector without handler");
+		return 2;
+	}
+	if (p_write != 0)
+	{
+		return Bench_Write(p_write);
+	}
+	if (p_baseline != 0)
+	{
+		return Bench_Compare(p_baseline);
+	}
+	return 0;
+}
@@ -0,0 +1,275 @@
+/*******************************************************************************
+*
+* $File Name:       simreplay.c$
+* @file             simreplay.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Replay of a recorded SPI trace into the FS65xx model
+* @brief            Replay of a recorded SPI trace into the FS65xx model
+*
+*   Usage:
+*     simreplay trace.txt          - replay at the recorded times (time base
+*                                    of the target, 0 at reset)
+*     simreplay -r trace.txt       - replay relative to the first record
+*                                    (trace not starting at reset)
+*
+*   The text trace is written by Host/SPITRACE/spidump (target capture) or
+*   by simrun -t. Each recorded command is sent by the DSPI driver of the
+*   firmware (DSPI_Send, DSPI_Read) to the FS65xx model of SIMFS65.c, the
+*   frame ends at the recorded time (the wait until then is a timed model
+*   event, so a long gap costs one idle jump). Every answer of the model is
+*   compared with the recorded one, the differences are printed decoded
+*   (general status and register bit fields, see Host/SPITRACE/SPIDEC.c).
+*   Records without answer (SPITRACE_FLAG_NO_ANSWER) are sent but not
+*   compared. Exit code 1 if an answer differs.
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Tool created
+BRNY001					      19/10/2026 	   Replay_Entry  Nothing replayed if the mode entry times out
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MPC5744P_drv.h"
+#include "DSPI.h"
+#include "ME.h"
+#include "TIME.h"
+#include "SIM.h"
+#include "SIMDEV.h"
+#include "SIMFS65.h"
+#include "SPIDEC.h"
+
+#define REPLAY_MAX_PRINT		50			///differences printed in full
+
+typedef struct {
+	SPIDEC_Record	*p_records;
+	uint32_t		count;
+	uint32_t		relative;				///1 - first record at the start of the replay
+	uint32_t		replayed;
+	uint32_t		compared;
+	uint32_t		mismatches;
+	uint64_t		maxSkew;				///largest distance between the recorded and the replayed frame end [ticks]
+} Replay_Trace;
+
+static Replay_Trace replay;
+static SIM_Model replayModel;
+static volatile uint32_t replayDue;
+
+static void Replay_Step(SIM_Model *p_model, uint64_t now)
+{
+	(void)now;
+	p_model->due = SIM_NEVER;
+	replayDue = 1;
+}
+
+/*
+*	Waits until the simulated time base reaches when (RAM polling loop, the
+*	idle detection jumps to the event).
+*/
+static void Replay_WaitUntil(uint64_t when)
+{
+	if (when <= SIM_Now())
+	{
+		return;
+	}
+	replayDue = 0;
+	SIM_Wake(&replayModel, when);
+	while (replayDue == 0)
+	{
+	}
+}
+
+static void Replay_Report(const SPIDEC_Record *p_record, uint32_t rx)
+{
+	char recorded[SPIDEC_TEXT_SIZE];
+	char replayed[SPIDEC_TEXT_SIZE];
+	uint32_t address = (p_record->tx >> 9) & 0x3F;
+
+	replay.mismatches++;
+	if (replay.mismatches > REPLAY_MAX_PRINT)
+	{
+		return;
+	}
+	(void)SPIDEC_Frame(p_record->tx, p_record->rx, p_record->flags, recorded, sizeof(recorded));
+	printf("#%u at %.2f us: %s\n", p_record->sequence, (double)SIM_Now() / TIME_TICKS_PER_US, recorded);
+	if (((rx ^ p_record->rx) & 0xFF00) != 0)
+	{
+		(void)SPIDEC_Status(p_record->rx >> 8, recorded, sizeof(recorded));
+		(void)SPIDEC_Status(rx >> 8, replayed, sizeof(replayed));
+		printf("    status  recorded [%s]  model [%s]\n", recorded, replayed);
+	}
+	if (((rx ^ p_record->rx) & 0x00FF) != 0)
+	{
+		(void)SPIDEC_Data(address, SPIDEC_RX, p_record->rx, recorded, sizeof(recorded));
+		(void)SPIDEC_Data(address, SPIDEC_RX, rx, replayed, sizeof(replayed));
+		printf("    data    recorded {%s}\n            model    {%s}\n", recorded, replayed);
+	}
+}
+
+static void Replay_Entry(void)
+{
+	uint64_t origin;
+	uint64_t elapsed = 0;
+	uint64_t frameTicks = 0;
+	uint64_t start;
+	uint64_t end;
+	uint32_t rx;
+	uint32_t i;
+
+	TIME_Init();
+	if (MC_MODE_INIT() != ME_RETURN_OK)
+	{
+		return;												//no record replayed
+	}
+	DSPI_Init(DSPI_NB, MASTER, DSPI_CLK, 1000000, 0);
+
+	origin = (replay.relative != 0) ? SIM_Now() : 0;
+	for (i = 0; i < replay.count; i++)
+	{
+		const SPIDEC_Record *p_record = &replay.p_records[i];
+
+		if (i != 0)
+		{
+			elapsed += (uint32_t)(p_record->time - replay.p_records[i - 1].time);	//TBL wraps after 21 s
+		}
+		else if (replay.relative == 0)
+		{
+			elapsed = p_record->time;
+		}
+		Replay_WaitUntil((origin + elapsed > frameTicks) ? origin + elapsed - frameTicks : 0);
+		start = SIM_Now();
+		DSPI_Send(p_record->dspi, DSPI_CS, p_record->tx);
+		rx = DSPI_Read(p_record->dspi) & 0xFFFF;
+		end = SIM_Now();
+		frameTicks = end - start;
+		end -= origin;
+		if (((end > elapsed) ? end - elapsed : elapsed - end) > replay.maxSkew)
+		{
+			replay.maxSkew = (end > elapsed) ? end - elapsed : elapsed - end;
+		}
+		replay.replayed++;
+		if ((p_record->flags & SPIDEC_FLAG_NO_ANSWER) != 0)
+		{
+			continue;
+		}
+		replay.compared++;
+		if (rx != p_record->rx)
+		{
+			Replay_Report(p_record, rx);
+		}
+	}
+}
+
+static int Replay_Load(const char *path)
+{
+	char line[256];
+	uint32_t capacity = 0;
+	FILE *f;
+
+	f = fopen(path, "r");
+	if (f == NULL)
+	{
+		perror(path);
+		return 1;
+	}
+	while (fgets(line, sizeof(line), f) != NULL)
+	{
+		if (replay.count == capacity)
+		{
+			capacity = (capacity != 0) ? capacity * 2 : 1024;
+			replay.p_records = realloc(replay.p_records, capacity * sizeof(SPIDEC_Record));
+			if (replay.p_records == NULL)
+			{
+				perror("simreplay");
+				fclose(f);
+				return 1;
+			}
+		}
+		replay.count += (uint32_t)SPIDEC_ReadLine(line, &replay.p_records[replay.count]);
+	}
+	fclose(f);
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	static const char *endName[3] = {"trace replayed", "time limit", "vector without handler"};
+	const char *p_path = 0;
+	uint64_t limit;
+	int result;
+	int arg;
+
+	for (arg = 1; arg < argc; arg++)
+	{
+		if (strcmp(argv[arg], "-r") == 0)
+		{
+			replay.relative = 1;
+		}
+		else
+		{
+			p_path = argv[arg];
+		}
+	}
+	if (p_path == 0)
+	{
+		fprintf(stderr, "usage: %s [-r] trace.txt\n", argv[0]);
+		return 2;
+	}
+	if (Replay_Load(p_path) != 0)
+	{
+		return 2;
+	}
+	if (replay.count == 0)
+	{
+		fprintf(stderr, "%s: no record\n", p_path);
+		return 2;
+	}
+	if (SIM_Init() != 0)
+	{
+		perror("register window");
+		return 2;
+	}
+	SIMDEV_Init();
+	SIMFS65_Init();
+	replayModel.name = "REPLAY";
+	replayModel.base = 0;
+	replayModel.size = 0;									//no registers: timed events only
+	replayModel.step = Replay_Step;
+	replayModel.due = SIM_NEVER;
+	SIM_AddModel(&replayModel);
+
+	limit = (replay.relative != 0) ? 0 : replay.p_records[0].time;
+	for (arg = 1; arg < (int)replay.count; arg++)
+	{
+		limit += (uint32_t)(replay.p_records[arg].time - replay.p_records[arg - 1].time);
+	}
+	result = SIM_Run(Replay_Entry, limit + (uint64_t)CLOCK_SYS_HZ);	//1 s margin
+
+	printf("end: %s at %.3f ms\n", endName[result], (double)SIM_Now() / (CLOCK_SYS_HZ / 1000));
+	printf("%u of %u records replayed, %u answers compared, %u differ, frame end within %.2f us\n",
+		   replay.replayed, replay.count, replay.compared, replay.mismatches,
+		   (double)replay.maxSkew / TIME_TICKS_PER_US);
+	printf("model: %u frames, %u parity, %u secure, %u request errors, %u good WD refreshes, %u resets\n",
+		   SIMFS65stats.frames, SIMFS65stats.parityErrors, SIMFS65stats.secureErrors,
+		   SIMFS65stats.requestErrors, SIMFS65stats.wdGood, SIMFS65stats.resets);
+	free(replay.p_records);
+	if ((result != SIM_END_RETURN) || (replay.replayed != replay.count))
+	{
+		return 2;
+	}
+	return (replay.mismatches != 0) ? 1 : 0;
+}
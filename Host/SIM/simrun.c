@@ -0,0 +1,442 @@
+/*******************************************************************************
+*
+* $File Name:       simrun.c$
+* @file             simrun.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Host run of the demo firmware on the register window simulator
+* @brief            Host run of the demo firmware on the register window simulator
+*
+*   Usage:
+*     simrun               - 200 ms of simulated time
+*     simrun 1000          - given simulated time [ms]
+*     simrun 1000 -v       - print the GUI records too
+*     simrun 200 -f vcore_uv@50 -f parity@60
+*                          - inject FS65xx faults at the given times [ms]
+*     simrun 20 -t trace.txt
+*                          - write the SPI trace of the target at the end
+*                            (text trace of Host/SPITRACE, see simreplay)
+*     simrun 200 -x 5      - lose the first GUI frame sent after the given
+*                            time [ms] on the link
+*
+*   src/main.c runs unchanged (main renamed Target_main). The UART output
+*   of the GUI link is decoded with the library of Host/GUI, the FS65xx on
+*   SPI_0 is the model of SIMFS65.c. The reaction of the driver to each
+*   injected fault (INTb edge, read of the reporting register) is printed.
+*   On a sequence gap of the GUI link, or if the first frame received has
+*   no keyframe, a keyframe is requested like the GUI does; at the end the decoded values are compared with the values known
+*   to the target (exit code 1 on a difference).
+*   The wake-up from LPOFF is a power-on reset of the MCU: the peripherals
+*   get their reset values, MC_RGM.DES reports F_POR and src/main.c runs
+*   again from its start, like after startup.S (which keeps the keep-alive
+*   RAM). Each run after such a reset must resume the FS65xx warm from the
+*   snapshot saved before the LPOFF (exit code 1 otherwise).
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Tool created
+BRNY001					      19/10/2026 	   Run_WriteTrace	  SPI trace of the target written to a text trace (-t)
+BRNY001					      19/10/2026 	   Run_PrintBoot	  Boot stages and critical path of src/main.c
+BRNY001					      19/10/2026 	   Run_UartSink	  GUI frame lost on the link (-x), keyframe request, decoded values checked
+BRNY001					      19/10/2026 	   main		  Unknown options rejected
+BRNY001					      19/10/2026 	   Run_PowerOnReset  LPOFF wake-up through the MCU power-on reset, warm resume checked
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MPC5744P_drv.h"
+#include "TIME.h"
+#include "DEFER.h"
+#include "SIM.h"
+#include "SIMDEV.h"
+#include "SIMFS65.h"
+#include "GUIDEC.h"
+#include "SPITRACE.h"
+#include "BOOT.h"
+#include "SPIDEC.h"
+#include "GUI.h"
+#include "FS65xx_driver.h"
+
+#define RUN_DEFAULT_MS			200
+
+int Target_main(void);
+
+static GUIDEC_Decoder guiDecoder;
+static int verbose;
+static uint64_t loseAt = SIM_NEVER;		///first frame after this time is lost on the link
+static uint32_t losing;					///1 - Bytes of the lost frame are skipped
+static uint32_t lostFrames;
+static uint32_t atDelimiter = 1;		///last Byte was a frame delimiter
+static uint64_t frames;					///decoded frames at the last check
+static uint64_t gaps;					///sequence gaps answered by a keyframe request
+static uint32_t keyframePending;		///keyframe requested, none received yet
+static uint32_t resets;					///power-on resets of the MCU (Vcore back after LPOFF)
+static uint32_t warmResumes;			///runs after a reset resumed from FS65_Vkam
+
+static int Run_PrintRecord(const GUIDEC_Record *record, void *context)
+{
+	(void)context;
+	if (verbose)
+	{
+		printf("  %10llu us  GUI %s 0x%02X = 0x%04X\n", (unsigned long long)record->time,
+			   (record->type == GUIDEC_REC_MEASURE) ? "MEAS" : "REG ", record->id, record->value);
+	}
+	return 0;
+}
+
+static void Run_UartSink(uint32_t linflex, uint8_t data)
+{
+	static const uint8_t keyframe[1] = {GUIDEC_CMD_KEYFRAME};
+	uint8_t request[16];
+	uint32_t length;
+
+	if (linflex != LINFLEX_UART_NB)
+	{
+		return;
+	}
+	if (atDelimiter && (SIM_Now() >= loseAt))
+	{
+		loseAt = SIM_NEVER;
+		losing = 1;
+		lostFrames++;
+	}
+	atDelimiter = (data == 0x00);
+	if (losing)
+	{
+		losing = !atDelimiter;
+		return;
+	}
+	(void)GUIDEC_Feed(&guiDecoder, &data, 1, Run_PrintRecord, 0);
+	if (guiDecoder.frames == frames)
+	{
+		return;
+	}
+	frames = guiDecoder.frames;
+	keyframePending &= (guiDecoder.keyframes == 0);
+	//joined without the first keyframe or a frame lost since
+	if ((guiDecoder.sequenceGaps != gaps) || ((guiDecoder.keyframes == 0) && !keyframePending))
+	{
+		gaps = guiDecoder.sequenceGaps;
+		keyframePending = 1;
+		length = (uint32_t)GUIDEC_BuildRequest(0x4B, keyframe, sizeof(keyframe), request);
+		request[length++] = 0x00;							//frame delimiter
+		(void)SIMDEV_UartReceive(LINFLEX_UART_NB, request, length);
+	}
+}
+
+/*
+*	Values rebuilt by the decoder against the values the target knows the
+*	GUI has. Frames still in the Tx ring buffer at the end differ.
+*/
+static uint32_t Run_CheckGui(void)
+{
+	uint32_t differ = 0;
+	uint32_t i;
+
+	for (i = 0; i < GUI_REG_NB; i++)
+	{
+		differ += (guiDecoder.reg[GUI_RegAddress[i]] != GUIstream.regShadow[i]);
+	}
+	for (i = 0; i < GUI_MEAS_NB; i++)
+	{
+		differ += (guiDecoder.meas[i] != GUIstream.measShadow[i]);
+	}
+	return differ;
+}
+
+static void Run_Entry(void)
+{
+	(void)Target_main();
+}
+
+/*
+*	State of the MCU after a power-on reset, up to main: reset values of the
+*	peripherals, reset cause, keep-alive RAM kept by startup.S (no
+*	F_VOR_DEST) and FS65_WarmResume cleared with the .bss.
+*/
+static void Run_PowerOnReset(void)
+{
+	resets++;
+	SIMDEV_Reset();
+	SIM_Open();
+	MC_RGM.DES.R = 0;
+	MC_RGM.DES.B.F_POR = 1;
+	SIM_Close();
+	FS65_WarmResume = 0;
+}
+
+#if SPITRACE_ENABLE
+/*
+*	Records of the target SPI trace still in the buffer, through the packed
+*	form of the GUI and CAN export.
+*/
+static int Run_WriteTrace(const char *path)
+{
+	SPITRACE_Record record;
+	SPIDEC_Record decoded;
+	uint8_t packed[SPITRACE_RECORD_SIZE];
+	uint32_t head = SPITRACEhead;
+	uint32_t sequence = (head > SPITRACE_SIZE) ? head - SPITRACE_SIZE : 0;
+	FILE *f;
+
+	f = fopen(path, "w");
+	if (f == NULL)
+	{
+		perror(path);
+		return 1;
+	}
+	fprintf(f, "# SPI trace: sequence time site dspi tx rx flags depth\n");
+	for (; sequence != head; sequence++)
+	{
+		if (SPITRACE_Copy(sequence, &record) != 0)
+		{
+			SPITRACE_Pack(&record, packed);
+			SPIDEC_Unpack(packed, &decoded);
+			decoded.sequence = sequence;
+			SPIDEC_WriteLine(f, &decoded);
+		}
+	}
+	fclose(f);
+	printf("SPI trace: records %u - %u of %u written to %s\n", (head > SPITRACE_SIZE) ? head - SPITRACE_SIZE : 0,
+		   head - 1, head, path);
+	return 0;
+}
+#endif
+
+/*
+*	Boot stages of src/main.c (BOOT.c): times from the start of BOOT_Run,
+*	waiting = end - start - CPU time (other stages or idle).
+*/
+static void Run_PrintBoot(void)
+{
+	uint8_t path[BOOT_STAGES_MAX];
+	uint32_t nb;
+	uint32_t i;
+
+	if (BOOTstages == 0)
+	{
+		return;
+	}
+	printf("\nboot stage  ready [us]  start [us]  end [us]    CPU [us]    calls  after\n");
+	for (i = 0; i < BOOTstages; i++)
+	{
+		const BOOT_StageStats *p_stats = &BOOTstats[i];
+
+		printf("%-10s  %-10.2f  %-10.2f  %-10.2f  %-10.2f  %-5u  %s\n", BOOTtable[i].name,
+			   (double)p_stats->ready / TIME_TICKS_PER_US, (double)p_stats->start / TIME_TICKS_PER_US,
+			   (double)p_stats->end / TIME_TICKS_PER_US, (double)p_stats->busyTicks / TIME_TICKS_PER_US,
+			   p_stats->calls, (p_stats->binding != BOOT_NONE) ? BOOTtable[p_stats->binding].name : "-");
+	}
+	printf("operational after %.2f us, critical path:", (double)BOOToperationalTicks / TIME_TICKS_PER_US);
+	nb = BOOT_CriticalPath(path, BOOT_STAGES_MAX);
+	for (i = 0; i < nb; i++)
+	{
+		printf("%s %s", (i != 0) ? " ->" : "", BOOTtable[path[i]].name);
+	}
+	printf("\n");
+}
+
+int main(int argc, char *argv[])
+{
+	static const char *endName[4] = {"main returned", "time limit", "vector without handler", "MCU reset"};
+	static const char *waitName[TIME_WAIT_NB] = {"ME_MODE", "FCCU_OPS", "ADC_VALID", "UART_STATE",
+		"UART_DTF", "LIN_DTF", "DSPI_TCF", "DSPI_RFDF", "DSPI_BATCH", "CAN_FREEZE", "CAN_START"};
+	uint64_t limitMs = RUN_DEFAULT_MS;
+	uint64_t end;
+#if SPITRACE_ENABLE
+	const char *p_trace = 0;
+#endif
+	SIM_Model *p_model;
+	uint32_t differ;
+	int result;
+	int arg;
+	uint32_t i;
+
+	if (SIM_Init() != 0)
+	{
+		perror("register window");
+		return 2;
+	}
+	SIMDEV_Init();
+	SIMDEV_UartSink = Run_UartSink;
+	SIMFS65_Init();
+	SIMFS65_VcoreOn = SIM_PowerOnReset;
+	GUIDEC_Init(&guiDecoder);
+
+	for (arg = 1; arg < argc; arg++)
+	{
+		if (strcmp(argv[arg], "-v") == 0)
+		{
+			verbose = 1;
+		}
+		else if ((strcmp(argv[arg], "-f") == 0) && (arg + 1 < argc))
+		{
+			char name[32];
+			unsigned long long atMs = 0;
+			uint32_t fault;
+
+			arg++;
+			if ((sscanf(argv[arg], "%31[a-z_0-9]@%llu", name, &atMs) != 2)
+				|| ((fault = SIMFS65_Fault(name)) >= SIMFS65_FAULT_NB))
+			{
+				fprintf(stderr, "bad fault %s (name@ms:", argv[arg]);
+				for (i = 0; i < SIMFS65_FAULT_NB; i++)
+				{
+					fprintf(stderr, " %s", SIMFS65_FaultName(i));
+				}
+				fprintf(stderr, ")\n");
+				return 2;
+			}
+			SIMFS65_InjectAt(fault, atMs * (CLOCK_SYS_HZ / 1000));
+		}
+		else if ((strcmp(argv[arg], "-t") == 0) && (arg + 1 < argc))
+		{
+#if SPITRACE_ENABLE
+			p_trace = argv[++arg];
+#else
+			fprintf(stderr, "no SPI trace in the target (SPITRACE_ENABLE 0)\n");
+			return 2;
+#endif
+		}
+		else if ((strcmp(argv[arg], "-x") == 0) && (arg + 1 < argc))
+		{
+			loseAt = strtoull(argv[++arg], 0, 0) * (CLOCK_SYS_HZ / 1000);
+		}
+		else
+		{
+			char *p_end;
+
+			limitMs = strtoull(argv[arg], &p_end, 10);
+			if ((argv[arg][0] < '0') || (argv[arg][0] > '9') || (*p_end != 0))
+			{
+				fprintf(stderr, "bad argument %s (usage: simrun [ms] [-v] [-f fault@ms] [-t trace.txt] [-x ms])\n",
+						argv[arg]);
+				return 2;
+			}
+		}
+	}
+
+	end = limitMs * (CLOCK_SYS_HZ / 1000);
+	result = SIM_Run(Run_Entry, end);
+	while (result == SIM_END_RESET)
+	{
+		Run_PowerOnReset();
+		result = SIM_Run(Run_Entry, (SIM_Now() < end) ? end - SIM_Now() : 0);
+		warmResumes += FS65_WarmResume;
+	}
+
+	printf("end: %s at %.3f ms", endName[result], (double)SIM_Now() / (CLOCK_SYS_HZ / 1000));
+	if (result == SIM_END_FAULT)
+	{
+		printf(" (vector %u)", SIMstats.faultVector);
+	}
+	printf(", %u MCU power-on resets (LPOFF wake-up), %u warm FS65xx resumes", resets, warmResumes);
+	printf("\n\naccesses: %llu reads, %llu writes, %llu unmodelled, %llu time base reads\n",
+		   (unsigned long long)SIMstats.reads, (unsigned long long)SIMstats.writes,
+		   (unsigned long long)SIMstats.unmodelled, (unsigned long long)SIMstats.timeReads);
+	printf("events: %llu, idle jumps: %llu (%.3f ms), deepest nesting: %u\n",
+		   (unsigned long long)SIMstats.events, (unsigned long long)SIMstats.idleJumps,
+		   (double)SIMstats.idleTicks / (CLOCK_SYS_HZ / 1000), SIMstats.maxNesting);
+
+	printf("\nblock        reads       writes\n");
+	for (p_model = SIM_Models(); p_model != 0; p_model = p_model->p_next)
+	{
+		if ((p_model->reads | p_model->writes) != 0)
+		{
+			printf("%-11s  %-10u  %u\n", p_model->name, p_model->reads, p_model->writes);
+		}
+	}
+
+	printf("\nvector  ISR calls\n");
+	for (i = 0; i < SIM_VECTORS; i++)
+	{
+		if (SIMstats.interrupts[i] != 0)
+		{
+			printf("%-6u  %u\n", i, SIMstats.interrupts[i]);
+		}
+	}
+
+	printf("\ndevices: %u SPI frames (%u lost), %u ADC conversions, PIT %u/%u/%u/%u\n",
+		   SIMDEVstats.spiFrames, SIMDEVstats.spiOverruns, SIMDEVstats.adcConversions,
+		   SIMDEVstats.pitExpiries[0], SIMDEVstats.pitExpiries[1],
+		   SIMDEVstats.pitExpiries[2], SIMDEVstats.pitExpiries[3]);
+	printf("         %u UART Bytes sent, %u received (%u lost), %u CAN frames, %u EIRQ edges\n",
+		   SIMDEVstats.uartTxBytes, SIMDEVstats.uartRxBytes, SIMDEVstats.uartOverruns,
+		   SIMDEVstats.canFrames, SIMDEVstats.extIrqs);
+
+	printf("\nwait        count       timeouts    max [us]\n");
+	for (i = 0; i < TIME_WAIT_NB; i++)
+	{
+		printf("%-10s  %-10u  %-10u  %.2f\n", waitName[i], TIMEwait[i].count, TIMEwait[i].timeouts,
+			   (double)TIMEwait[i].maxTicks / TIME_TICKS_PER_US);
+	}
+
+	printf("\ndeferred    posted      run         dropped\n");
+	for (i = 0; i < DEFER_LEVELS; i++)
+	{
+		printf("level %-4u  %-10u  %-10u  %u\n", i, DEFERqueue[i].tail, DEFERqueue[i].head, DEFERqueue[i].dropped);
+	}
+
+	Run_PrintBoot();
+
+	printf("\nFS65: %u frames (%u reads, %u writes), INIT main end at frame %u, INIT_FS end at frame %u\n",
+		   SIMFS65stats.frames, SIMFS65stats.reads, SIMFS65stats.writes,
+		   SIMFS65stats.initMainEnd, SIMFS65stats.initFsEnd);
+	printf("      errors: %u parity, %u security, %u request, %u clock\n",
+		   SIMFS65stats.parityErrors, SIMFS65stats.secureErrors, SIMFS65stats.requestErrors,
+		   SIMFS65stats.clockErrors);
+	printf("      WD: %u good, %u bad data, %u bad timing, %u timeouts, %u resets\n",
+		   SIMFS65stats.wdGood, SIMFS65stats.wdBadData, SIMFS65stats.wdBadTiming,
+		   SIMFS65stats.wdTimeouts, SIMFS65stats.resets);
+	printf("      FSxB: %u releases, %u refused; INTb: %u pulses, %u inhibited; LPOFF: %u\n",
+		   SIMFS65stats.releases, SIMFS65stats.releaseErrors, SIMFS65stats.intPulses,
+		   SIMFS65stats.intInhibited, SIMFS65stats.lpoff);
+
+	printf("\nfault       injected    observed    INTb [us]   last [us]   max [us]\n");
+	for (i = 0; i < SIMFS65_FAULT_NB; i++)
+	{
+		const SIMFS65_Reaction *p_reaction = &SIMFS65stats.reaction[i];
+
+		if (p_reaction->injected != 0)
+		{
+			char intb[16] = "-";
+
+			if (p_reaction->intb != 0)
+			{
+				snprintf(intb, sizeof(intb), "%.2f", (double)p_reaction->intbTicks / TIME_TICKS_PER_US);
+			}
+			printf("%-10s  %-10u  %-10u  %-10s  %-10.2f  %.2f\n", SIMFS65_FaultName(i),
+				   p_reaction->injected, p_reaction->observed, intb,
+				   (double)p_reaction->lastTicks / TIME_TICKS_PER_US,
+				   (double)p_reaction->maxTicks / TIME_TICKS_PER_US);
+		}
+	}
+
+	printf("\nGUI link: %llu frames, %llu records, %llu CRC errors, %llu sequence gaps, %llu keyframes\n",
+		   (unsigned long long)guiDecoder.frames, (unsigned long long)guiDecoder.records,
+		   (unsigned long long)guiDecoder.crcErrors, (unsigned long long)guiDecoder.sequenceGaps,
+		   (unsigned long long)guiDecoder.keyframes);
+	differ = Run_CheckGui();
+	printf("          %u frames lost on the link, %u dropped by the target, %u of %u decoded values differ\n",
+		   lostFrames, GUIstream.droppedFrames, differ, (uint32_t)(GUI_REG_NB + GUI_MEAS_NB));
+#if SPITRACE_ENABLE
+	if ((p_trace != 0) && (Run_WriteTrace(p_trace) != 0))
+	{
+		return 2;
+	}
+#endif
+	return ((result == SIM_END_FAULT) || (differ != 0) || (warmResumes != resets)) ? 1 : 0;
+}
@@ -0,0 +1,564 @@
+/*******************************************************************************
+*
+* $File Name:       simwcrt.c$
+* @file             simwcrt.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Worst-case response times of the ISR set on the register window simulator
+* @brief            Worst-case response times of the ISR set on the register window simulator
+*
+*   Usage:
+*     simwcrt                          - 150 ms with the default arrivals
+*     simwcrt 500 -a intb:2000:1500 -a uart:3000 -s 7
+*                                      - given simulated time [ms], arrival
+*                                        patterns and seed of the jitter
+*     simwcrt -d 496:80                - deadline of a vector [us]
+*
+*   Arrival pattern source:period[:jitter] [us], release k is at
+*   k * period + random(0 .. jitter):
+*     intb  - FS65xx IO_0 edge (SIMFS65_FAULT_IO): INTb, FS65_IsrSIUL
+*     uart  - GUI read request of DEVICE_ID on the GUI link: UART Rx bytes,
+*             the response on UART Tx
+*     adc   - hardware trigger of the normal chain of ADC_NB: EOC ISR
+*     lin   - expiry of the PIT channel PIT_LIN_CH: LIN_IsrTick at
+*             INT_LIN_PRIORITY, the level of the LIN header interrupts
+*     batch - GUI READ_ALL request on the GUI link: FS65_SendBatch of all
+*             GUI registers, INT_CEIL_PRIORITY held per FS65_BATCH_CHUNK
+*   The PIT, the timer wheel, the deferred work and the GUI stream keep
+*   the load of src/main.c (run unchanged, main renamed Target_main).
+*
+*   Per vector the virtual INTC of SIM.c measures the arrivals, the
+*   response and the execution time; per priority the blocking by the CPR
+*   raises of lower levels (INT_CEIL_PRIORITY of the FS65 SPI functions,
+*   INT_UART_TX_PRIORITY, ...). The analytical response time is the fixed
+*   point of
+*       R = C + B + sum over the other vectors of priority >= own
+*               of ceil(R / T) * C
+*   with T the minimal measured inter-arrival time (one activation if the
+*   vector arrived once), C the longest measured execution time and B the
+*   longest measured blocking of the priority, at least the bound of one
+*   FS65_SendBatch chunk (FS65_BATCH_CHUNK SPI frames) for the priorities up
+*   to INT_CEIL_PRIORITY. Equal priorities interfere
+*   (the INTC does not preempt them, either may be served first).
+*   The deadline of the Rx and INTb vectors is their minimal inter-arrival
+*   time (the next event overwrites the data or merges with the flag), the
+*   other vectors have none unless given by -d. The WD
+*   refresh of FS65_IsrPIT_WD has to fall in the open half of the FS65xx
+*   window W after the previous one: with the PIT period P the response may
+*   vary by min(W - P, P - W / 2), its deadline is the shortest measured
+*   response plus this jitter.
+*   Exit code 1 if an observed or analytical response misses its deadline
+*   or if a UART Rx byte is lost (buffer overrun of the LINFlexD).
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Tool created
+BRNY001					      19/10/2026 	   main		  Lost UART Rx bytes fail the run
+BRNY001					      19/10/2026 	   Wcrt_Fire	  LIN tick arrivals
+BRNY001					      19/10/2026 	   main		  Unknown options rejected
+BRNY001					      19/10/2026 	   Wcrt_Analyse  Blocking bound of the FS65_SendBatch chunks, GUI READ_ALL arrivals
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "derivative.h"
+#include "FS65xx.h"
+#include "FS65xx_driver.h"
+#include "MPC5744P_drv.h"
+#include "DEFER.h"
+#include "TIME.h"
+#include "SIM.h"
+#include "SIMDEV.h"
+#include "SIMFS65.h"
+#include "GUIDEC.h"
+
+#define WCRT_DEFAULT_MS			150
+#define WCRT_HORIZON_MS			1000		///analytical response above this is unbounded
+#define WCRT_SOURCES			8
+#define WCRT_WD_VECTOR			226			///PIT_0 channel 0 (PIT_WD_CH)
+#define WCRT_TICKS_US(us)		((uint64_t)(us) * TIME_TICKS_PER_US)
+
+#define WCRT_SRC_INTB			0
+#define WCRT_SRC_UART			1
+#define WCRT_SRC_ADC			2
+#define WCRT_SRC_LIN			3
+#define WCRT_SRC_BATCH			4
+#define WCRT_SRC_NB				5
+
+typedef struct {
+	uint32_t	source;				///WCRT_SRC_xxx
+	uint64_t	period;				///[core ticks]
+	uint64_t	jitter;				///[core ticks]
+	uint64_t	start;				///start of the current period
+	uint64_t	due;				///release in the current period
+	uint32_t	releases;
+} Wcrt_Arrival;
+
+//Deadline of a vector
+#define WCRT_DL_NONE			0			///next request caused by the service (Tx, timer, work queue)
+#define WCRT_DL_ARRIVAL			1			///minimal inter-arrival time (next event overwrites the flag or the data)
+#define WCRT_DL_WD				2			///allowed jitter of the WD refresh in the window
+
+typedef struct {
+	uint32_t	vector;
+	const char	*name;
+	uint32_t	deadline;			///WCRT_DL_xxx
+} Wcrt_Vector;
+
+int Target_main(void);
+
+static const char *sourceName[WCRT_SRC_NB] = {"intb", "uart", "adc", "lin", "batch"};
+static const char *defaultArrivals[] = {"intb:7000:3000", "uart:5000:2000", "adc:2000:1000", "lin:1000:500",
+										"batch:20000:5000"};
+
+static const Wcrt_Vector vectorName[] = {
+	{DEFER_SW_IRQ, "DEFER", WCRT_DL_NONE}, {226, "PIT_WD", WCRT_DL_WD}, {227, "PIT_TIMER", WCRT_DL_NONE},
+	{229, "PIT_LIN", WCRT_DL_ARRIVAL}, {243, "SIUL_INTb", WCRT_DL_ARRIVAL}, {376, "LIN_RX", WCRT_DL_ARRIVAL},
+	{377, "LIN_TX", WCRT_DL_NONE}, {378, "LIN_ERR", WCRT_DL_NONE}, {380, "UART_RX", WCRT_DL_ARRIVAL},
+	{381, "UART_TX", WCRT_DL_NONE}, {496, "ADC0_EOC", WCRT_DL_NONE},		//ADC results kept per channel (CDR)
+	{520, "CAN0_ERR", WCRT_DL_NONE}, {521, "CAN0_BOFF", WCRT_DL_NONE}
+};
+
+static Wcrt_Arrival arrival[WCRT_SOURCES];
+static uint32_t nbArrivals;
+static SIM_Model arrivalModel;
+static uint32_t seed = 1;
+static uint64_t deadlineUs[SIM_VECTORS];		///given by -d, 0 - by WCRT_DL_xxx
+static uint8_t request[32];
+static uint32_t requestLength;
+static uint8_t batchRequest[16];
+static uint32_t batchLength;
+
+/*==================================================================================================
+*   Arrival pattern generator
+==================================================================================================*/
+
+static uint64_t Wcrt_Random(uint64_t range)
+{
+	seed = seed * 1103515245u + 12345u;
+	return (range != 0) ? ((uint64_t)(seed >> 8) * range) >> 24 : 0;
+}
+
+static void Wcrt_Fire(uint32_t source)
+{
+	switch (source)
+	{
+	case WCRT_SRC_INTB:
+		SIMFS65_Inject(SIMFS65_FAULT_IO);
+		break;
+	case WCRT_SRC_UART:
+		(void)SIMDEV_UartReceive(LINFLEX_UART_NB, request, requestLength);
+		break;
+	case WCRT_SRC_LIN:
+		SIMDEV_PitFire(PIT_LIN_CH);
+		break;
+	case WCRT_SRC_BATCH:
+		(void)SIMDEV_UartReceive(LINFLEX_UART_NB, batchRequest, batchLength);
+		break;
+	default:
+		SIMDEV_AdcTrigger(ADC_NB);
+		break;
+	}
+}
+
+/***************************************************************************//*!
+*   @brief Model step: fires the due sources, plans their next release.
+********************************************************************************/
+static void Wcrt_Step(SIM_Model *p_model, uint64_t now)
+{
+	uint64_t next = SIM_NEVER;
+	uint32_t i;
+
+	for (i = 0; i < nbArrivals; i++)
+	{
+		if (arrival[i].due <= now)
+		{
+			Wcrt_Fire(arrival[i].source);
+			arrival[i].releases++;
+			arrival[i].start += arrival[i].period;
+			arrival[i].due = arrival[i].start + Wcrt_Random(arrival[i].jitter);
+		}
+		if (arrival[i].due < next)
+		{
+			next = arrival[i].due;
+		}
+	}
+	SIM_Wake(p_model, next);
+}
+
+static int Wcrt_AddArrival(const char *p_text)
+{
+	char name[16];
+	unsigned long long periodUs = 0;
+	unsigned long long jitterUs = 0;
+	uint32_t source;
+
+	if ((nbArrivals >= WCRT_SOURCES) ||
+		(sscanf(p_text, "%15[a-z]:%llu:%llu", name, &periodUs, &jitterUs) < 2) || (periodUs == 0))
+	{
+		return -1;
+	}
+	for (source = 0; source < WCRT_SRC_NB; source++)
+	{
+		if (strcmp(name, sourceName[source]) == 0)
+		{
+			break;
+		}
+	}
+	if ((source >= WCRT_SRC_NB) || (jitterUs >= periodUs))
+	{
+		return -1;
+	}
+	arrival[nbArrivals].source = source;
+	arrival[nbArrivals].period = WCRT_TICKS_US(periodUs);
+	arrival[nbArrivals].jitter = WCRT_TICKS_US(jitterUs);
+	nbArrivals++;
+	return 0;
+}
+
+/*==================================================================================================
+*   Response-time analysis
+==================================================================================================*/
+
+static uint32_t Wcrt_Priority(uint32_t vector)
+{
+	uint32_t priority;
+
+	SIM_Open();
+	priority = INTC_0.PSR[vector].B.PRIN;
+	SIM_Close();
+	return priority;
+}
+
+static const Wcrt_Vector *Wcrt_Describe(uint32_t vector)
+{
+	static const Wcrt_Vector unknown = {0, "-", WCRT_DL_NONE};
+	uint32_t i;
+
+	for (i = 0; i < sizeof(vectorName) / sizeof(vectorName[0]); i++)
+	{
+		if (vectorName[i].vector == vector)
+		{
+			return &vectorName[i];
+		}
+	}
+	return &unknown;
+}
+
+/***************************************************************************//*!
+*   @brief Blocking of a priority [core ticks].
+*	@return Longest measured blocking, for the priorities up to
+*			INT_CEIL_PRIORITY at least FS65_BATCH_CHUNK SPI frames of the
+*			longest measured frame time (one FS65_SendBatch chunk).
+********************************************************************************/
+static uint64_t Wcrt_Blocking(uint32_t priority)
+{
+	uint64_t chunk = 0;
+
+	if ((priority <= INT_CEIL_PRIORITY) && (SIMDEVstats.spiFrames != 0))
+	{
+		chunk = FS65_BATCH_CHUNK * ((SIMDEVstats.spiTicks + SIMDEVstats.spiFrames - 1) / SIMDEVstats.spiFrames);
+	}
+	return (SIMstats.blocking[priority] > chunk) ? SIMstats.blocking[priority] : chunk;
+}
+
+/***************************************************************************//*!
+*   @brief Analytical response time of a vector [core ticks].
+*	@return Fixed point of the response-time recurrence, SIM_NEVER if above
+*			WCRT_HORIZON_MS (interference not bounded).
+********************************************************************************/
+static uint64_t Wcrt_Analyse(uint32_t vector)
+{
+	const SIM_Response *p_own = &SIMstats.response[vector];
+	uint32_t priority = Wcrt_Priority(vector);
+	uint64_t base = p_own->maxExec + Wcrt_Blocking(priority);
+	uint64_t response = base;
+	uint64_t next;
+	uint32_t other;
+
+	for (;;)
+	{
+		next = base;
+		for (other = 0; other < SIM_VECTORS; other++)
+		{
+			const SIM_Response *p_other = &SIMstats.response[other];
+
+			if ((other == vector) || (p_other->arrivals == 0) || (Wcrt_Priority(other) < priority))
+			{
+				continue;
+			}
+			if (p_other->minInterarrival == SIM_NEVER)
+			{
+				next += p_other->maxExec;
+			}
+			else
+			{
+				next += ((response + p_other->minInterarrival - 1) / p_other->minInterarrival) * p_other->maxExec;
+			}
+		}
+		if (next > WCRT_TICKS_US(1000 * WCRT_HORIZON_MS))
+		{
+			return SIM_NEVER;
+		}
+		if (next == response)
+		{
+			return response;
+		}
+		response = next;
+	}
+}
+
+static void Wcrt_Us(char *p_text, size_t size, uint64_t ticks)
+{
+	if (ticks == SIM_NEVER)
+	{
+		snprintf(p_text, size, "-");
+	}
+	else
+	{
+		snprintf(p_text, size, "%.2f", (double)ticks / TIME_TICKS_PER_US);
+	}
+}
+
+/***************************************************************************//*!
+*   @brief Deadline of the WD refresh: shortest response plus the allowed
+*			jitter of the refresh in the FS65xx window, SIM_NEVER if unknown.
+********************************************************************************/
+static uint64_t Wcrt_WdDeadline(uint64_t *p_window, uint64_t *p_jitter)
+{
+	const SIM_Response *p_wd = &SIMstats.response[WCRT_WD_VECTOR];
+	uint64_t window = SIMFS65stats.wdWindow;
+	uint64_t period = p_wd->minInterarrival;
+	uint64_t jitter;
+
+	*p_window = window;
+	*p_jitter = SIM_NEVER;
+	if ((window == 0) || (period == SIM_NEVER) || (p_wd->minResponse == SIM_NEVER) ||
+		(period >= window) || (2 * period < window))
+	{
+		return SIM_NEVER;
+	}
+	jitter = window - period;
+	if (period - window / 2 < jitter)
+	{
+		jitter = period - window / 2;
+	}
+	*p_jitter = jitter;
+	return p_wd->minResponse + jitter;
+}
+
+/*==================================================================================================
+*   Run
+==================================================================================================*/
+
+static void Wcrt_Entry(void)
+{
+	(void)Target_main();
+}
+
+int main(int argc, char *argv[])
+{
+	static const char *endName[3] = {"main returned", "time limit", "vector without handler"};
+	static const uint8_t readDeviceId[2] = {GUIDEC_CMD_READ, DEVICE_ID_ADR};
+	static const uint8_t readAll[1] = {GUIDEC_CMD_READ_ALL};
+	uint64_t limitMs = WCRT_DEFAULT_MS;
+	uint64_t wdWindow = 0;
+	uint64_t wdJitter = 0;
+	uint64_t wdDeadline;
+	uint32_t misses = 0;
+	uint32_t vector;
+	uint32_t i;
+	int result;
+	int arg;
+
+	for (arg = 1; arg < argc; arg++)
+	{
+		if ((strcmp(argv[arg], "-a") == 0) && (arg + 1 < argc))
+		{
+			if (Wcrt_AddArrival(argv[++arg]) != 0)
+			{
+				fprintf(stderr, "bad arrival %s (source:period_us[:jitter_us], jitter < period, sources intb uart adc lin)\n",
+						argv[arg]);
+				return 2;
+			}
+		}
+		else if ((strcmp(argv[arg], "-d") == 0) && (arg + 1 < argc))
+		{
+			unsigned int number = SIM_VECTORS;
+			unsigned long long us = 0;
+
+			arg++;
+			if ((sscanf(argv[arg], "%u:%llu", &number, &us) != 2) || (number >= SIM_VECTORS))
+			{
+				fprintf(stderr, "bad deadline %s (vector:us)\n", argv[arg]);
+				return 2;
+			}
+			deadlineUs[number] = us;
+		}
+		else if ((strcmp(argv[arg], "-s") == 0) && (arg + 1 < argc))
+		{
+			seed = (uint32_t)strtoul(argv[++arg], 0, 0);
+		}
+		else
+		{
+			char *p_end;
+
+			limitMs = strtoull(argv[arg], &p_end, 10);
+			if ((argv[arg][0] < '0') || (argv[arg][0] > '9') || (*p_end != 0))
+			{
+				fprintf(stderr, "bad argument %s (usage: simwcrt [ms] [-a source:period_us[:jitter_us]] [-d vector:us] [-s seed])\n",
+						argv[arg]);
+				return 2;
+			}
+		}
+	}
+	if (nbArrivals == 0)
+	{
+		for (i = 0; i < sizeof(defaultArrivals) / sizeof(defaultArrivals[0]); i++)
+		{
+			(void)Wcrt_AddArrival(defaultArrivals[i]);
+		}
+	}
+
+	if (SIM_Init() != 0)
+	{
+		perror("register window");
+		return 2;
+	}
+	SIMDEV_Init();
+	SIMFS65_Init();
+	requestLength = (uint32_t)GUIDEC_BuildRequest(0x5A, readDeviceId, sizeof(readDeviceId), request);
+	request[requestLength++] = 0x00;							//frame delimiter
+	batchLength = (uint32_t)GUIDEC_BuildRequest(0xA5, readAll, sizeof(readAll), batchRequest);
+	batchRequest[batchLength++] = 0x00;
+
+	memset(&arrivalModel, 0, sizeof(arrivalModel));
+	arrivalModel.name = "ARRIVAL";
+	arrivalModel.step = Wcrt_Step;
+	arrivalModel.due = SIM_NEVER;
+	for (i = 0; i < nbArrivals; i++)
+	{
+		arrival[i].start = arrival[i].period;
+		arrival[i].due = arrival[i].start + Wcrt_Random(arrival[i].jitter);
+		if (arrival[i].due < arrivalModel.due)
+		{
+			arrivalModel.due = arrival[i].due;
+		}
+	}
+	SIM_AddModel(&arrivalModel);
+
+	result = SIM_Run(Wcrt_Entry, limitMs * (CLOCK_SYS_HZ / 1000));
+	printf("end: %s at %.3f ms\n", endName[result], (double)SIM_Now() / (CLOCK_SYS_HZ / 1000));
+
+	printf("\nsource  period [us]  jitter [us]  releases\n");
+	for (i = 0; i < nbArrivals; i++)
+	{
+		printf("%-6s  %-11.0f  %-11.0f  %u\n", sourceName[arrival[i].source],
+			   (double)arrival[i].period / TIME_TICKS_PER_US, (double)arrival[i].jitter / TIME_TICKS_PER_US,
+			   arrival[i].releases);
+	}
+
+	printf("\npriority  blocking [us]  bound [us]\n");
+	for (i = SIM_PRIORITIES - 1; i > 0; i--)
+	{
+		if (Wcrt_Blocking(i) != 0)
+		{
+			printf("%-8u  %-13.2f  %.2f\n", i, (double)SIMstats.blocking[i] / TIME_TICKS_PER_US,
+				   (double)Wcrt_Blocking(i) / TIME_TICKS_PER_US);
+		}
+	}
+
+	wdDeadline = Wcrt_WdDeadline(&wdWindow, &wdJitter);
+	printf("\nvector  name        prio  arrivals  served    T [us]    C [us]    B [us]    "
+		   "latency   R obs     R ana     D [us]\n");
+	for (vector = 0; vector < SIM_VECTORS; vector++)
+	{
+		const SIM_Response *p_response = &SIMstats.response[vector];
+		uint32_t priority = Wcrt_Priority(vector);
+		uint64_t analysed;
+		uint64_t deadline;
+		char text[7][16];
+		const char *p_verdict = "";
+
+		if ((p_response->arrivals == 0) || (priority == 0))
+		{
+			continue;
+		}
+		analysed = Wcrt_Analyse(vector);
+		switch (Wcrt_Describe(vector)->deadline)
+		{
+		case WCRT_DL_ARRIVAL:	deadline = p_response->minInterarrival; break;
+		case WCRT_DL_WD:		deadline = wdDeadline; break;
+		default:				deadline = SIM_NEVER; break;
+		}
+		if (deadlineUs[vector] != 0)
+		{
+			deadline = WCRT_TICKS_US(deadlineUs[vector]);
+		}
+		if (deadline != SIM_NEVER)
+		{
+			if ((p_response->minResponse != SIM_NEVER) && (p_response->maxResponse > deadline))
+			{
+				p_verdict = "  MISS";
+				misses++;
+			}
+			else if (analysed > deadline)
+			{
+				p_verdict = "  MISS (analytical)";
+				misses++;
+			}
+		}
+		Wcrt_Us(text[0], sizeof(text[0]), p_response->minInterarrival);
+		Wcrt_Us(text[1], sizeof(text[1]), p_response->maxExec);
+		Wcrt_Us(text[2], sizeof(text[2]), Wcrt_Blocking(priority));
+		Wcrt_Us(text[3], sizeof(text[3]), (p_response->served != 0) ? p_response->maxLatency : SIM_NEVER);
+		Wcrt_Us(text[4], sizeof(text[4]), (p_response->served != 0) ? p_response->maxResponse : SIM_NEVER);
+		Wcrt_Us(text[5], sizeof(text[5]), analysed);
+		Wcrt_Us(text[6], sizeof(text[6]), deadline);
+		printf("%-6u  %-10s  %-4u  %-8u  %-8u  %-8s  %-8s  %-8s  %-8s  %-8s  %-8s  %s%s\n",
+			   vector, Wcrt_Describe(vector)->name, priority, p_response->arrivals, p_response->served,
+			   text[0], text[1], text[2], text[3], text[4], text[5], text[6], p_verdict);
+	}
+
+	if (wdDeadline != SIM_NEVER)
+	{
+		const SIM_Response *p_wd = &SIMstats.response[WCRT_WD_VECTOR];
+
+		printf("\nWD refresh: window %.0f us, PIT period %.0f us, allowed jitter %.2f us, "
+			   "observed jitter %.2f us\n",
+			   (double)wdWindow / TIME_TICKS_PER_US, (double)p_wd->minInterarrival / TIME_TICKS_PER_US,
+			   (double)wdJitter / TIME_TICKS_PER_US,
+			   (double)(p_wd->maxResponse - p_wd->minResponse) / TIME_TICKS_PER_US);
+	}
+	else
+	{
+		printf("\nWD refresh: deadline unknown (no WD window with the PIT period between W / 2 and W)\n");
+	}
+	printf("FS65 WD: %u good, %u bad timing, %u timeouts; UART: %u Bytes received, %u lost\n",
+		   SIMFS65stats.wdGood, SIMFS65stats.wdBadTiming, SIMFS65stats.wdTimeouts,
+		   SIMDEVstats.uartRxBytes, SIMDEVstats.uartOverruns);
+	printf("%u deadline misses\n", misses);
+	if (SIMDEVstats.uartOverruns != 0)
+	{
+		misses++;
+	}
+
+	if (result == SIM_END_FAULT)
+	{
+		return 2;
+	}
+	return (misses != 0) ? 1 : 0;
+}
@@ -0,0 +1,262 @@
+/*******************************************************************************
+*
+* $File Name:       SPIDEC.c$
+* @file             SPIDEC.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Host decoder of the SPI trace records (FS65xx frames)
+* @brief            Host decoder of the SPI trace records (FS65xx frames)
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/****************************************************************************//*!
+*
+*  @mainpage Host decoder of the SPI trace records
+*
+*  @section Intro Introduction
+*
+*	This library unpacks the records of the target SPI trace
+*	(src/Modules/SPITRACE.c) and decodes the FS65xx frames: command (read or
+*	write, register, parity of the write frames, bit fields of the data
+*	Byte) and answer (general status Byte, bit fields of the register
+*	content). The register and bit field tables (fs65regs.h) are generated
+*	from include/FS65xx.h by fs65regs.awk, so the decoder follows the
+*	driver header.
+*
+*	The text trace (one record per line, SPIDEC_WriteLine) is written by
+*	spidump and read back by the replay engine of Host/SIM (simreplay).
+*
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : Host (PC)
+*   Dependencies         : C99 standard library.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Decoder created
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#include <stdarg.h>
+#include <string.h>
+#include "SPIDEC.h"
+#include "fs65regs.h"
+
+#define SPIDEC_NB(table)	(sizeof(table) / sizeof((table)[0]))
+
+static const char *SPIDEC_StatusName[8] = {"Vothers_G", "Vcore_G", "Vpre_G", "IO_G", "LIN_G", "CAN_G", "WU", "SPI_G"};
+
+/***************************************************************************//*!
+*   @brief Appends formatted text, the output is always terminated.
+*	@return 	New length (at most size - 1).
+********************************************************************************/
+static size_t SPIDEC_Append(char *dst, size_t size, size_t length, const char *format, ...)
+{
+	va_list args;
+	int n;
+
+	if (length + 1 >= size)
+	{
+		return length;
+	}
+	va_start(args, format);
+	n = vsnprintf(&dst[length], size - length, format, args);
+	va_end(args);
+	if (n < 0)
+	{
+		return length;
+	}
+	length += (size_t)n;
+	return (length >= size) ? size - 1 : length;
+}
+
+/***************************************************************************//*!
+*   @brief Unpacks a record (SPITRACE_Pack, most significant Byte first).
+* 	@par Description
+*					The sequence number of the packed record has 16 bits, the
+*					reader extends it (see spidump).
+********************************************************************************/
+void SPIDEC_Unpack(const uint8_t *packed, SPIDEC_Record *record)
+{
+	record->time = ((uint32_t)packed[0] << 24) | ((uint32_t)packed[1] << 16) | ((uint32_t)packed[2] << 8) | packed[3];
+	record->site = ((uint32_t)packed[4] << 24) | ((uint32_t)packed[5] << 16) | ((uint32_t)packed[6] << 8) | packed[7];
+	record->tx = (uint16_t)((packed[8] << 8) | packed[9]);
+	record->rx = (uint16_t)((packed[10] << 8) | packed[11]);
+	record->sequence = (uint32_t)((packed[12] << 8) | packed[13]);
+	record->dspi = packed[14] & SPIDEC_FLAG_DSPI;
+	record->flags = packed[14] & (uint8_t)~SPIDEC_FLAG_DSPI;
+	record->depth = packed[15];
+}
+
+/***************************************************************************//*!
+*   @brief Returns the name of a register (FS65xx.h *_ADR), 0 - unknown.
+********************************************************************************/
+const char *SPIDEC_RegisterName(uint32_t address)
+{
+	size_t i;
+
+	for (i = 0; i < SPIDEC_NB(SPIDEC_RegisterTable); i++)
+	{
+		if (SPIDEC_RegisterTable[i].address == address)
+		{
+			return SPIDEC_RegisterTable[i].name;
+		}
+	}
+	return 0;
+}
+
+/***************************************************************************//*!
+*   @brief Checks the parity of a write frame (odd number of ones).
+*	@return 	1 - parity correct, 0 - parity error.
+********************************************************************************/
+int SPIDEC_Parity(uint32_t tx)
+{
+	uint32_t ones = 0;
+
+	for (tx &= 0xFFFF; tx != 0; tx &= tx - 1)
+	{
+		ones++;
+	}
+	return (int)(ones & 1);
+}
+
+/***************************************************************************//*!
+*   @brief Decodes the data Byte with the bit fields of a register.
+*	@param[in] direction - SPIDEC_TX (command) or SPIDEC_RX (answer).
+*	@return 	Length of the text, "NAME=value" separated by spaces, the raw
+*				Byte if the register has no layout.
+********************************************************************************/
+size_t SPIDEC_Data(uint32_t address, uint32_t direction, uint32_t data, char *dst, size_t size)
+{
+	size_t length = 0;
+	size_t i;
+
+	dst[0] = 0;
+	for (i = 0; i < SPIDEC_NB(SPIDEC_FieldTable); i++)
+	{
+		const SPIDEC_Field *p_field = &SPIDEC_FieldTable[i];
+
+		if ((p_field->address == address) && (p_field->direction == direction))
+		{
+			length = SPIDEC_Append(dst, size, length, "%s%s=%u", (length != 0) ? " " : "", p_field->name,
+								   (data >> p_field->lsb) & ((1U << p_field->width) - 1));
+		}
+	}
+	if (length == 0)
+	{
+		length = SPIDEC_Append(dst, size, length, "0x%02X", data & 0xFF);
+	}
+	return length;
+}
+
+/***************************************************************************//*!
+*   @brief Decodes the general status Byte of an answer.
+*	@return 	Length of the text, the names of the set flags ("-" if none).
+********************************************************************************/
+size_t SPIDEC_Status(uint32_t status, char *dst, size_t size)
+{
+	size_t length = 0;
+	int i;
+
+	dst[0] = 0;
+	for (i = 7; i >= 0; i--)
+	{
+		if ((status & (1U << i)) != 0)
+		{
+			length = SPIDEC_Append(dst, size, length, "%s%s", (length != 0) ? " " : "", SPIDEC_StatusName[i]);
+		}
+	}
+	if (length == 0)
+	{
+		length = SPIDEC_Append(dst, size, length, "-");
+	}
+	return length;
+}
+
+/***************************************************************************//*!
+*   @brief Decodes one frame: command and answer.
+* 	@par Description
+*					"W|R REGISTER {fields} -> [status] {fields}", the answer
+*					carries the content of the addressed register (Rx layout)
+*					for the read and the write commands.
+*	@return 	Length of the text.
+********************************************************************************/
+size_t SPIDEC_Frame(uint32_t tx, uint32_t rx, uint32_t flags, char *dst, size_t size)
+{
+	char text[SPIDEC_TEXT_SIZE];
+	uint32_t write = (tx >> 15) & 1;
+	uint32_t address = (tx >> 9) & 0x3F;
+	const char *p_name = SPIDEC_RegisterName(address);
+	size_t length = 0;
+
+	dst[0] = 0;
+	if (p_name != 0)
+	{
+		length = SPIDEC_Append(dst, size, length, "%c %s", write ? 'W' : 'R', p_name);
+	}
+	else
+	{
+		length = SPIDEC_Append(dst, size, length, "%c 0x%02X", write ? 'W' : 'R', address);
+	}
+	if (write != 0)
+	{
+		(void)SPIDEC_Data(address, SPIDEC_TX, tx, text, sizeof(text));
+		length = SPIDEC_Append(dst, size, length, " {%s}%s", text, SPIDEC_Parity(tx) ? "" : " PARITY");
+	}
+	if ((flags & SPIDEC_FLAG_NO_ANSWER) != 0)
+	{
+		return SPIDEC_Append(dst, size, length, " -> no answer");
+	}
+	(void)SPIDEC_Status(rx >> 8, text, sizeof(text));
+	length = SPIDEC_Append(dst, size, length, " -> [%s]", text);
+	(void)SPIDEC_Data(address, SPIDEC_RX, rx, text, sizeof(text));
+	return SPIDEC_Append(dst, size, length, " {%s}", text);
+}
+
+/***************************************************************************//*!
+*   @brief Writes a record as one line of the text trace.
+* 	@par Description
+*					"sequence time site dspi tx rx flags depth", time, site,
+*					tx, rx and flags in hexadecimal.
+********************************************************************************/
+void SPIDEC_WriteLine(FILE *f, const SPIDEC_Record *record)
+{
+	fprintf(f, "%u %08X %08X %u %04X %04X %02X %u\n", record->sequence, record->time, record->site,
+			record->dspi, record->tx, record->rx, record->flags, record->depth);
+}
+
+/***************************************************************************//*!
+*   @brief Reads a record from one line of the text trace.
+*	@return 	1 - record read, 0 - comment, empty or malformed line.
+********************************************************************************/
+int SPIDEC_ReadLine(const char *line, SPIDEC_Record *record)
+{
+	unsigned int sequence, time, site, dspi, tx, rx, flags, depth;
+
+	if ((line[0] == '#') || (sscanf(line, "%u %x %x %u %x %x %x %u", &sequence, &time, &site, &dspi, &tx, &rx,
+									&flags, &depth) != 8))
+	{
+		return 0;
+	}
+	record->sequence = sequence;
+	record->time = time;
+	record->site = site;
+	record->dspi = (uint8_t)(dspi & SPIDEC_FLAG_DSPI);
+	record->tx = (uint16_t)tx;
+	record->rx = (uint16_t)rx;
+	record->flags = (uint8_t)(flags & ~SPIDEC_FLAG_DSPI);
+	record->depth = (uint8_t)depth;
+	return 1;
+}
@@ -0,0 +1,98 @@
+/*******************************************************************************
+*
+* $File Name:       SPIDEC.h$
+* @file             SPIDEC.h
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Host decoder of the SPI trace records (FS65xx frames)
+* @brief            Host decoder of the SPI trace records (FS65xx frames)
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : Host (PC)
+*   Dependencies         : C99 standard library.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Decoder created
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#ifndef _SPIDEC_H_
+#define _SPIDEC_H_
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdint.h>
+
+/*==================================================================================================
+*   NON - configurable parameters (shall match SPITRACE.h of the target)
+==================================================================================================*/
+
+#define SPIDEC_RECORD_SIZE		16		///packed record (SPITRACE_RECORD_SIZE)
+#define SPIDEC_FLAG_DSPI		0x03
+#define SPIDEC_FLAG_BATCH		0x04
+#define SPIDEC_FLAG_NO_ANSWER	0x08
+
+#define SPIDEC_TB_MHZ			200		///time base of the target (CLOCK_SYS_HZ)
+#define SPIDEC_TEXT_SIZE		512		///longest decoded frame text
+
+//Field directions
+#define SPIDEC_TX				0		///command data (FS65xx.h *_Tx union)
+#define SPIDEC_RX				1		///answer data (FS65xx.h *_Rx union)
+
+/*==================================================================================================
+*   Structures/Type defines
+==================================================================================================*/
+
+typedef struct {
+	uint8_t		address;
+	const char	*name;
+} SPIDEC_Register;
+
+typedef struct {
+	uint8_t		address;
+	uint8_t		direction;	///SPIDEC_TX / SPIDEC_RX
+	uint8_t		lsb;		///in the data Byte of the frame
+	uint8_t		width;
+	const char	*name;
+} SPIDEC_Field;
+
+typedef struct {
+	uint32_t	sequence;	///record number (unwrapped by the reader)
+	uint32_t	time;		///time base (TBL) at the end of the frame
+	uint32_t	site;		///call site of the FS65 command function, 0 - none
+	uint16_t	tx;
+	uint16_t	rx;
+	uint8_t		dspi;
+	uint8_t		flags;		///SPIDEC_FLAG_BATCH, SPIDEC_FLAG_NO_ANSWER
+	uint8_t		depth;		///running interrupt handlers, 0 - main loop
+} SPIDEC_Record;
+
+/*==================================================================================================
+*   Function prototypes
+==================================================================================================*/
+
+void SPIDEC_Unpack(const uint8_t *packed, SPIDEC_Record *record);
+const char *SPIDEC_RegisterName(uint32_t address);
+int SPIDEC_Parity(uint32_t tx);
+size_t SPIDEC_Data(uint32_t address, uint32_t direction, uint32_t data, char *dst, size_t size);
+size_t SPIDEC_Status(uint32_t status, char *dst, size_t size);
+size_t SPIDEC_Frame(uint32_t tx, uint32_t rx, uint32_t flags, char *dst, size_t size);
+void SPIDEC_WriteLine(FILE *f, const SPIDEC_Record *record);
+int SPIDEC_ReadLine(const char *line, SPIDEC_Record *record);
+
+#endif
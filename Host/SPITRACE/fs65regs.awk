@@ -0,0 +1,117 @@
+# Register and bit field tables of the FS65xx for SPIDEC.c, generated from
+# include/FS65xx.h so the decoder follows the driver header:
+#
+#     awk -f fs65regs.awk ../../include/FS65xx.h > fs65regs.h
+#
+# - registers: the *_ADR defines
+# - fields: the B structure of each *_Tx / *_Rx union, bit positions counted
+#   from bit 31 down like the target bit field order, only the data Byte of
+#   the frame is kept (RW, ADR, P and Status are decoded by SPIDEC.c)
+# - the FS65_V11 branch of the #ifdef FS65_V11 blocks (FS65_V11 is defined
+#   by the header)
+
+BEGIN {
+	v11 = 0
+	skip = 0
+	inUnion = 0
+	nReg = 0
+	nField = 0
+}
+
+{
+	sub(/\r$/, "")
+}
+
+/^[ \t]*#ifdef[ \t]+FS65_V11/	{ v11 = 1; next }
+/^[ \t]*#else/					{ if (v11) skip = 1; next }
+/^[ \t]*#endif/					{ if (v11) { v11 = 0; skip = 0 }; next }
+skip							{ next }
+
+/^#define[ \t]+[A-Za-z0-9_]+_ADR[ \t]/ {
+	name = $2
+	sub(/_ADR$/, "", name)
+	address[name] = $3
+	regName[nReg++] = name
+	next
+}
+
+/typedef[ \t]+union/ {
+	inUnion = 1
+	depth = 0
+	inB = 0
+	nUnion = 0
+	next
+}
+
+inUnion && /struct[ \t]*\{/ {
+	depth++
+	inB = (depth == 1)
+	pos = 31
+	next
+}
+
+inUnion && inB && /vuint32_t[^;]*:/ {
+	line = $0
+	sub(/^.*vuint32_t/, "", line)
+	sub(/;.*$/, "", line)
+	split(line, part, ":")
+	field = part[1]
+	gsub(/[ \t]/, "", field)
+	width = part[2] + 0
+	lsb = pos - width + 1
+	pos -= width
+	if ((field != "") && (lsb < 8))
+	{
+		unionField[nUnion] = field
+		unionLsb[nUnion] = lsb
+		unionWidth[nUnion] = width
+		nUnion++
+	}
+	next
+}
+
+inUnion && /\}[ \t]*B[ \t]*;/ {
+	inB = 0
+	next
+}
+
+inUnion && /\}[ \t]*[A-Za-z0-9_]+_(Tx|Rx)_32B_tag[ \t]*;/ {
+	tag = $0
+	sub(/^[ \t]*\}[ \t]*/, "", tag)
+	sub(/_32B_tag.*$/, "", tag)
+	name = tag
+	sub(/_(Tx|Rx)$/, "", name)
+	direction = (tag ~ /_Tx$/) ? "SPIDEC_TX" : "SPIDEC_RX"
+	if (!(name in address))
+	{
+		print "fs65regs.awk: no address for " tag > "/dev/stderr"
+	}
+	else
+	{
+		for (i = 0; i < nUnion; i++)
+		{
+			fieldLine[nField++] = sprintf("\t{%s, %s, %d, %d, \"%s\"},", address[name], direction,
+										  unionLsb[i], unionWidth[i], unionField[i])
+		}
+	}
+	inUnion = 0
+	next
+}
+
+END {
+	print "/* Generated by fs65regs.awk from include/FS65xx.h, do not edit. */"
+	print ""
+	print "static const SPIDEC_Register SPIDEC_RegisterTable[] = {"
+	for (i = 0; i < nReg; i++)
+	{
+		printf "\t{%s, \"%s\"},\n", address[regName[i]], regName[i]
+	}
+	print "};"
+	print ""
+	print "static const SPIDEC_Field SPIDEC_FieldTable[] = {"
+	for (i = 0; i < nField; i++)
+	{
+		print fieldLine[i]
+	}
+	print "};"
+}
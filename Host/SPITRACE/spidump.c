@@ -0,0 +1,260 @@
+/*******************************************************************************
+*
+* $File Name:       spidump.c$
+* @file             spidump.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Decoder of the SPI trace records of a GUI or CAN capture
+* @brief            Decoder of the SPI trace records of a GUI or CAN capture
+*
+*   Usage:
+*     spidump capture.bin                  - decode the GUI_REC_SPI_TRACE records
+*                                            of a GUI capture
+*     spidump -c candump.log [-i 0x700]    - decode a candump log (candump -L
+*                                            format), records sent by
+*                                            SPITRACE_SendCAN on id and id + 1
+*     spidump ... -o trace.txt             - also write the text trace (input
+*                                            of Host/SIM/simreplay)
+*
+*   The records are sorted by sequence number, the duplicates (records read
+*   twice by the GUI) are removed and the lost records are reported. Times
+*   are relative to the first record, the call sites are the return
+*   addresses of the FS65 command functions (addr2line -f -e the ELF file).
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Tool created
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "GUIDEC.h"
+#include "SPIDEC.h"
+
+#define DUMP_CAN_ID			0x700		///default identifier of the first frame of a record
+
+typedef struct {
+	SPIDEC_Record	*p_records;
+	size_t			count;
+	size_t			capacity;
+	uint32_t		last;				///last sequence number (CAN: 16-bit numbers extended)
+	int				started;
+} Dump_List;
+
+static Dump_List dumpList;
+
+static void Dump_Add(const uint8_t *packed, int full, uint32_t sequence)
+{
+	SPIDEC_Record record;
+
+	SPIDEC_Unpack(packed, &record);
+	if (full == 0)
+	{
+		sequence = dumpList.started ? dumpList.last + (uint32_t)(int16_t)(record.sequence - (uint16_t)dumpList.last)
+									: record.sequence;
+	}
+	record.sequence = sequence;
+	dumpList.last = sequence;
+	dumpList.started = 1;
+	if (dumpList.count == dumpList.capacity)
+	{
+		dumpList.capacity = (dumpList.capacity != 0) ? dumpList.capacity * 2 : 1024;
+		dumpList.p_records = realloc(dumpList.p_records, dumpList.capacity * sizeof(SPIDEC_Record));
+		if (dumpList.p_records == NULL)
+		{
+			perror("spidump");
+			exit(1);
+		}
+	}
+	dumpList.p_records[dumpList.count++] = record;
+}
+
+static int Dump_GuiRecord(const GUIDEC_Record *record, void *context)
+{
+	(void)context;
+	if (record->type == GUIDEC_REC_SPI_TRACE)
+	{
+		Dump_Add(record->trace, 1, record->sequence);
+	}
+	return 0;
+}
+
+static int Dump_ReadGui(FILE *f)
+{
+	static uint8_t buffer[1 << 16];
+	GUIDEC_Decoder dec;
+	size_t n;
+
+	GUIDEC_Init(&dec);
+	while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0)
+	{
+		GUIDEC_Feed(&dec, buffer, n, Dump_GuiRecord, NULL);
+	}
+	if ((dec.crcErrors != 0) || (dec.formatErrors != 0))
+	{
+		fprintf(stderr, "GUI capture: %llu CRC errors, %llu format errors\n",
+				(unsigned long long)dec.crcErrors, (unsigned long long)dec.formatErrors);
+	}
+	return 0;
+}
+
+/*
+*	candump -L lines: "(time) interface id#data", the first half of a record
+*	on id, the second half on id + 1.
+*/
+static int Dump_ReadCan(FILE *f, uint32_t id)
+{
+	char line[256];
+	char data[64];
+	uint8_t packed[SPIDEC_RECORD_SIZE];
+	unsigned int frameId;
+	int pending = 0;
+	uint32_t i;
+
+	while (fgets(line, sizeof(line), f) != NULL)
+	{
+		if ((sscanf(line, "%*s %*s %x#%63s", &frameId, data) != 2) || (strlen(data) != 16))
+		{
+			continue;
+		}
+		if (frameId == id)
+		{
+			pending = 1;
+		}
+		else if ((frameId != id + 1) || (pending == 0))
+		{
+			continue;
+		}
+		for (i = 0; i < 8; i++)
+		{
+			unsigned int byte;
+
+			(void)sscanf(&data[2 * i], "%2x", &byte);
+			packed[(frameId - id) * 8 + i] = (uint8_t)byte;
+		}
+		if (frameId == id + 1)
+		{
+			Dump_Add(packed, 0, 0);
+			pending = 0;
+		}
+	}
+	return 0;
+}
+
+static int Dump_Compare(const void *p_a, const void *p_b)
+{
+	const SPIDEC_Record *p_first = p_a;
+	const SPIDEC_Record *p_second = p_b;
+
+	return (p_first->sequence > p_second->sequence) - (p_first->sequence < p_second->sequence);
+}
+
+int main(int argc, char **argv)
+{
+	const char *p_input = 0;
+	const char *p_output = 0;
+	uint32_t id = DUMP_CAN_ID;
+	int can = 0;
+	char text[SPIDEC_TEXT_SIZE];
+	uint64_t time = 0;
+	uint64_t lost = 0;
+	size_t kept = 0;
+	size_t i;
+	FILE *f;
+	FILE *out = 0;
+	int arg;
+
+	for (arg = 1; arg < argc; arg++)
+	{
+		if ((strcmp(argv[arg], "-c") == 0) && (arg + 1 < argc))
+		{
+			can = 1;
+			p_input = argv[++arg];
+		}
+		else if ((strcmp(argv[arg], "-i") == 0) && (arg + 1 < argc))
+			id = (uint32_t)strtoul(argv[++arg], NULL, 0);
+		else if ((strcmp(argv[arg], "-o") == 0) && (arg + 1 < argc))
+			p_output = argv[++arg];
+		else if ((argv[arg][0] != '-') && (p_input == 0))
+			p_input = argv[arg];
+		else
+			break;
+	}
+	if ((p_input == 0) || (arg < argc))
+	{
+		fprintf(stderr, "usage: %s capture.bin | -c candump.log [-i id] [-o trace.txt]\n", argv[0]);
+		return 2;
+	}
+	f = fopen(p_input, can ? "r" : "rb");
+	if (f == NULL)
+	{
+		perror(p_input);
+		return 1;
+	}
+	(void)(can ? Dump_ReadCan(f, id) : Dump_ReadGui(f));
+	fclose(f);
+
+	if (p_output != 0)
+	{
+		out = fopen(p_output, "w");
+		if (out == NULL)
+		{
+			perror(p_output);
+			return 1;
+		}
+		fprintf(out, "# SPI trace: sequence time site dspi tx rx flags depth\n");
+	}
+	qsort(dumpList.p_records, dumpList.count, sizeof(SPIDEC_Record), Dump_Compare);
+	printf("  sequence   time [us]     dt [us]  site      dspi depth  tx   rx    frame\n");
+	for (i = 0; i < dumpList.count; i++)
+	{
+		const SPIDEC_Record *p_record = &dumpList.p_records[i];
+		const SPIDEC_Record *p_previous = (kept != 0) ? &dumpList.p_records[i - 1] : 0;
+		uint32_t dt = 0;
+
+		if ((p_previous != 0) && (p_previous->sequence == p_record->sequence))
+		{
+			continue;										//read twice
+		}
+		if ((p_previous != 0) && (p_record->sequence != p_previous->sequence + 1))
+		{
+			printf("  -- %u records lost --\n", p_record->sequence - p_previous->sequence - 1);
+			lost += p_record->sequence - p_previous->sequence - 1;
+		}
+		if (p_previous != 0)
+		{
+			dt = p_record->time - p_previous->time;
+			time += dt;
+		}
+		(void)SPIDEC_Frame(p_record->tx, p_record->rx, p_record->flags, text, sizeof(text));
+		printf("%10u  %10.2f  %10.2f  %08X  %u%c   %-3u    %04X %04X  %s\n", p_record->sequence,
+			   (double)time / SPIDEC_TB_MHZ, (double)dt / SPIDEC_TB_MHZ, p_record->site, p_record->dspi,
+			   ((p_record->flags & SPIDEC_FLAG_BATCH) != 0) ? 'b' : ' ', p_record->depth, p_record->tx,
+			   p_record->rx, text);
+		if (out != 0)
+		{
+			SPIDEC_WriteLine(out, p_record);
+		}
+		kept++;
+	}
+	if (out != 0)
+	{
+		fclose(out);
+	}
+	fprintf(stderr, "%zu records, %llu lost\n", kept, (unsigned long long)lost);
+	free(dumpList.p_records);
+	return 0;
+}
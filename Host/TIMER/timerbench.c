@@ -0,0 +1,190 @@
+/*******************************************************************************
+*
+* $File Name:       timerbench.c$
+* @file             timerbench.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Host benchmark of the software timer wheel
+* @brief            Host benchmark of the software timer wheel
+*
+*   Usage:
+*     timerbench           - 10000 timers
+*     timerbench 100000    - given number of timers
+*
+*   The wheel runs on a simulated clock: each wake-up jumps the clock to the
+*   programmed deadline, so every expiry is checked against its exact time.
+*   At the end one timer is started after BENCH_IDLE_US of idle time with
+*   the wheel empty (wheel time far behind the clock).
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Tool created
+BRNY001					      19/10/2026 	   main	  Timer started after a long idle with the wheel empty
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "typedefs.h"
+#include "TIMER.h"
+
+#define BENCH_DEFAULT_TIMERS	10000
+#define BENCH_MAX_DELAY_US		10000000	///one-shot delays up to 10 s
+#define BENCH_RUN_US			30000000	///simulated run time
+#define BENCH_IDLE_US			(1ull << 37)	///idle time above the 36 bits of the wheel levels
+
+typedef struct {
+	TIMER_Struct	timer;
+	uint64_t		due;			///expected expiry
+	uint32_t		period;
+	uint32_t		fired;
+} BenchTimer;
+
+static uint64_t simNow;
+static uint64_t simDeadline = TIMER_NO_DEADLINE;
+static uint32_t lateOrEarly;
+static uint32_t seed = 0x12345678;
+
+uint64_t TIMER_PortNow(void)
+{
+	return simNow;
+}
+
+void TIMER_PortProgram(uint64_t deadline)
+{
+	simDeadline = deadline;
+}
+
+static uint32_t Random(void)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	return seed;
+}
+
+static double Seconds(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void Expire(void *p_arg)
+{
+	BenchTimer *p_bench = (BenchTimer*)p_arg;
+
+	if (simNow != p_bench->due)
+		lateOrEarly++;
+	p_bench->fired++;
+	p_bench->due += p_bench->period;
+}
+
+static void Start(BenchTimer *p_bench, uint32_t i)
+{
+	uint32_t delay = 1 + Random() % BENCH_MAX_DELAY_US;
+
+	p_bench->period = ((i % 10) == 1) ? 1000 + Random() % 100000 : 0;	//every 10th timer is periodic
+	p_bench->due = simNow + delay;
+	TIMER_Start(&p_bench->timer, delay, p_bench->period, Expire, p_bench);
+}
+
+int main(int argc, char **argv)
+{
+	uint32_t nb = (argc > 1) ? (uint32_t)strtoul(argv[1], 0, 0) : BENCH_DEFAULT_TIMERS;
+	BenchTimer *p_timers = calloc(nb, sizeof(BenchTimer));
+	uint64_t fired = 0;
+	uint32_t cancelled = 0;
+	uint32_t missed = 0;
+	uint32_t i;
+	double t0, tStart, tCancel, tRestart, tRun;
+
+	if ((p_timers == 0) || (nb == 0))
+		return 1;
+
+	TIMER_Init();
+
+	t0 = Seconds();
+	for (i = 0; i < nb; i++)
+		Start(&p_timers[i], i);
+	tStart = Seconds() - t0;
+
+	t0 = Seconds();
+	for (i = 0; i < nb; i += 2)
+	{
+		TIMER_Cancel(&p_timers[i].timer);
+		cancelled++;
+	}
+	tCancel = Seconds() - t0;
+
+	t0 = Seconds();
+	for (i = 1; i < nb; i += 4)
+		Start(&p_timers[i], i);					//restart of running timers
+	tRestart = Seconds() - t0;
+
+	t0 = Seconds();
+	while ((simDeadline != TIMER_NO_DEADLINE) && (simDeadline <= BENCH_RUN_US))
+	{
+		simNow = simDeadline;
+		simDeadline = TIMER_NO_DEADLINE;				//one-shot consumed, as in TIMER_IsrPIT
+		TIMERwheel.deadline = TIMER_NO_DEADLINE;
+		TIMERwheel.wakeups++;
+		TIMER_Process(simNow);
+	}
+	tRun = Seconds() - t0;
+
+	for (i = 0; i < nb; i++)
+	{
+		fired += p_timers[i].fired;
+		if ((i & 1) == 0)
+			missed += (p_timers[i].fired != 0);			//cancelled
+		else if (p_timers[i].period == 0)
+			missed += (p_timers[i].fired != 1);
+		else
+			missed += (p_timers[i].due <= BENCH_RUN_US);	//periodic, all periods up to the run end
+	}
+	for (i = 0; i < nb; i++)
+		TIMER_Cancel(&p_timers[i].timer);
+
+	simNow += BENCH_IDLE_US;							//no wake-up with the wheel empty
+	p_timers[0].fired = 0;
+	p_timers[0].period = 0;
+	p_timers[0].due = simNow + 1000;
+	TIMER_Start(&p_timers[0].timer, 1000, 0, Expire, &p_timers[0]);
+	while (simDeadline != TIMER_NO_DEADLINE)
+	{
+		simNow = simDeadline;
+		simDeadline = TIMER_NO_DEADLINE;
+		TIMERwheel.deadline = TIMER_NO_DEADLINE;
+		TIMER_Process(simNow);
+	}
+	missed += (p_timers[0].fired != 1);
+
+	printf("timers            %u (%u cancelled, %u restarted)\n", nb, cancelled, (nb + 2) / 4);
+	printf("start             %8.1f ns/op\n", tStart * 1e9 / nb);
+	printf("cancel            %8.1f ns/op\n", tCancel * 1e9 / cancelled);
+	printf("restart           %8.1f ns/op\n", tRestart * 1e9 / ((nb + 2) / 4));
+	printf("expiry            %8.1f ns/op (%llu expiries, %u cascades, %u wake-ups in %.0f s simulated)\n",
+		   tRun * 1e9 / (double)(fired ? fired : 1), (unsigned long long)fired, TIMERwheel.cascaded,
+		   TIMERwheel.wakeups, BENCH_RUN_US / 1e6);
+	printf("wake-up           %8.1f ns/op\n", tRun * 1e9 / (TIMERwheel.wakeups ? TIMERwheel.wakeups : 1));
+	printf("idle              %.0f s, timer after it fired %u time(s)\n", (double)BENCH_IDLE_US / 1e6, p_timers[0].fired);
+	printf("timing errors     %u, wrong expiry count %u\n", lateOrEarly, missed);
+
+	free(p_timers);
+	return ((lateOrEarly != 0) || (missed != 0)) ? 1 : 0;
+}
@@ -56,6 +56,7 @@ Revision History:
                              Modification     Function
 Author (core ID)              Date D/M/Y       Name		  Description of Changes
 B35993		 				  04/07/2014  	   ALL		  Driver created
+BRNY001					      19/10/2026 	   ADC_SetSamplingTime	  Sampling time in ns (integer)
 
 ---------------------------   ----------    ------------  ------------------------------------------
 ==================================================================================================*/
@@ -182,6 +183,6 @@ void ADC_SetVDDforPresampling(uint8_t, vuint32_t);
 void ADC_SetVSSforPresampling(uint8_t, vuint32_t);
 void ADC_EnableSampleBypass(uint8_t);
 void ADC_DisableSampleBypass(uint8_t);
-void ADC_SetSamplingTime(uint8_t, uint32_t, float);
+void ADC_SetSamplingTime(uint8_t, uint32_t, uint32_t);
 
 #endif
@@ -0,0 +1,129 @@
+/*******************************************************************************
+*
+* Freescale Semiconductor Inc.
+* (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+* ALL RIGHTS RESERVED.
+*
+********************************************************************************
+*
+* $File Name:       BOOT.h$
+* @file             BOOT.h
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Boot sequencer header file
+* @brief            Boot sequencer header file
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/****************************************************************************//*!
+*
+*  @mainpage Boot sequencer for MPC5744P
+*
+*  @section Intro Introduction
+*
+*	This package runs the initialization of the application as a graph of
+*	stages. A stage is a resumable function: it returns BOOT_DONE or
+*	BOOT_WAIT with the minimal time before its next call, a stage starts
+*	when all the stages it depends on are done. While a stage waits for a
+*	device (e.g. the ABIST2 runs of the FS65xx), the other ready stages run.
+*
+*  The key features of this package are the following:
+*  - Dependencies as bit masks of stage numbers, the table order is the priority
+*  - Per stage ready, start and end times, CPU time and number of calls
+*  - Time to operational and critical path of the boot (BOOT_CriticalPath)
+*
+*  For more information about the functions and configuration items see these documents:
+*
+*******************************************************************************
+*
+* @attention
+*
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : MPC5744P
+*   Dependencies         : MPC5744P - Basic SW drivers.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Driver created
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#ifndef _BOOT_H_
+#define _BOOT_H_
+
+/*==================================================================================================
+*   Configurable parameters
+==================================================================================================*/
+
+#define BOOT_STAGES_MAX			16		///maximal number of stages (at most 32)
+
+/*==================================================================================================
+*   NON - configurable parameters
+*	User should not modify configuration in this section.
+==================================================================================================*/
+
+#define BOOT_AFTER(stage)		(1UL << (stage))	///dependency mask of a stage
+#define BOOT_NONE				0xFF				///no stage
+
+//Stage function results
+#define BOOT_DONE				0		///stage finished
+#define BOOT_WAIT				1		///call again after the returned wait
+
+//BOOT_Run results
+#define BOOT_OK					0
+#define BOOT_BLOCKED			1		///dependency never satisfied (cycle or unknown stage)
+
+//Stage states
+#define BOOT_STATE_IDLE			0		///not started
+#define BOOT_STATE_WAITING		1		///started, waiting for its due time
+#define BOOT_STATE_DONE			2
+
+/*==================================================================================================
+*   Structures/Type defines
+==================================================================================================*/
+
+typedef uint32_t (*BOOT_StageFunction)(uint32_t *p_waitUs);
+
+typedef struct {
+	const char			*name;
+	BOOT_StageFunction	run;
+	uint32_t			after;			///stages done before the start (BOOT_AFTER masks)
+} BOOT_Stage;
+
+typedef struct {
+	uint32_t	ready;			///last dependency done [ticks from BOOT_Run]
+	uint32_t	start;			///first call [ticks from BOOT_Run]
+	uint32_t	end;			///stage done [ticks from BOOT_Run]
+	uint32_t	busyTicks;		///time spent in the stage function
+	uint32_t	due;			///next call of a waiting stage (time base, lower word)
+	uint16_t	calls;
+	uint8_t		state;			///BOOT_STATE_xxx
+	uint8_t		binding;		///dependency done last (critical path), BOOT_NONE
+} BOOT_StageStats;
+
+extern BOOT_StageStats BOOTstats[BOOT_STAGES_MAX];
+extern const BOOT_Stage *BOOTtable;			///stage table of the last BOOT_Run
+extern uint32_t BOOTstages;					///number of stages of the last BOOT_Run
+extern uint32_t BOOToperationalTicks;		///BOOT_Run start to the last stage done
+
+/*==================================================================================================
+*   Function prototypes
+==================================================================================================*/
+
+uint32_t BOOT_Run(const BOOT_Stage*, uint32_t);
+uint32_t BOOT_CriticalPath(uint8_t*, uint32_t);
+
+#endif
@@ -34,6 +34,7 @@
 *  - Initializate CAN module 
 *  - Send CAN frames
 *  - Disable CAN module
+*  - Handle error states (warning, passive, bus-off) and controlled bus-off recovery
 *
 *  For more information about the functions and configuration items see these documents: 
 *
@@ -54,6 +55,8 @@ Revision History:
                              Modification     Function
 Author (core ID)              Date D/M/Y       Name		  Description of Changes
 B35993		 				  23/07/2014 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   CAN_IsrError	  Error state machine and bus-off recovery added
+BRNY001					      19/10/2026 	   CAN_BOFF_HOLD_TIME  Removed, the recovery starts with the bus-off interrupt
 
 ---------------------------   ----------    ------------  ------------------------------------------
 ==================================================================================================*/
@@ -68,6 +71,61 @@ B35993		 				  23/07/2014 	   ALL		  Driver created
 
 #define CAN_MODULE_0 0
 #define CAN_MODULE_1 1
+#define CAN_MODULES_NB 3
+
+#define CAN_TX_SHADOW_NB	32		///number of Tx message buffers (0 - 31) requeued after bus-off
+
+//Error manager states
+#define CAN_STATE_ERROR_ACTIVE	0	///TEC and REC < 96
+#define CAN_STATE_ERROR_WARNING	1	///TEC or REC >= 96
+#define CAN_STATE_ERROR_PASSIVE	2	///TEC or REC >= 128
+#define CAN_STATE_BUS_OFF		3	///TEC >= 256, Tx buffers being withdrawn (CAN_IsrBusOff)
+#define CAN_STATE_RECOVERING	4	///waiting for 128 x 11 recessive bits
+
+//ESR1 register bits
+#define CAN_ESR1_TWRNINT		0x00020000
+#define CAN_ESR1_RWRNINT		0x00010000
+#define CAN_ESR1_ERROR_BITS		0x0000FC00	///BIT1ERR, BIT0ERR, ACKERR, CRCERR, FRMERR, STFERR
+#define CAN_ESR1_TXWRN			0x00000200
+#define CAN_ESR1_RXWRN			0x00000100
+#define CAN_ESR1_FLTCONF_MASK	0x00000030
+#define CAN_ESR1_FLTCONF_SHIFT	4
+#define CAN_ESR1_BOFFINT		0x00000004
+#define CAN_ESR1_ERRINT			0x00000002
+#define CAN_ESR1_INT_FLAGS		(CAN_ESR1_TWRNINT | CAN_ESR1_RWRNINT | CAN_ESR1_BOFFINT | CAN_ESR1_ERRINT)
+
+/*==================================================================================================
+*   Structures/Type defines
+==================================================================================================*/
+
+typedef struct {
+	uint32_t	state;				///error manager state (CAN_STATE_xxx)
+	uint8_t		TEC;				///last read transmit error counter
+	uint8_t		REC;				///last read receive error counter
+	uint8_t		maxTEC;				///maximal transmit error counter seen
+	uint8_t		maxREC;				///maximal receive error counter seen
+	uint32_t	lastErrors;			///error bits of ESR1 captured at the last error interrupt
+	uint32_t	errorCount;			///number of error interrupts
+	uint32_t	warningCount;		///number of Tx/Rx warning interrupts
+	uint32_t	busOffCount;		///number of bus-off events
+	uint32_t	lastRecoveryTime;	///duration of the last bus-off (bit times)
+	uint32_t	maxRecoveryTime;	///maximal duration of a bus-off (bit times)
+	uint32_t	lostFrames;			///frames overwritten before their transmission
+	uint32_t	requeuedFrames;		///frames sent again after a bus-off recovery
+	uint32_t	elapsedTime;		///bit times elapsed since the bus-off event
+	uint16_t	timerStamp;			///last read value of the free running timer
+} CAN_ErrorStruct;
+
+typedef struct {
+	struct {
+		uint64_t	message;
+		uint32_t	id;
+	} frame[CAN_TX_SHADOW_NB];		///last frame loaded into each Tx message buffer
+	uint32_t	pending;			///mask of frames not confirmed as transmitted
+} CAN_TxShadowStruct;
+
+extern CAN_ErrorStruct CANerror[CAN_MODULES_NB];
+extern CAN_TxShadowStruct CANtxShadow[CAN_MODULES_NB];
 
 /*==================================================================================================
 *   Function prototypes
@@ -76,6 +134,11 @@ B35993		 				  23/07/2014 	   ALL		  Driver created
 void CAN_ConfigurePads(uint8_t);
 void CAN_Init(uint8_t);
 void CAN_Send (uint8_t, uint8_t, uint64_t, uint32_t);
+void CAN_LoadTxBuffer(uint8_t, uint8_t, uint64_t, uint32_t);
 void CAN_Stop(uint8_t, uint8_t);
+void CAN_IsrError(void);
+void CAN_IsrBusOff(void);
+uint32_t CAN_ErrorTask(uint8_t);
+const CAN_ErrorStruct *CAN_GetErrorStats(uint8_t);
 
 #endif 
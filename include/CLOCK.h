@@ -0,0 +1,148 @@
+/*******************************************************************************
+*
+* Freescale Semiconductor Inc.
+* (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+* ALL RIGHTS RESERVED.
+*
+********************************************************************************
+*
+* $File Name:       CLOCK.h$
+* @file             CLOCK.h
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Clock tree and peripheral timing calculator header file
+* @brief            Clock tree and peripheral timing calculator header file
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/****************************************************************************//*!
+*
+*  @mainpage Clock tree and peripheral timing calculator for MPC5744P
+*
+*  @section Intro Introduction
+*
+*	This package contains the clock tree programmed by MC_MODE_INIT and the
+*	integer calculators of the serial drivers timing registers (LINFlex
+*	LFDIV, DSPI PBR/BR/CSSCK/ASC/DT, FlexCAN PRESDIV/PSEG, ADC INPSAMP).
+*
+*  The key features of this package are the following:
+*  - Clock frequencies derived from the MC_MODE_INIT dividers (single source)
+*  - Integer arithmetic only, no floating point and no math library
+*  - Macros evaluated at compile time for constant inputs
+*  - Achieved value and its error (ppm) returned by each calculator
+*
+*  For more information about the functions and configuration items see these documents:
+*
+*******************************************************************************
+*
+* @attention
+*
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : MPC5744P
+*   Dependencies         : MPC5744P - Basic SW drivers.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Driver created
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#ifndef _CLOCK_H_
+#define _CLOCK_H_
+
+/*==================================================================================================
+*   Configurable parameters
+*	Clock tree programmed by MC_MODE_INIT (ME.c uses these values).
+==================================================================================================*/
+
+#define CLOCK_XOSC_HZ			40000000	///external crystal frequency in Hz
+#define CLOCK_PLL0_PREDIV		1			///PLL0DV[PREDIV]
+#define CLOCK_PLL0_MFD			8			///PLL0DV[MFD]
+#define CLOCK_PLL0_RFDPHI		2			///PLL0DV[RFDPHI]
+#define CLOCK_PLL0_RFDPHI1		8			///PLL0DV[RFDPHI1]
+#define CLOCK_PLL1_MFD			20			///PLL1DV[MFD]
+#define CLOCK_PLL1_RFDPHI		2			///PLL1DV[RFDPHI]
+#define CLOCK_PBRIDGE_DIV		4			///MC_CGM.SC_DC0 divider (PBRIDGEx_CLK)
+#define CLOCK_ADC_DIV			2			///MC_CGM.AC0_DC2 divider (ADC_CLK)
+#define CLOCK_CAN_DIV			4			///MC_CGM.AC2_DC0 divider (CAN_PLL_CLK)
+
+/*==================================================================================================
+*   NON - configurable parameters
+*	User should not modify configuration in this section.
+==================================================================================================*/
+
+//Clock frequencies [Hz]
+#define CLOCK_PLL0_PHI_HZ		(CLOCK_XOSC_HZ / CLOCK_PLL0_PREDIV * CLOCK_PLL0_MFD / CLOCK_PLL0_RFDPHI)
+#define CLOCK_PLL0_PHI1_HZ		(CLOCK_XOSC_HZ / CLOCK_PLL0_PREDIV * CLOCK_PLL0_MFD / CLOCK_PLL0_RFDPHI1)
+#define CLOCK_PLL1_PHI_HZ		(CLOCK_XOSC_HZ * CLOCK_PLL1_MFD / (2 * CLOCK_PLL1_RFDPHI))
+#define CLOCK_SYS_HZ			CLOCK_PLL1_PHI_HZ						///SYS_CLK (core, time base)
+#define CLOCK_HALFSYS_HZ		(CLOCK_SYS_HZ / 2)						///HALFSYS_CLK (LINFlex)
+#define CLOCK_PBRIDGE_HZ		(CLOCK_SYS_HZ / CLOCK_PBRIDGE_DIV)		///PBRIDGEx_CLK (DSPI, PIT)
+#define CLOCK_ADC_HZ			(CLOCK_PLL0_PHI_HZ / CLOCK_ADC_DIV)		///ADC_CLK
+#define CLOCK_CAN_HZ			(CLOCK_PLL0_PHI_HZ / CLOCK_CAN_DIV)		///CAN_PLL_CLK (FlexCAN CLKSRC = 1)
+
+///relative error of an achieved value in ppm
+#define CLOCK_ERROR_PPM(actual, desired)	((int32_t)((((int64_t)(actual) - (int64_t)(desired)) * 1000000) / (int64_t)(desired)))
+///absolute value of an error in ppm
+#define CLOCK_ABS(error)					(((error) < 0) ? -(error) : (error))
+
+///LINFlex divider in 1/16 units (LINIBRR = LFDIV16 >> 4, LINFBRR = LFDIV16 & 0xF)
+#define CLOCK_LINFLEX_DIV16(clk, baudRate)		((uint32_t)(((clk) + (baudRate) / 2) / (baudRate)))
+///LINFlex achieved baud rate [Bd]
+#define CLOCK_LINFLEX_BAUD(clk, baudRate)		((uint32_t)((clk) / CLOCK_LINFLEX_DIV16(clk, baudRate)))
+
+///ADC INPSAMP (not clamped) for a sampling time in ns
+#define CLOCK_ADC_INPSAMP(clk, samplingNs)		((uint32_t)(((uint64_t)(clk) * (samplingNs)) / 1000000000u) + 1)
+
+///DSPI baud rate [Bd] of PBR/BR values (prescaler 2/3/5/7, scaler 2 - 32768)
+#define CLOCK_DSPI_BAUD(clk, prescaler, scaler)	((uint32_t)((clk) / ((prescaler) * (scaler))))
+
+///FlexCAN bit rate [b/s] of a prescaler (PRESDIV + 1) and a number of time quanta per bit
+#define CLOCK_CAN_BITRATE(clk, prescaler, tq)	((uint32_t)((clk) / ((prescaler) * (tq))))
+
+///Compile time check, a negative array size reports a failed condition
+#define CLOCK_ASSERT(name, condition)	typedef char CLOCK_Assert_##name[(condition) ? 1 : -1]
+
+#define CLOCK_ADC_INPSAMP_MIN	8
+#define CLOCK_ADC_INPSAMP_MAX	255
+#define CLOCK_CAN_TQ_MIN		8		///minimal number of time quanta per bit
+#define CLOCK_CAN_TQ_MAX		25		///maximal number of time quanta per bit
+
+/*==================================================================================================
+*   Structures/Type defines
+==================================================================================================*/
+
+typedef struct {
+	uint32_t	presdiv;			///CTRL1[PRESDIV] (prescaler - 1)
+	uint32_t	propseg;			///CTRL1[PROPSEG] (segment length - 1)
+	uint32_t	pseg1;				///CTRL1[PSEG1]
+	uint32_t	pseg2;				///CTRL1[PSEG2]
+	uint32_t	rjw;				///CTRL1[RJW]
+	uint32_t	bitRate;			///achieved bit rate [b/s]
+	uint32_t	samplePoint;		///achieved sample point [per mille]
+} CLOCK_CanTiming;
+
+/*==================================================================================================
+*   Function prototypes
+==================================================================================================*/
+
+int32_t CLOCK_ComputeLinflex(uint32_t, uint32_t, uint32_t*, uint32_t*);
+int32_t CLOCK_ComputeDspi(uint32_t, uint32_t, uint32_t*, uint32_t*);
+int32_t CLOCK_ComputeDspiDelay(uint32_t, uint32_t, uint32_t*, uint32_t*);
+int32_t CLOCK_ComputeCan(uint32_t, uint32_t, uint32_t, CLOCK_CanTiming*);
+int32_t CLOCK_ComputeAdcSampling(uint32_t, uint32_t, uint32_t*);
+
+#endif
@@ -0,0 +1,123 @@
+/*******************************************************************************
+*
+* Freescale Semiconductor Inc.
+* (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+* ALL RIGHTS RESERVED.
+*
+********************************************************************************
+*
+* $File Name:       DEFER.h$
+* @file             DEFER.h
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Deferred interrupt work header file
+* @brief            Deferred interrupt work header file
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/****************************************************************************//*!
+*
+*  @mainpage Deferred interrupt work for MPC5744P
+*
+*  @section Intro Introduction
+*
+*	This package contains the bottom half of the driver interrupts. An
+*	interrupt routine captures the hardware data, posts a work item (handler
+*	and one argument) and returns. The work items are run by an INTC software
+*	settable interrupt of the lowest priority (INT_DEFER_PRIORITY), preempted
+*	by all driver interrupts.
+*
+*  The key features of this package are the following:
+*  - Lock-free queues, posting allowed from any interrupt and from the main loop
+*  - DEFER_LEVELS queues, a queue is drained only if the more urgent ones are empty
+*  - Posted, run and dropped items counted per queue
+*
+*  For more information about the functions and configuration items see these documents:
+*
+*******************************************************************************
+*
+* @attention
+*
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : MPC5744P
+*   Dependencies         : MPC5744P - Basic SW drivers.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Driver created
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#ifndef _DEFER_H_
+#define _DEFER_H_
+
+/*==================================================================================================
+*   Configurable parameters
+==================================================================================================*/
+
+#define DEFER_SW_IRQ			0		///INTC software settable interrupt (vectors 0 - 15)
+#define DEFER_QUEUE_LOG2		4		///log2 of the number of items of a queue
+
+/*==================================================================================================
+*   NON - configurable parameters
+*	User should not modify configuration in this section.
+==================================================================================================*/
+
+#define DEFER_QUEUE_SIZE		(1 << DEFER_QUEUE_LOG2)
+
+//Queues, DEFER_HIGH is drained first
+#define DEFER_HIGH				0		///SBC events (user callbacks)
+#define DEFER_NORMAL			1		///SBC diagnostics
+#define DEFER_LOW				2		///measurements
+#define DEFER_LEVELS			3
+
+#define DEFER_OK				0
+#define DEFER_FULL				1		///queue full, item dropped
+
+#define DEFER_SSCIR_SET			0x02	///SSCIR[SET]: raise the software interrupt
+#define DEFER_SSCIR_CLR			0x01	///SSCIR[CLR]: clear the software interrupt flag
+
+/*==================================================================================================
+*   Structures/Type defines
+==================================================================================================*/
+
+typedef void (*DEFER_Handler)(uint32_t arg);
+
+typedef struct {
+	vuint32_t				sequence;	///position + 1 - item ready, position + DEFER_QUEUE_SIZE - item free
+	DEFER_Handler volatile	handler;
+	vuint32_t				arg;		///data captured by the interrupt routine
+} DEFER_Item;
+
+typedef struct {
+	DEFER_Item	item[DEFER_QUEUE_SIZE];
+	vuint32_t	tail;					///items posted
+	vuint32_t	head;					///items run
+	vuint32_t	dropped;				///items refused (queue full)
+} DEFER_Queue;
+
+extern DEFER_Queue DEFERqueue[DEFER_LEVELS];
+
+/*==================================================================================================
+*   Function prototypes
+==================================================================================================*/
+
+void DEFER_Init(void);
+uint32_t DEFER_Post(uint32_t, DEFER_Handler, uint32_t);
+uint32_t DEFER_RunPending(void);
+void DEFER_IsrSoftware(void);
+
+#endif
@@ -53,6 +53,8 @@ Revision History:
                              Modification     Function
 Author (core ID)              Date D/M/Y       Name		  Description of Changes
 B35993		 				  28/07/2014 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   DSPI_SendBatch	  Pipelined transfer through the Tx/Rx FIFOs
+BRNY001					      19/10/2026 	   DSPI_RoundBaudRate	  Removed, see CLOCK_ComputeDspi
 
 ---------------------------   ----------    ------------  ------------------------------------------
 ==================================================================================================*/
@@ -64,10 +66,10 @@ B35993		 				  28/07/2014 	   ALL		  Driver created
 #define MASTER 1
 #define SLAVE  0
 
-#define PBR_VALUE1	2.
-#define PBR_VALUE2	3.
-#define PBR_VALUE3	5.
-#define PBR_VALUE4	7.
+#define PBR_VALUE1	2
+#define PBR_VALUE2	3
+#define PBR_VALUE3	5
+#define PBR_VALUE4	7
 
 #define PBR1	0x0		
 #define PBR2	0x1
@@ -157,6 +159,11 @@ B35993		 				  28/07/2014 	   ALL		  Driver created
 #define RFOFRE	0x00080000
 #define RFDFRE	0x00020000
 
+///Status flags (write 1 to clear)
+#define DSPI_SR_FLAGS	(TCFRE | EOQFRE | TFUFRE | TFFFRE | RFOFRE | RFDFRE)	///same bit positions as in RSER
+
+#define DSPI_FIFO_DEPTH	4		///Tx/Rx FIFO entries used by DSPI_SendBatch
+
 ///Offset definitions
 #define CTAR0_OFF	0x000C	//till CTAR5 by 4 Bytes each
 #define TXFR0_OFF	0x003C	//till TXFR3 by 4 Bytes each
@@ -166,7 +173,6 @@ B35993		 				  28/07/2014 	   ALL		  Driver created
 void DSPI_Init(uint8_t,uint8_t, uint32_t, uint32_t, uint32_t);
 void DSPI_Send(uint8_t,uint8_t,uint16_t);
 uint32_t DSPI_Read(uint8_t);
-uint32_t DSPI_RoundBaudRate(uint32_t);
 void DSPI_SetPhase(uint8_t, uint8_t);
 void DSPI_SetPolarity(uint8_t, uint8_t);
 void DSPI_Enable(uint8_t);
@@ -182,6 +188,7 @@ void DSPI_DisableRxFIFO(uint8_t);
 void DSPI_SendWithInt(uint8_t,uint8_t,uint16_t);
 uint32_t DSPI_ReadWithInt(uint8_t);
 void DSPI_ClearRFDF(uint8_t);
+uint32_t DSPI_SendBatch(uint8_t, uint8_t, const uint16_t*, uint16_t*, uint32_t);
 
 
 #endif
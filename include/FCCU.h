@@ -52,6 +52,7 @@ Revision History:
                              Modification     Function
 Author (core ID)              Date D/M/Y       Name		  Description of Changes
 B35993		 				  25/07/2014 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   FCCU_SetProtocol	  FCCU_RETURN_xxx of FCCU_SetProtocol
 
 ---------------------------   ----------    ------------  ------------------------------------------
 ==================================================================================================*/
@@ -117,6 +118,10 @@ B35993		 				  25/07/2014 	   ALL		  Driver created
 #define	FCCU_OPS_ABORTED        2
 #define	FCCU_OPS_SUCCESS        3
 
-void FCCU_SetProtocol(uint32_t);
+//FCCU_SetProtocol return values
+#define	FCCU_RETURN_OK          0
+#define	FCCU_RETURN_ERROR       1	//operation timed out (TIME_WAIT_FCCU_OPS)
+
+uint32_t FCCU_SetProtocol(uint32_t);
 
 #endif
@@ -0,0 +1,178 @@
+/*******************************************************************************
+*
+* Freescale Semiconductor Inc.
+* (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+* ALL RIGHTS RESERVED.
+*
+********************************************************************************
+*
+* $File Name:       GUI.h$
+* @file             GUI.h
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      GUI link header file
+* @brief            GUI link header file
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/****************************************************************************//*!
+*
+*  @mainpage GUI link for MPC5744P
+*
+*  @section Intro Introduction
+*
+*	This package contains the protocol layer of the UART link between the
+*	FS65xx DEMO and the Graphical User Interface (GUI).
+*
+*  The key features of this package are the following:
+*  - COBS framing with CRC-16 of each frame
+*  - Timestamped register-change and measurement records
+*  - Delta encoding (only changed values are sent)
+*  - Batched register read/write requests answered in one frame
+*
+*  Frame format (before COBS encoding, followed by a 0x00 delimiter):
+*  - sequence number (1 Byte)
+*  - records
+*  - CRC-16/CCITT (poly 0x1021, init 0xFFFF) of the previous Bytes, MSB first
+*
+*  Record format:
+*  - GUI_REC_REGISTER: type, varint dt [us], FS65 register address, varint (value XOR previous value)
+*  - GUI_REC_MEASURE:  type, varint dt [us], channel, zigzag varint (value - previous value) [milli-units]
+*  - GUI_REC_TIME:     type, varint absolute time [us] (first record of a stream and after a keyframe request),
+*    keyframe: the GUI resets all register and measured values to zero, the next records are
+*    deltas against zero
+*  - GUI_REC_RESPONSE: type, varint dt [us], tag, status, count, count * (FS65 register address, answer MSB, answer LSB)
+*  - GUI_REC_SPI_TRACE: type, varint dt [us], varint SPITRACEhead, varint first record, count,
+*    count * SPITRACE_RECORD_SIZE Bytes (see SPITRACE_Pack)
+*
+*  Request format (GUI to target, COBS encoded, followed by a 0x00 delimiter):
+*  - tag (1 Byte, echoed in the response)
+*  - commands: GUI_CMD_READ addr | GUI_CMD_WRITE addr data | GUI_CMD_WRITE_SECURE addr data |
+*    GUI_CMD_READ_ALL | GUI_CMD_KEYFRAME | GUI_CMD_SPI_TRACE first (4 Bytes, MSB first)
+*  - CRC-16/CCITT of the previous Bytes, MSB first
+*  All FS65 commands of a request are sent in one DSPI batch (see FS65_SendBatch) and
+*  all answers are returned in one GUI_REC_RESPONSE record in the order of the commands.
+*  GUI_CMD_SPI_TRACE adds a frame with one GUI_REC_SPI_TRACE record after the response: at
+*  most GUI_TRACE_RECORDS records of the SPI trace from the record first (or from the oldest
+*  one if first was overwritten), the GUI asks for the next ones with first + count.
+*
+*  For more information about the functions and configuration items see these documents:
+*
+*******************************************************************************
+*
+* @attention
+*
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : MPC5744P
+*   Dependencies         : MPC5744P - Basic SW drivers.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   GUI_ProcessRequests	  Batched register requests
+BRNY001					      19/10/2026 	   GUI_GetTime	  Time read from the TIME module
+BRNY001					      19/10/2026 	   GUI_ProcessRequests	  SPI trace read back (GUI_CMD_SPI_TRACE)
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#ifndef _GUI_H_
+#define _GUI_H_
+
+/*==================================================================================================
+*   Configurable parameters
+==================================================================================================*/
+
+#define GUI_FRAME_SIZE		128		///maximal size of the frame payload (records) in Bytes
+#define GUI_REG_NB			46		///number of registers in INTstruct
+#define GUI_MEAS_NB			8		///number of measured values in ADCstruct.actualVoltage
+#define GUI_BATCH_MAX		48		///maximal number of FS65 commands of one request (<= FS65_BATCH_MAX)
+#define GUI_REQUEST_SIZE	160		///maximal size of an encoded request in Bytes
+
+/*==================================================================================================
+*   NON - configurable parameters
+*	User should not modify configuration in this section.
+==================================================================================================*/
+
+//Record types
+#define GUI_REC_REGISTER	0x01
+#define GUI_REC_MEASURE		0x02
+#define GUI_REC_TIME		0x03
+#define GUI_REC_RESPONSE	0x04
+#define GUI_REC_SPI_TRACE	0x05
+
+//Request commands
+#define GUI_CMD_READ			0x10	///read one register
+#define GUI_CMD_WRITE			0x11	///write one register
+#define GUI_CMD_WRITE_SECURE	0x12	///write one register with security bits
+#define GUI_CMD_READ_ALL		0x13	///read all GUI_REG_NB registers
+#define GUI_CMD_KEYFRAME		0x14	///resend all values in the stream
+#define GUI_CMD_SPI_TRACE		0x15	///send the SPI trace from a record number (SPITRACE)
+
+//Response status
+#define GUI_STATUS_OK			0x00
+#define GUI_STATUS_SPI_ERROR	0x01	///answers are valid up to the failing command
+#define GUI_STATUS_FORMAT_ERROR	0x02	///unknown command or truncated request, nothing executed
+#define GUI_STATUS_TOO_LONG		0x03	///more than GUI_BATCH_MAX commands, nothing executed
+
+#define GUI_TRACE_RECORDS	8		///SPI trace records of one GUI_REC_SPI_TRACE record (fits GUI_PAYLOAD_SIZE)
+#define GUI_PAYLOAD_SIZE	(3 * GUI_BATCH_MAX + 24)	///fits GUI_FRAME_SIZE records or one full response
+#define GUI_COBS_SIZE		(GUI_PAYLOAD_SIZE + GUI_PAYLOAD_SIZE / 254 + 2)	///encoded frame with delimiter
+
+/*==================================================================================================
+*   Structures/Type defines
+==================================================================================================*/
+
+typedef struct {
+	uint8_t		payload[GUI_PAYLOAD_SIZE];		///sequence number, records and CRC
+	uint32_t	length;							///used Bytes of payload
+	uint8_t		sequence;						///sequence number of the next frame
+	uint64_t	start;							///timebase value at GUI_Init
+	uint32_t	lastTime;						///time of the last record [us]
+	uint32_t	timeSent;						///0 - absolute time has to be sent first
+	uint32_t	regShadow[GUI_REG_NB];			///register values known by the GUI
+	int32_t		measShadow[GUI_MEAS_NB];		///measured values known by the GUI
+	uint32_t	frames;							///number of sent frames
+	uint32_t	records;						///number of sent records
+	uint32_t	droppedFrames;					///frames not accepted by the Tx ring buffer
+} GUI_StreamStruct;
+
+typedef struct {
+	uint8_t		frame[GUI_REQUEST_SIZE];		///encoded Bytes of the request being received
+	uint32_t	length;							///received Bytes of frame
+	uint32_t	overflow;						///1 - request too long, skipped until delimiter
+	uint32_t	requests;						///number of executed requests
+	uint32_t	rejected;						///requests with wrong CRC or length
+} GUI_RequestStruct;
+
+extern const uint8_t GUI_RegAddress[GUI_REG_NB];
+extern GUI_StreamStruct GUIstream;
+extern GUI_RequestStruct GUIrequest;
+
+/*==================================================================================================
+*   Function prototypes
+==================================================================================================*/
+
+void GUI_Init(void);
+void GUI_Task(void);
+void GUI_RequestKeyframe(void);
+uint32_t GUI_GetTime(void);
+uint16_t GUI_ComputeCRC(const uint8_t*, uint32_t);
+uint32_t GUI_EncodeCOBS(const uint8_t*, uint32_t, uint8_t*);
+void GUI_FlushFrame(void);
+uint32_t GUI_DecodeCOBS(const uint8_t*, uint32_t, uint8_t*);
+void GUI_ProcessRequests(void);
+
+#endif
@@ -0,0 +1,179 @@
+/*******************************************************************************
+*
+* Freescale Semiconductor Inc.
+* (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+* ALL RIGHTS RESERVED.
+*
+********************************************************************************
+*
+* $File Name:       LIN.h$
+* @file             LIN.h
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      LIN schedule table driver header file
+* @brief            LIN schedule table driver header file
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/****************************************************************************//*!
+*
+*  @mainpage LIN schedule table driver for MPC5744P
+*
+*  @section Intro Introduction
+*
+*	This package contains the LIN master schedule table engine and the LIN
+*	slave response table running on top of the LINFlexD module (LIN_NB).
+*
+*  The key features of this package are the following:
+*  - Schedule table walked from a PIT tick, no blocking calls
+*  - Header/response completion handled in the LINFlexD interrupts
+*  - Unconditional, sporadic and event triggered frames
+*  - Slave responses answered in the header interrupt, hardware ID filters
+*  - Double buffered frame data exchanged with the application
+*
+*  For more information about the functions and configuration items see these documents:
+*
+*******************************************************************************
+*
+* @attention
+*
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : MPC5744P
+*   Dependencies         : MPC5744P - Basic SW drivers.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   LIN_InitSlave	  Slave response table on the identifier filters
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#ifndef _LIN_H_
+#define _LIN_H_
+
+/*==================================================================================================
+*   NON - configurable parameters
+*	User should not modify configuration in this section.
+==================================================================================================*/
+
+//Frame direction (BIDR[DIR])
+#define LIN_SUBSCRIBE			0		///response sent by a slave
+#define LIN_PUBLISH				1		///response sent by the master
+
+//Checksum model (BIDR[CCS])
+#define LIN_CHECKSUM_ENHANCED	0
+#define LIN_CHECKSUM_CLASSIC	1
+
+//Slot types
+#define LIN_SLOT_UNCONDITIONAL	0		///header of the frame in each round
+#define LIN_SLOT_SPORADIC		1		///first updated frame of the associated list, silent slot if none
+#define LIN_SLOT_EVENT			2		///event triggered header, associated frames polled on a collision
+
+#define LIN_NO_FRAME			0xFF
+
+#define LIN_RETURN_OK			0
+#define LIN_RETURN_ERROR		1
+
+#define LIN_SLAVE_FILTERS		16		///number of LINFlexD identifier filters (list mode)
+
+//Driver mode
+#define LIN_MODE_NONE			0
+#define LIN_MODE_MASTER			1
+#define LIN_MODE_SLAVE			2
+
+/*==================================================================================================
+*   Structures/Type defines
+==================================================================================================*/
+
+typedef struct {
+	uint8_t		id;					///frame identifier (0x00 - 0x3F)
+	uint8_t		length;				///number of data Bytes (1 - 8)
+	uint8_t		direction;			///LIN_PUBLISH / LIN_SUBSCRIBE
+	uint8_t		checksum;			///LIN_CHECKSUM_ENHANCED / LIN_CHECKSUM_CLASSIC
+} LIN_FrameConfig;
+
+typedef struct {
+	uint8_t		type;				///LIN_SLOT_xxx
+	uint8_t		frame;				///index of the unconditional or event triggered frame
+	uint8_t		ticks;				///slot duration in LIN_TICK_US units
+	uint8_t		nbAssociated;		///number of items of p_associated
+	const uint8_t *p_associated;	///sporadic: candidate frames by priority, event triggered: associated frames
+} LIN_SlotConfig;
+
+typedef struct {
+	const LIN_SlotConfig *p_slots;
+	uint32_t	nbSlots;
+} LIN_ScheduleTable;
+
+typedef struct {
+	uint8_t		data[2][8];			///double buffer, data[count & 1] holds the last committed data
+	vuint32_t	count;				///number of committed updates
+	vuint32_t	updated;			///publish: data committed and not sent yet
+	vuint32_t	errors;				///frames completed with an error
+	vuint32_t	noResponse;			///subscribe: headers without a complete response
+} LIN_FrameBuffer;
+
+typedef struct {
+	const LIN_FrameConfig *p_frames;	///frame table
+	LIN_FrameBuffer		*p_buffers;		///frame data, one item per frame
+	uint32_t			nbFrames;
+	const LIN_ScheduleTable * volatile p_table;	///active schedule table, 0 - stopped
+	const LIN_ScheduleTable *p_next;		///table requested by LIN_SetScheduleTable
+	uint32_t			slot;				///next slot of p_table
+	uint32_t			ticksLeft;			///ticks until the next slot
+	vuint32_t			newTable;			///1 - p_next shall be applied at the next slot boundary
+	uint32_t			frame;				///frame in progress, LIN_NO_FRAME if none
+	const LIN_SlotConfig *p_event;			///event triggered slot of the frame in progress, 0 if none
+	const LIN_SlotConfig *p_collision;		///event triggered slot being resolved, 0 if none
+	uint32_t			collisionIndex;		///next associated frame to be polled
+	/* statistics */
+	uint32_t			headers;			///sent headers
+	uint32_t			responses;			///completed responses
+	uint32_t			errors;				///bit, checksum, framing and overrun errors
+	uint32_t			timeouts;			///frames not completed within their slot
+	uint32_t			collisions;			///event triggered collisions
+} LIN_MasterStruct;
+
+typedef struct {
+	const LIN_FrameConfig *p_frames;	///response table, frame i uses identifier filter i
+	LIN_FrameBuffer		*p_buffers;		///publish: staged responses, subscribe: mailboxes
+	uint32_t			nbFrames;
+	uint32_t			frame;				///publish frame in progress, LIN_NO_FRAME if none
+	/* statistics */
+	uint32_t			headers;			///headers matching a publish filter
+	uint32_t			responses;			///sent and received responses
+	uint32_t			errors;				///bit, checksum, framing and overrun errors
+	uint32_t			unknownHeaders;		///headers without a matching filter
+} LIN_SlaveStruct;
+
+extern LIN_MasterStruct LINmaster;
+extern LIN_SlaveStruct LINslave;
+
+/*==================================================================================================
+*   Function prototypes
+==================================================================================================*/
+
+void LIN_InitMaster(const LIN_FrameConfig*, LIN_FrameBuffer*, uint32_t);
+uint32_t LIN_InitSlave(const LIN_FrameConfig*, LIN_FrameBuffer*, uint32_t);
+void LIN_SetScheduleTable(const LIN_ScheduleTable*);
+void LIN_WriteFrame(uint32_t, const uint8_t*);
+uint32_t LIN_ReadFrame(uint32_t, uint8_t*);
+void LIN_IsrTick(void);
+void LIN_IsrRx(void);
+void LIN_IsrTx(void);
+void LIN_IsrError(void);
+
+#endif
@@ -54,6 +54,10 @@ Revision History:
                              Modification     Function
 Author (core ID)              Date D/M/Y       Name		  Description of Changes
 B35993		 				  24/07/2014 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   LINFLEX_WriteUART	  Interrupt driven UART Tx ring buffer added
+BRNY001					      19/10/2026 	   LINFLEX_IsrRxUART	  Interrupt driven UART Rx ring buffer with idle-line framing added
+BRNY001					      19/10/2026 	   LINSR/LINESR	  LIN status masks, LINFLEX array exported for the LIN driver
+BRNY001					      19/10/2026 	   LINFLEX_ChangeBaudRate	  Integer clock parameter
 
 ---------------------------   ----------    ------------  ------------------------------------------
 ==================================================================================================*/
@@ -64,7 +68,65 @@ B35993		 				  24/07/2014 	   ALL		  Driver created
 #define MASTER	1
 #define SLAVE 	0
 
-void LINFLEX_ChangeBaudRate(vuint8_t, double, uint32_t);
+//UARTSR register bits (w1c)
+#define LINFLEX_UARTSR_PE	0x00003C00	///Parity Error flags
+#define LINFLEX_UARTSR_RMB	0x00000200	///Release Message Buffer
+#define LINFLEX_UARTSR_FEF	0x00000100	///Framing Error Flag
+#define LINFLEX_UARTSR_BOF	0x00000080	///Buffer Overrun Flag
+#define LINFLEX_UARTSR_TO	0x00000008	///Timeout flag
+#define LINFLEX_UARTSR_DRF	0x00000004	///Data Reception Completed Flag
+#define LINFLEX_UARTSR_DTF	0x00000002	///Data Transmission Completed Flag
+
+//LINSR register bits (w1c)
+#define LINFLEX_LINSR_RMB	0x00000200	///Release Message Buffer
+#define LINFLEX_LINSR_DRF	0x00000004	///Data Reception Completed Flag
+#define LINFLEX_LINSR_DTF	0x00000002	///Data Transmission Completed Flag
+#define LINFLEX_LINSR_HRF	0x00000001	///Header Reception Flag
+
+//LINESR register bits (w1c)
+#define LINFLEX_LINESR_SZF	0x00008000	///Stuck at Zero Flag
+#define LINFLEX_LINESR_OCF	0x00004000	///Output Compare Flag (timeout)
+#define LINFLEX_LINESR_BEF	0x00002000	///Bit Error Flag
+#define LINFLEX_LINESR_CEF	0x00001000	///Checksum Error Flag
+#define LINFLEX_LINESR_SFEF	0x00000800	///Sync Field Error Flag
+#define LINFLEX_LINESR_SDEF	0x00000400	///Sync Delimiter Error Flag
+#define LINFLEX_LINESR_IDPEF	0x00000200	///Identifier Parity Error Flag
+#define LINFLEX_LINESR_FEF	0x00000100	///Framing Error Flag
+#define LINFLEX_LINESR_BOF	0x00000080	///Buffer Overrun Flag
+#define LINFLEX_LINESR_NF	0x00000001	///Noise Flag
+#define LINFLEX_LINESR_ALL	0x0000FF81
+
+typedef struct {
+	uint8_t		data[LINFLEX_UART_TX_BUFFER_SIZE];	///ring buffer data
+	vuint32_t	head;				///write index, modified by the producer only
+	vuint32_t	tail;				///read index, modified by LINFLEX_IsrTxUART only
+	vuint32_t	busy;				///1 - transmission in progress (DTIE enabled)
+	uint32_t	bytesSent;			///number of Bytes loaded into the UART buffer
+	uint32_t	isrCount;			///number of Tx interrupts
+	uint32_t	overflows;			///number of truncated LINFLEX_WriteUART calls
+} LINFLEX_TxRingStruct;
+
+typedef struct {
+	uint8_t		data[LINFLEX_UART_RX_RING_SIZE];	///ring buffer data
+	vuint32_t	head;				///write index, modified by LINFLEX_IsrRxUART only
+	vuint32_t	tail;				///read index, modified by the consumer only
+	vuint32_t	frameEnd[LINFLEX_UART_RX_FRAMES];	///head index at each idle line
+	vuint32_t	frameHead;			///write index of frameEnd
+	vuint32_t	frameTail;			///read index of frameEnd
+	uint32_t	bytesReceived;		///number of Bytes stored into the ring
+	uint32_t	maxFill;			///maximal number of Bytes waiting in the ring
+	uint32_t	idleFlushes;		///partial UART buffers flushed on the timeout
+	uint32_t	ringOverruns;		///Bytes dropped because the ring was full
+	uint32_t	hwOverruns;			///UART buffer overruns (BOF)
+	uint32_t	framingErrors;		///framing errors (FEF)
+	uint32_t	parityErrors;		///Bytes received with a parity error
+} LINFLEX_RxRingStruct;
+
+extern LINFLEX_TxRingStruct LINFLEXtxRing;
+extern LINFLEX_RxRingStruct LINFLEXrxRing;
+extern volatile struct LINFlexD_tag *LINFLEX[2];
+
+void LINFLEX_ChangeBaudRate(vuint8_t, uint32_t, uint32_t);
 void LINFLEX_ConfigurePads(vuint8_t);
 void LINFLEX_Sleep(vuint8_t);
 void LINFLEX_WakeUp(vuint8_t);
@@ -74,7 +136,7 @@ void LINFLEX_EnableTxUART(vuint8_t);
 void LINFLEX_EnableRxUART(vuint8_t);
 
 void LINFLEX_EnableInt(vuint8_t);
-void LINFLEX_InitUART(vuint8_t, double, uint32_t);
+void LINFLEX_InitUART(vuint8_t, uint32_t, uint32_t);
 void LINFLEX_InitRxBuffer (vuint8_t, int8_t);
 
 void LINFLEX_SendUART (vuint8_t, uint8_t*, uint8_t);
@@ -88,7 +150,7 @@ void LINFLEX_ClearParityError(vuint8_t);
 uint32_t LINFLEX_IsIdle(vuint8_t);
 
 //pure LIN functions
-void LINFLEX_InitLIN(vuint8_t, double, uint32_t, uint8_t);
+void LINFLEX_InitLIN(vuint8_t, uint32_t, uint32_t, uint8_t);
 void LINFLEX_SendFrameLIN(vuint8_t, uint8_t*, uint8_t, uint8_t);
 void LINFLEX_SendHeaderLIN(vuint8_t, uint8_t, uint8_t);
 void LINFLEX_ReadLIN(vuint8_t, int8_t, uint8_t*);
@@ -99,6 +161,13 @@ void LINFLEX_ClearHeaderFlagLIN(vuint8_t);
 uint32_t LINFLEX_ReadLINid(vuint8_t);
 void LINFLEX_SetReceptionParamLIN(vuint8_t, uint8_t);
 void LINFLEX_SendWordUART(vuint8_t nbLINFlex, uint8_t* p_string, uint8_t length);
+uint32_t LINFLEX_WriteUART(vuint8_t, const uint8_t*, uint32_t);
+void LINFLEX_IsrTxUART(void);
+uint32_t LINFLEX_GetTxFreeUART(void);
+void LINFLEX_IsrRxUART(void);
+uint32_t LINFLEX_ReadRxRing(uint8_t*, uint32_t);
+uint32_t LINFLEX_ReadFrameUART(uint8_t*, uint32_t);
+uint32_t LINFLEX_GetRxCountUART(void);
 
 
 #endif
@@ -52,6 +52,7 @@ Revision History:
                              Modification     Function
 Author (core ID)              Date D/M/Y       Name		  Description of Changes
 B35993		 				  31/07/2014 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   MC_MODE_INIT	  ME_RETURN_xxx of MC_MODE_INIT
 
 ---------------------------   ----------    ------------  ------------------------------------------
 ==================================================================================================*/
@@ -120,7 +121,10 @@ B35993		 				  31/07/2014 	   ALL		  Driver created
 #define ME_RUN1_EN     	0x00000020
 #define ME_TEST_EN     	0x00000002
 
-void MC_MODE_INIT(void);
+#define ME_RETURN_OK		0	///MC_MODE_INIT: DRUN entered on PLL1
+#define ME_RETURN_ERROR		1	///MC_MODE_INIT: mode transition timed out (TIME_WAIT_ME_MODE)
+
+uint32_t MC_MODE_INIT(void);
 
 
 #endif
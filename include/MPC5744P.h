@@ -371,6 +371,9 @@ extern "C" {
 #ifdef __ghs__
 #pragma ghs nowarning 618
 #endif
+#ifdef MPC5744P_HOST
+#pragma scalar_storage_order big-endian    /* host build (Host/SIM): target byte and bit field order */
+#endif
 
 
 /* ============================================================================
@@ -18733,6 +18736,9 @@ struct XOSC_tag {
 #ifdef __ghs__
 #pragma ghs endnowarning
 #endif
+#ifdef MPC5744P_HOST
+#pragma scalar_storage_order default
+#endif
 #ifdef  __cplusplus
 }
 #endif
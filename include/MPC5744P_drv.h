@@ -59,6 +59,18 @@ Revision History:
                              Modification     Function
 Author (core ID)              Date D/M/Y       Name		  		Description of Changes
 BRNY001					      08/04/2016 	   ALL		  		Driver created
+BRNY001					      19/10/2026 	   INTC		  		CAN error interrupt priority added
+BRNY001					      19/10/2026 	   UART		  		UART Tx ring buffer size and priority added
+BRNY001					      19/10/2026 	   UART		  		UART Rx ring buffer parameters added
+BRNY001					      19/10/2026 	   LIN		  		LIN master parameters, PIT channel and priority added
+BRNY001					      19/10/2026 	   CLOCK		  		Clocks derived from CLOCK.h, DSPI delays, CAN bit rate
+BRNY001					      19/10/2026 	   TIMER		  		Timer wheel PIT channel and priority added
+BRNY001					      19/10/2026 	   DEFER		  		Deferred work interrupt priority added
+BRNY001					      19/10/2026 	   MEM		  		Local data RAM and RAM code placement macros added
+BRNY001					      19/10/2026 	   MEM		  		Keep-alive RAM placement macro added
+BRNY001					      19/10/2026 	   INTC		  		UART Rx priority above the DSPI ceiling
+BRNY001					      19/10/2026 	   INTC		  		LIN priority above the DSPI ceiling
+BRNY001					      19/10/2026 	   MEM		  		Keep-alive RAM kept across the power-on reset after LPOFF
 
 ---------------------------   ----------    ------------  ------------------------------------------
 ==================================================================================================*/
@@ -67,22 +79,29 @@ BRNY001					      08/04/2016 	   ALL		  		Driver created
 #define _FS65XX_DRV_H_
 
 #include "MPC5744P.h"
+#include "CLOCK.h"
 
 /*==================================================================================================
 *   Configurable parameters
 *	User shall change configuration in this section regarding needs of the application.
 ==================================================================================================*/
-#define MCU_SYS_CLK		200000000		///defines system clock frequency in Hz
-#define MCU_PLL0_CLK		160000000		///defines frequency of the PLL0 clock
-#define DSPI_CLK		MCU_SYS_CLK/4	///defined by the MC_CGM.SC_DC0.R setting
-#define LINFLEX_CLK		MCU_SYS_CLK/2	///given by the HALFSYS_CLK distribution
-#define ADC_CLK			MCU_PLL0_CLK/2	///defined by the MC_CGM.AC0_DC2.R register setting
-#define DSPI_CLK		MCU_SYS_CLK/4	///defined by the MC_CGM.SC_DC0.R setting
-#define PIT_CLK			MCU_SYS_CLK/4	///defined by the MC_CGM.SC_DC0.R setting
+#define MCU_SYS_CLK		CLOCK_SYS_HZ		///system clock frequency in Hz (clock tree in CLOCK.h)
+#define MCU_PLL0_CLK		CLOCK_PLL0_PHI_HZ	///frequency of the PLL0 clock
+#define DSPI_CLK		CLOCK_PBRIDGE_HZ	///defined by the MC_CGM.SC_DC0.R setting
+#define LINFLEX_CLK		CLOCK_HALFSYS_HZ	///given by the HALFSYS_CLK distribution
+#define ADC_CLK			CLOCK_ADC_HZ		///defined by the MC_CGM.AC0_DC2.R register setting
+#define PIT_CLK			CLOCK_PBRIDGE_HZ	///defined by the MC_CGM.SC_DC0.R setting
+#define CAN_CLK			CLOCK_CAN_HZ		///defined by the MC_CGM.AC2_DC0.R setting (CLKSRC = 1)
 
 #define	DSPI_NB	0					///defines number of DSPI module
 #define	DSPI_CS	1			///defines Chip Select
 #define	DSPI_BR	5000000				///defines DSPI baud rate in b/s
+#define	DSPI_CSSCK_NS	160			///defines PCS to SCK delay in ns
+#define	DSPI_ASC_NS		160			///defines after SCK delay in ns
+#define	DSPI_DT_NS		960			///defines delay after transfer in ns
+
+#define	CAN_BR	1000000				///defines CAN bit rate in b/s
+#define	CAN_SAMPLE_POINT	800		///defines CAN sample point in per mille of the bit time
 
 #define	ADC_NB	0	///defines number of ADC module to be used
 #define	ADC_CH	0	///defines number of used ADC channel
@@ -122,13 +141,28 @@ BRNY001					      08/04/2016 	   ALL		  		Driver created
 #define	LINFLEX_UART_NB	1			///defines number of the LINFlex module used for the UART communication
 #define	LINFLEX_UART_BR	921600 ///defines Baud rate in Bd used for the UART <=> PC communication
 #define	MSG_FRAME_SIZE	6	///defines number of bytes for each frame of the UART communication (1 - 4)
-#define LINFLEX_UART_RX_BUFFER_SIZE 1	///defines size of the receive UART buffer
+#define LINFLEX_UART_RX_BUFFER_SIZE 4	///defines size of the receive UART buffer (1 - 4 Bytes per DRF interrupt)
+#define LINFLEX_UART_RX_RING_SIZE 512	///defines size of the receive UART ring buffer (power of 2)
+#define LINFLEX_UART_RX_FRAMES 8		///defines number of idle-line frame marks kept (power of 2)
+#define LINFLEX_UART_RX_IDLE_BITS 22	///defines idle time in bit times flushing the receive UART buffer
+#define LINFLEX_UART_TX_BUFFER_SIZE 256	///defines size of the transmit UART ring buffer (power of 2)
+#define LINFLEX_UART_MAX_ERROR_PPM 20000	///defines maximal UART baud rate error in ppm (checked at compile time)
+
+/****************************************************************************\
+* LIN parameters
+\****************************************************************************/
+#define	LIN_NB	0					///defines number of the LINFlex module used for the LIN master
+#define	LIN_BR	19200				///defines LIN baud rate in Bd
+#define	LIN_TICK_US	5000			///defines time base of the LIN schedule tables in us
+#define	PIT_LIN_CH	3				///defines PIT channel number used for the LIN schedule tick
+#define	LIN_MAX_ERROR_PPM	5000	///defines maximal LIN baud rate error in ppm (checked at compile time)
 
 /****************************************************************************\
 * PIT parameters
 \****************************************************************************/
 #define	PIT_UART_PERIOD	0.0043		///defines period for sending data via UART to PC in seconds
 #define PIT_FS_DELAY	0.000004	///delay between two fail safe commands in seconds
+#define	PIT_TIMER_CH	1			///defines PIT channel number used by the timer wheel (PIT_FS_DELAY_CH is not used)
 
 /****************************************************************************\
 * ADC parameters
@@ -139,13 +173,23 @@ BRNY001					      08/04/2016 	   ALL		  		Driver created
 /****************************************************************************\
 * INTC parameters
 \****************************************************************************/
+#define	INT_UART_RX_PRIORITY	14	///priority for commands receiving from PC, above the ceil (does not use DSPI, one Byte time of latency at 921600 Bd)
+#define	INT_LIN_PRIORITY	13	///priority for the LIN schedule tick and LINFlex LIN interrupts (same for all of them), above the ceil (do not use DSPI, LIN response space)
 #define	INT_CEIL_PRIORITY	12	///ceil priority has to be equal to the highest priority of interrupts sharing DSPI to communicate with FS65xx
 #define	INT_WD_PRIORITY	12	///priority for WD refresh interrupt caused by PIT
 #define	INT_SIUL_PRIORITY	10	///priority for interrupt caused by INT pin
-#define	INT_UART_RX_PRIORITY	8	///priority for commands receiving from PC
+#define	INT_UART_TX_PRIORITY	7	///priority for data transmission to PC (UART Tx ring buffer)
 #define	INT_ADC_PRIORITY	6	///priority for end of conversion of ADC
+#define	INT_TIMER_PRIORITY	5	///priority for the timer wheel wake-up (timer callbacks)
+#define	INT_CAN_ERR_PRIORITY	4	///priority for CAN error, warning and bus-off interrupts
+#define	INT_DEFER_PRIORITY	1	///priority for the deferred work of the interrupts (software interrupt DEFER_SW_IRQ), lowest
 
-#define	INT_CEIL_UART_PRIORITY	8	///ceil UART priority has to be equal to the highest priority of interrupts sharing UART to communicate with PC
+#define	INT_CEIL_UART_PRIORITY	14	///ceil UART priority has to be equal to the highest priority of interrupts sharing UART to communicate with PC
+
+/****************************************************************************\
+* Memory placement parameters (sections.ld)
+\****************************************************************************/
+#define	MEM_RAM_TEXT	1	///1 - handlers marked RAM_TEXT are executed from the system SRAM, 0 - from the flash
 
 /************************************************************************/
 // 	Software defines DO NOT MODIFY Following section
@@ -156,6 +200,22 @@ BRNY001					      08/04/2016 	   ALL		  		Driver created
 #define	fFIRC       16000000
 #define	fSIRC       128000
 
+//Memory placement - CPU0 local data RAM (int_dram, no wait state, not shared with the
+//crossbar masters): hot interrupt data, initialised by the startup code.
+#define	DRAM_BSS	__attribute__ ((section(".dram_bss")))	///cleared by the startup code
+#define	DRAM_DATA	__attribute__ ((section(".dram_data")))	///copied from the flash by the startup code
+//Keep-alive RAM (.vkam, top of the system SRAM): neither copied nor cleared by the startup code,
+//kept across the power-on reset after LPOFF (Vkam supply). Cleared with its ECC (VKAM_Clear,
+//startup.S) after a destructive voltage reset and after the loss of the battery (FS65 BAT_FAIL).
+#define	VKAM_DATA	__attribute__ ((section(".vkam")))
+//Hot leaf interrupt handlers executed from the system SRAM (copied by the startup code), the
+//direct calls to them use long branches. Empty in the host build.
+#if (MEM_RAM_TEXT == 1) && !defined(MPC5744P_HOST)
+#define	RAM_TEXT	__attribute__ ((section(".ram_text"), longcall))
+#else
+#define	RAM_TEXT
+#endif
+
 //Related to EVB
 #define LED1        68 //PCR[68]
 #define LED2        69 //PCR[69]
@@ -0,0 +1,98 @@
+/*******************************************************************************
+*
+* Freescale Semiconductor Inc.
+* (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+* ALL RIGHTS RESERVED.
+*
+********************************************************************************
+*
+* $File Name:       SEQ.h$
+* @file             SEQ.h
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Sequence lock header file
+* @brief            Sequence lock header file
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/****************************************************************************//*!
+*
+*  @mainpage Sequence lock for MPC5744P
+*
+*  @section Intro Introduction
+*
+*	This package contains the sequence lock protecting the data shared by
+*	the interrupt routines and the application (FS65xx register images,
+*	measured voltages). A writer makes the sequence odd during an update, a
+*	reader copies the data and retries if the sequence was odd or changed.
+*
+*  The key features of this package are the following:
+*  - No interrupt masking on the read side, readers never delay the writers
+*  - Nested writers (preempting each other) share one odd period
+*  - Bounded retries, SEQ_BUSY instead of a dead lock
+*
+*  For more information about the functions and configuration items see these documents:
+*
+*******************************************************************************
+*
+* @attention
+*
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : MPC5744P
+*   Dependencies         : MPC5744P - Basic SW drivers.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Driver created
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#ifndef _SEQ_H_
+#define _SEQ_H_
+
+/*==================================================================================================
+*   Configurable parameters
+==================================================================================================*/
+
+#define SEQ_RETRIES				8		///copies tried by SEQ_Read before SEQ_BUSY
+
+/*==================================================================================================
+*   NON - configurable parameters
+*	User should not modify configuration in this section.
+==================================================================================================*/
+
+#define SEQ_OK					0
+#define SEQ_BUSY				1		///writes during all SEQ_RETRIES copies (or reader preempting a writer)
+
+/*==================================================================================================
+*   Structures/Type defines
+==================================================================================================*/
+
+typedef struct {
+	vuint32_t	sequence;				///odd - write in progress
+} SEQ_Lock;
+
+/*==================================================================================================
+*   Function prototypes
+==================================================================================================*/
+
+uint32_t SEQ_WriteBegin(SEQ_Lock*);
+void SEQ_WriteEnd(SEQ_Lock*, uint32_t);
+uint32_t SEQ_ReadBegin(const SEQ_Lock*);
+uint32_t SEQ_ReadValid(const SEQ_Lock*, uint32_t);
+uint32_t SEQ_Read(const SEQ_Lock*, const volatile void*, void*, uint32_t);
+
+#endif
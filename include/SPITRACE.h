@@ -0,0 +1,132 @@
+/*******************************************************************************
+*
+* Freescale Semiconductor Inc.
+* (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+* ALL RIGHTS RESERVED.
+*
+********************************************************************************
+*
+* $File Name:       SPITRACE.h$
+* @file             SPITRACE.h
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      SPI transaction trace header file
+* @brief            SPI transaction trace header file
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/****************************************************************************//*!
+*
+*  @mainpage SPI transaction trace for MPC5744P
+*
+*  @section Intro Introduction
+*
+*	This package contains the recorder of the DSPI frames. DSPI_Read and
+*	DSPI_SendBatch write one record per frame into a circular buffer in the
+*	local data RAM: end of frame time base, sent and received word, DSPI
+*	module, interrupt nesting and the call site of the FS65 command function
+*	that issued the frame (SPITRACE_SITE). The buffer is read back over the
+*	GUI link (GUI_CMD_SPI_TRACE) or sent on CAN (SPITRACE_SendCAN), the host
+*	tools of Host/SPITRACE decode it and replay it into the FS65xx model.
+*
+*  The key features of this package are the following:
+*  - Records written under the DSPI resource ceiling, read without stopping
+*  - Packed records (16 Bytes, MSB first) identical on the UART and on CAN
+*  - No code and no data if SPITRACE_ENABLE is 0
+*
+*  For more information about the functions and configuration items see these documents:
+*
+*******************************************************************************
+*
+* @attention
+*
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : MPC5744P
+*   Dependencies         : MPC5744P - Basic SW drivers.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Driver created
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#ifndef _SPITRACE_H_
+#define _SPITRACE_H_
+
+/*==================================================================================================
+*   Configurable parameters
+==================================================================================================*/
+
+#ifndef SPITRACE_ENABLE
+#define SPITRACE_ENABLE			1		///1 - DSPI frames recorded, 0 - compiled out (may be given by the build)
+#endif
+#define SPITRACE_SIZE_LOG2		7		///log2 of the number of records (16 Bytes each)
+
+/*==================================================================================================
+*   NON - configurable parameters
+*	User should not modify configuration in this section.
+==================================================================================================*/
+
+#define SPITRACE_SIZE			(1 << SPITRACE_SIZE_LOG2)
+#define SPITRACE_RECORD_SIZE	16		///packed record (SPITRACE_Pack)
+
+//Record flags
+#define SPITRACE_FLAG_DSPI		0x03	///DSPI module number
+#define SPITRACE_FLAG_BATCH		0x04	///frame of DSPI_SendBatch
+#define SPITRACE_FLAG_NO_ANSWER	0x08	///no word received within TIME_TIMEOUT_DSPI_US, rx not valid
+
+/***************************************************************************//*!
+*   @brief The macro SPITRACE_SITE stores the call site of the function for
+*			the next records.
+*	@remarks 	Used by the FS65 command functions after the DSPI resource is
+*				taken: the records carry the return address into the driver
+*				function issuing the command (symbols of the ELF file).
+********************************************************************************/
+#if SPITRACE_ENABLE
+#define SPITRACE_SITE()		(SPITRACEsite = (uint32_t)(uintptr_t)__builtin_return_address(0))
+#else
+#define SPITRACE_SITE()
+#endif
+
+/*==================================================================================================
+*   Structures/Type defines
+==================================================================================================*/
+
+typedef struct {
+	uint32_t	time;				///time base (TBL) at the end of the frame
+	uint32_t	site;				///call site of the command function (SPITRACE_SITE), 0 - none
+	uint16_t	tx;					///sent word
+	uint16_t	rx;					///received word
+	uint16_t	sequence;			///record number (lower half of the SPITRACEhead value)
+	uint8_t		flags;				///SPITRACE_FLAG_xxx
+	uint8_t		depth;				///running interrupt handlers (TRACEdepth), 0 - main loop
+} SPITRACE_Record;
+
+extern SPITRACE_Record SPITRACEbuffer[SPITRACE_SIZE];
+extern vuint32_t SPITRACEhead;		///number of written records
+extern uint32_t SPITRACEsite;		///call site of the running command function
+
+/*==================================================================================================
+*   Function prototypes
+==================================================================================================*/
+
+void SPITRACE_Init(void);
+void SPITRACE_Add(uint32_t, uint32_t, uint32_t, uint32_t);
+uint32_t SPITRACE_Copy(uint32_t, SPITRACE_Record*);
+void SPITRACE_Pack(const SPITRACE_Record*, uint8_t*);
+uint32_t SPITRACE_SendCAN(uint8_t, uint8_t, uint32_t, uint32_t);
+
+#endif
@@ -0,0 +1,160 @@
+/*******************************************************************************
+*
+* Freescale Semiconductor Inc.
+* (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+* ALL RIGHTS RESERVED.
+*
+********************************************************************************
+*
+* $File Name:       TIME.h$
+* @file             TIME.h
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Monotonic timebase header file
+* @brief            Monotonic timebase header file
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/****************************************************************************//*!
+*
+*  @mainpage Monotonic timebase for MPC5744P
+*
+*  @section Intro Introduction
+*
+*	This package contains the 64-bit monotonic time source shared by the
+*	drivers (timestamps, timeouts, timers). It is the core time base counting
+*	at the system clock (TIME_TICKS_PER_US ticks per us).
+*
+*  The key features of this package are the following:
+*  - 64-bit tick counter read without tearing (no wrap for 2900 years)
+*  - 32-bit read of the lower word for short intervals
+*  - Conversion helpers between ticks, us and ns
+*  - Bounded waits with a timeout in us and per call site statistics
+*
+*  For more information about the functions and configuration items see these documents:
+*
+*******************************************************************************
+*
+* @attention
+*
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : MPC5744P
+*   Dependencies         : MPC5744P - Basic SW drivers.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   TIME_WAIT	  Bounded waits with per call site statistics
+BRNY001					      19/10/2026 	   TIMEstartupTicks	  Time to main
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#ifndef _TIME_H_
+#define _TIME_H_
+
+/*==================================================================================================
+*   Configurable parameters
+==================================================================================================*/
+
+//Timeouts of the driver waits [us]
+#define TIME_TIMEOUT_ME_MODE_US		10000		///mode transition, XOSC and PLL lock
+#define TIME_TIMEOUT_FCCU_OPS_US	1000		///FCCU operation
+#define TIME_TIMEOUT_ADC_VALID_US	1000		///end of the conversion of a channel
+#define TIME_TIMEOUT_UART_US		20000		///UART/LIN state and transmission of up to 8 Bytes
+#define TIME_TIMEOUT_DSPI_US		1000		///one DSPI word (or the gap between two words of a batch)
+#define TIME_TIMEOUT_CAN_MODE_US	1000		///FlexCAN freeze mode entry and exit
+
+/*==================================================================================================
+*   NON - configurable parameters
+*	User should not modify configuration in this section.
+==================================================================================================*/
+
+#define TIME_TICKS_PER_US		(CLOCK_SYS_HZ / 1000000)	///core time base runs at the system clock
+
+///ticks of a duration in us
+#define TIME_US_TO_TICKS(us)	((uint64_t)(us) * TIME_TICKS_PER_US)
+///ticks of a duration in ns, rounded up (a timeout is never shorter)
+#define TIME_NS_TO_TICKS(ns)	(((uint64_t)(ns) * TIME_TICKS_PER_US + 999) / 1000)
+
+//Wait call sites (items of TIMEwait)
+#define TIME_WAIT_ME_MODE		0		///MC_MODE_INIT: S_MTRANS, DRUN entered, S_XOSC
+#define TIME_WAIT_FCCU_OPS		1		///FCCU_SetProtocol: CTRL[OPS]
+#define TIME_WAIT_ADC_VALID		2		///ADC_GetChannelValue: CDR[VALID]
+#define TIME_WAIT_UART_STATE	3		///LINFLEX_SendUART: LINSR[LINS] idle or sleep
+#define TIME_WAIT_UART_DTF		4		///LINFLEX_SendUART: UARTSR[DTFTFF]
+#define TIME_WAIT_LIN_DTF		5		///LINFLEX_SendFrameLIN: LINSR[DTF]
+#define TIME_WAIT_DSPI_TCF		6		///DSPI_Send: SR[TCF]
+#define TIME_WAIT_DSPI_RFDF		7		///DSPI_Read, DSPI_ReadWithInt: SR[RFDF]
+#define TIME_WAIT_DSPI_BATCH	8		///DSPI_SendBatch: longest gap between two received words
+#define TIME_WAIT_CAN_FREEZE	9		///CAN_Init: freeze mode entered
+#define TIME_WAIT_CAN_START		10		///CAN_Init: freeze mode left
+#define TIME_WAIT_NB			11
+
+#define TIME_WAIT_OK			0
+#define TIME_WAIT_TIMEOUT		1
+
+/***************************************************************************//*!
+*   @brief The macro TIME_WAIT waits until a condition is true or a timeout
+*			elapses.
+*	@par Include
+*					TIME.h
+* 	@par Description
+*					The condition is evaluated once per iteration, the duration
+*					is measured on the lower word of the time base and recorded
+*					in TIMEwait[site] (see TIME_WaitDone).
+*	@param[in] site - TIME_WAIT_xxx call site.
+*	@param[in] timeoutUs - Timeout [us] (below 21 s).
+*	@param[in] condition - Expression ending the wait.
+*	@return TIME_WAIT_OK / TIME_WAIT_TIMEOUT.
+*	@par Code sample
+*			(void)TIME_WAIT(TIME_WAIT_FCCU_OPS, TIME_TIMEOUT_FCCU_OPS_US, FCCU.CTRL.B.OPS == FCCU_OPS_SUCCESS);
+********************************************************************************/
+#define TIME_WAIT(site, timeoutUs, condition)													\
+	({	uint32_t waitStart_ = TIME_ReadLow();													\
+		uint32_t waitTicks_;																	\
+		uint32_t waitDone_;																		\
+		do {																					\
+			waitDone_ = (condition) ? 1 : 0;													\
+			waitTicks_ = TIME_ReadLow() - waitStart_;											\
+		} while ((waitDone_ == 0) && (waitTicks_ < (uint32_t)TIME_US_TO_TICKS(timeoutUs)));		\
+		TIME_WaitDone((site), waitTicks_, waitDone_); })
+
+/*==================================================================================================
+*   Structures/Type defines
+==================================================================================================*/
+
+typedef struct {
+	uint32_t	count;				///finished waits
+	uint32_t	timeouts;			///waits ended by the timeout
+	uint32_t	maxTicks;			///longest wait [time base ticks]
+	uint32_t	lastTicks;			///last wait [time base ticks]
+} TIME_WaitStats;
+
+extern TIME_WaitStats TIMEwait[TIME_WAIT_NB];
+extern uint32_t TIMEstartupTicks;		///time base at the first TIME_Init: reset to main [16 MHz IRCOSC cycles]
+
+/*==================================================================================================
+*   Function prototypes
+==================================================================================================*/
+
+void TIME_Init(void);
+uint64_t TIME_Read(void);
+uint32_t TIME_ReadLow(void);
+uint64_t TIME_TicksToUs(uint64_t);
+uint64_t TIME_TicksToNs(uint64_t);
+uint32_t TIME_WaitDone(uint32_t, uint32_t, uint32_t);
+
+#endif
@@ -0,0 +1,130 @@
+/*******************************************************************************
+*
+* Freescale Semiconductor Inc.
+* (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+* ALL RIGHTS RESERVED.
+*
+********************************************************************************
+*
+* $File Name:       TIMER.h$
+* @file             TIMER.h
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Software timer wheel header file
+* @brief            Software timer wheel header file
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/****************************************************************************//*!
+*
+*  @mainpage Software timer wheel for MPC5744P
+*
+*  @section Intro Introduction
+*
+*	This package contains software timers multiplexed on one PIT channel
+*	(PIT_TIMER_CH). Timers are kept in a hierarchical timer wheel and the PIT
+*	channel is programmed as a one-shot to the nearest deadline only.
+*
+*  The key features of this package are the following:
+*  - One-shot and periodic timers with a callback, us resolution
+*  - Constant time start and cancel
+*  - Tickless, no interrupt between two deadlines
+*  - Callbacks executed in the PIT interrupt (INT_TIMER_PRIORITY)
+*
+*  For more information about the functions and configuration items see these documents:
+*
+*******************************************************************************
+*
+* @attention
+*
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : MPC5744P
+*   Dependencies         : MPC5744P - Basic SW drivers.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Driver created
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#ifndef _TIMER_H_
+#define _TIMER_H_
+
+/*==================================================================================================
+*   Configurable parameters
+==================================================================================================*/
+
+#define TIMER_MAX_SLEEP_US		1000000		///longest one-shot period of the PIT channel [us]
+
+/*==================================================================================================
+*   NON - configurable parameters
+*	User should not modify configuration in this section.
+==================================================================================================*/
+
+#define TIMER_SLOT_BITS			6
+#define TIMER_SLOTS				(1 << TIMER_SLOT_BITS)		///slots per wheel level
+#define TIMER_LEVELS			6							///levels cover 36 bits of the time difference
+#define TIMER_NO_DEADLINE		0xFFFFFFFFFFFFFFFFull
+
+/*==================================================================================================
+*   Structures/Type defines
+==================================================================================================*/
+
+typedef void (*TIMER_Callback)(void *p_arg);
+
+typedef struct TIMER_Link_tag {
+	struct TIMER_Link_tag *p_next;
+	struct TIMER_Link_tag *p_prev;
+} TIMER_Link;
+
+typedef struct {
+	TIMER_Link		link;				///wheel slot list, shall be the first item
+	uint64_t		expiry;				///absolute deadline [us]
+	uint32_t		period;				///reload period [us], 0 - one-shot
+	uint32_t		slot;				///level * TIMER_SLOTS + slot index while running
+	uint32_t		running;			///1 - linked in the wheel
+	TIMER_Callback	callback;
+	void			*p_arg;
+} TIMER_Struct;
+
+typedef struct {
+	TIMER_Link		slots[TIMER_LEVELS][TIMER_SLOTS];
+	uint64_t		occupied[TIMER_LEVELS];	///bit i set - slots[level][i] is not empty
+	uint64_t		now;				///wheel time [us], no timer expires before it
+	uint64_t		deadline;			///programmed wake-up [us], TIMER_NO_DEADLINE if idle
+	/* statistics */
+	uint32_t		started;
+	uint32_t		cancelled;
+	uint32_t		expired;
+	uint32_t		cascaded;			///timers moved down to a lower level
+	uint32_t		wakeups;			///PIT interrupts
+} TIMER_WheelStruct;
+
+extern TIMER_WheelStruct TIMERwheel;
+
+/*==================================================================================================
+*   Function prototypes
+==================================================================================================*/
+
+void TIMER_Init(void);
+void TIMER_Start(TIMER_Struct*, uint32_t, uint32_t, TIMER_Callback, void*);
+void TIMER_Cancel(TIMER_Struct*);
+uint32_t TIMER_IsRunning(const TIMER_Struct*);
+uint64_t TIMER_Now(void);
+void TIMER_Process(uint64_t);
+void TIMER_IsrPIT(void);
+
+#endif
@@ -0,0 +1,122 @@
+/*******************************************************************************
+*
+* Freescale Semiconductor Inc.
+* (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+* ALL RIGHTS RESERVED.
+*
+********************************************************************************
+*
+* $File Name:       TRACE.h$
+* @file             TRACE.h
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Interrupt entry/exit trace header file
+* @brief            Interrupt entry/exit trace header file
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/****************************************************************************//*!
+*
+*  @mainpage Interrupt entry/exit trace for MPC5744P
+*
+*  @section Intro Introduction
+*
+*	This package contains the trace of the external interrupts. The IVOR4
+*	dispatcher (intc_sw_handlers.S) writes one record per interrupt into a
+*	circular buffer in the local data RAM: vector, entry and exit time base
+*	and nesting depth. The statistics of a vector (execution time without
+*	preemptions, number of preemptions) are derived from the buffer.
+*
+*  The key features of this package are the following:
+*  - Single instrumentation point, no change of the interrupt handlers
+*  - Lock-free buffer, the record is written with MSR[EE] cleared
+*  - 28 instructions per interrupt without load-use stalls, none if TRACE_ISR is 0
+*
+*  For more information about the functions and configuration items see these documents:
+*
+*******************************************************************************
+*
+* @attention
+*	This header is included by intc_sw_handlers.S, only preprocessor
+*	definitions are allowed outside of the __ASSEMBLER__ condition.
+*
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : MPC5744P
+*   Dependencies         : MPC5744P - Basic SW drivers.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   ALL		  TRACE_ISR off by default, dispatcher loads scheduled
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#ifndef _TRACE_H_
+#define _TRACE_H_
+
+/*==================================================================================================
+*   Configurable parameters
+==================================================================================================*/
+
+#ifndef TRACE_ISR
+#define TRACE_ISR				0		///1 - interrupt trace in the IVOR4 dispatcher, 0 - compiled out (may be given by the build)
+#endif
+#define TRACE_SIZE_LOG2			8		///log2 of the number of records (16 Bytes each)
+
+/*==================================================================================================
+*   NON - configurable parameters
+*	User should not modify configuration in this section.
+==================================================================================================*/
+
+#define TRACE_SIZE				(1 << TRACE_SIZE_LOG2)
+#define TRACE_RECORD_SIZE		16
+
+#ifndef __ASSEMBLER__
+
+/*==================================================================================================
+*   Structures/Type defines
+==================================================================================================*/
+
+typedef struct {
+	uint32_t	entry;				///time base (TBL) after the context save
+	uint32_t	exit;				///time base (TBL) after the handler return
+	uint16_t	vector;				///INTC vector number
+	uint16_t	depth;				///0 - not nested, n - nested in n running handlers
+	uint32_t	sequence;			///record number (TRACEhead value of the record)
+} TRACE_Record;
+
+typedef struct {
+	uint32_t	count;				///records of the vector found in the buffer
+	uint32_t	preemptions;		///interrupts nested in the handler
+	uint32_t	minTicks;			///execution time without preemptions [time base ticks]
+	uint32_t	maxTicks;
+	uint32_t	meanTicks;
+} TRACE_Stats;
+
+extern TRACE_Record TRACEbuffer[TRACE_SIZE];
+extern vuint32_t TRACEhead;			///number of written records
+extern vuint32_t TRACEdepth;		///number of running interrupt handlers
+
+/*==================================================================================================
+*   Function prototypes
+==================================================================================================*/
+
+void TRACE_Init(void);
+void TRACE_GetStats(uint32_t, TRACE_Stats*);
+
+#endif
+
+#endif
@@ -10,9 +10,16 @@
 /* REV      AUTHOR        DATE        DESCRIPTION OF CHANGE               */
 /* ---   -----------    ----------    ---------------------               */
 /* 0.1    R. Moran       10/12/2008    Initial Version                    */
+/* 0.2    BRNY001        19/10/2026    FlexCAN 0 error vectors priority   */
+/* 0.3    BRNY001        19/10/2026    LINFlex 1 Tx vector priority       */
+/* 0.4    BRNY001        19/10/2026    LIN master vectors priority        */
+/* 0.5    BRNY001        19/10/2026    Timer wheel vector priority        */
+/* 0.6    BRNY001        19/10/2026    Deferred work vector priority      */
+/* 0.7    BRNY001        19/10/2026    Host build (MPC5744P_HOST) ports   */
 /**************************************************************************/
 #include "derivative.h" /* include peripheral declarations */
 #include "mpc5744p_drv.h"
+#include "DEFER.h"
 
 #define stringify(s) tostring(s)
 #define tostring(s) #s
@@ -37,6 +44,9 @@ extern const uint32_t IntcIsrVectorTable[];
 /*                      EXTERNAL PROTOTYPES                               */
 /*========================================================================*/
 extern void VTABLE (void);
+#ifdef MPC5744P_HOST
+void INTC_PortEnable (void);    /* supplied by the host tool (MSR[EE] set) */
+#endif
 
 /*========================================================================*/
 /*                          FUNCTIONS                                     */
@@ -45,10 +55,12 @@ extern void VTABLE (void);
 /* FUNCTION     : SetIVPR                                                 */
 /* PURPOSE      : Initialise Core IVPR                                    */
 /**************************************************************************/
+#ifndef MPC5744P_HOST
 void SetIVPR (register unsigned int x)
 {
 	__asm__("mtIVPR %0 \n\t" : : "r"(x));
 }
+#endif
 
 #if defined(MPC5777C)
 void InitIVORS (void)
@@ -114,7 +126,7 @@ void InitINTC(void) {
 #if defined(MPC574xP)
     temp = INTC.IACKR0.R;
     /* Set INTC ISR vector table base addr. */
-    INTC.IACKR0.R = (uint32_t) &IntcIsrVectorTable[0];
+    INTC.IACKR0.R = (uint32_t) (uintptr_t) &IntcIsrVectorTable[0];
 #elif defined(MPC5777C)
     temp = INTC.IACKR_PRC[coreId].R;
     /* Set INTC ISR vector table base addr. */
@@ -148,7 +160,11 @@ void enableIrq(void) {
     INTC.CPR[coreId].R = 0U;
 #endif
     /* Enable external interrupts */
+#ifdef MPC5744P_HOST
+    INTC_PortEnable();
+#else
     __asm__(" wrteei 1");
+#endif
 }
 
 
@@ -160,7 +176,9 @@ void enableIrq(void) {
 void xcptn_xmpl(void) {
     
     /* Initialise Core IVPR */
+#ifndef MPC5744P_HOST
     SetIVPR ((unsigned int) &VTABLE);
+#endif
 #if defined(MPC5777C)
     InitIVORS();
 #endif
@@ -168,11 +186,20 @@ void xcptn_xmpl(void) {
     InitINTC();
 
     /* Configure priorities */
+    INTC.PSR[DEFER_SW_IRQ].B.PRIN = INT_DEFER_PRIORITY;	//software settable interrupt : deferred work
     INTC.PSR[226].B.PRIN = INT_WD_PRIORITY;				//PIT0 channel0 : watchdog
+    INTC.PSR[227].B.PRIN = INT_TIMER_PRIORITY;			//PIT0 channel1 : timer wheel
     INTC.PSR[228].B.PRIN = 0;							//PIT0 channel2
+    INTC.PSR[229].B.PRIN = INT_LIN_PRIORITY;			//PIT0 channel3 : LIN schedule tick
     INTC.PSR[243].B.PRIN = INT_SIUL_PRIORITY;			//SIUL2 external interrupt 0 = INTb
+    INTC.PSR[376].B.PRIN = INT_LIN_PRIORITY;			//LINFlex 0 Rx
+    INTC.PSR[377].B.PRIN = INT_LIN_PRIORITY;			//LINFlex 0 Tx
+    INTC.PSR[378].B.PRIN = INT_LIN_PRIORITY;			//LINFlex 0 Err
     INTC.PSR[380].B.PRIN = INT_UART_RX_PRIORITY;		//LINFlex 1 Rx
+    INTC.PSR[381].B.PRIN = INT_UART_TX_PRIORITY;		//LINFlex 1 Tx
     INTC.PSR[496].B.PRIN = INT_ADC_PRIORITY;			//ADC0 End of Conv
+    INTC.PSR[520].B.PRIN = INT_CAN_ERR_PRIORITY;		//FlexCAN 0 ESR[ERR_INT]
+    INTC.PSR[521].B.PRIN = INT_CAN_ERR_PRIORITY;		//FlexCAN 0 bus-off, Tx/Rx warning
     
     /* Enable interrupts */
     enableIrq();
@@ -56,15 +56,18 @@ Revision History:
                              Modification     Function
 Author (core ID)              Date D/M/Y       Name		  Description of Changes
 B35993		 				  04/07/2014 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   ADC_SetSamplingTime	  Integer sampling time in ns (CLOCK module)
+BRNY001					      19/10/2026 	   ADC_GetChannelValue	  Time-bounded VALID wait (TIME_WAIT)
 
 ---------------------------   ----------    ------------  ------------------------------------------
 ==================================================================================================*/
 
 
-#include <math.h>
 #include "MPC5744P_drv.h"
+#include "CLOCK.h"
 #include "SIUL.h"
 #include "ADC.h"
+#include "TIME.h"
 
 /****************************************************************************
 * STATUS functions
@@ -698,6 +701,8 @@ void ADC_AutoClockOffDisable(uint8_t nbADC){
 *	@remarks 	The function returns only <i>right aligned</i> data from the CDATA register. 
 *				If the ADC is configured to be left aligned, this function will 
 *				return only the eight lower bits shifted by four to the left.
+*				After TIME_TIMEOUT_ADC_VALID_US the last (not valid) data are
+*				returned and the timeout is counted in TIMEwait[TIME_WAIT_ADC_VALID].
 *	@par Code sample
 *			ADC_GetChannelValue(1, 0);
 *			- Command returns result of the conversion for ADC1, channel 0.
@@ -717,7 +722,7 @@ uint16_t ADC_GetChannelValue(uint8_t nbADC, uint32_t nbCH){
 		}
 	
 	
-	while (p_ADC->CDR[nbCH].B.VALID != 1){}; 		//Wait for last scan to complete
+	(void)TIME_WAIT(TIME_WAIT_ADC_VALID, TIME_TIMEOUT_ADC_VALID_US, p_ADC->CDR[nbCH].B.VALID == 1);	//Wait for last scan to complete
 	result= (uint16_t)p_ADC->CDR[nbCH].B.CDATA; 				//Read conversion result data
 
 	return result;	
@@ -1406,23 +1411,21 @@ void ADC_EnableSampleBypass(uint8_t nbADC){
 *					the module clock frequency (sysClk) and on the desired 
 *					sampling phase duration.
 * 	@param[in] nbADC - Number of ADC module (0 or 1).
-*	@param[in] sysClk - Frequency of the system clock.
-*	@param[in] samplingTime - 	Desired sampling time. Time is limited by 
+*	@param[in] sysClk - Frequency of the system clock [Hz].
+*	@param[in] samplingTime - 	Desired sampling time [ns]. Time is limited by 
 *								its maximal and minimal values depending on 
 *								the clock frequency and ADCLKSEL bit 
 *								(ADCLKSEL = 0 by default).
-*	@remarks 	Values of the frequency should be added in basic units [Hz] 
-*				as well as in their multiples, but everytime with respect to 
-*				the units of sampling time. The ratio of their multiples has 
-*				to be everytime equal to 1. E.g. [Hz]/[s], [kHz]/[ms], 
-*				[MHz]/[us] etc. Minimal and maximal time possible to set depend 
+*	@remarks 	Minimal and maximal time possible to set depend 
 *				on the clock frequency and on the ADCLKSEL bit setting 
-*				(see external Excel file for these values).
+*				(INPSAMP 8 - 255, see CLOCK_ComputeAdcSampling).
+*	@par Code sample
+*			ADC_SetSamplingTime(0, ADC_CLK, 600);
+*			- Sets 600 ns sampling phase of ADC0.
 ********************************************************************************/
-void ADC_SetSamplingTime(uint8_t nbADC, uint32_t sysClk, float samplingTime){
+void ADC_SetSamplingTime(uint8_t nbADC, uint32_t sysClk, uint32_t samplingTime){
 		volatile struct ADC_tag *p_ADC;
 		
-		float Tck;
 		uint32_t INSAMPvalue = 0;
 		
 		//pointer settings	
@@ -1436,27 +1439,11 @@ void ADC_SetSamplingTime(uint8_t nbADC, uint32_t sysClk, float samplingTime){
 		
 		
 		if(p_ADC->MCR.B.ADCLKSEL == 1){		//timing period Tck
-			Tck = (float)2.0/sysClk;
-		}
-		else{
-			Tck = (float)1.0/sysClk;
+			sysClk /= 2;
 		}
 		
-		INSAMPvalue = (samplingTime/Tck) + 1;
-		
-		if((INSAMPvalue >= 8) && (INSAMPvalue<= 255)){		//if value is in the borders
-			p_ADC->CTR0.B.INPSAMP = INSAMPvalue;							//sampling time
-		}
-		else{
-			if(INSAMPvalue < 8){						//if smaller than set the smallest possible value
-				p_ADC->CTR0.B.INPSAMP = 8;
-			}
-			else{														//if greater than set the greatest possible value
-				p_ADC->CTR0.B.INPSAMP = 255;
-			}
-			
-			
-		}		
+		(void)CLOCK_ComputeAdcSampling(sysClk, samplingTime, &INSAMPvalue);		//limited to 8 - 255
+		p_ADC->CTR0.B.INPSAMP = INSAMPvalue;							//sampling time
 	
 }
 
@@ -0,0 +1,242 @@
+/*******************************************************************************
+*
+* Freescale Semiconductor Inc.
+* (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+* ALL RIGHTS RESERVED.
+*
+********************************************************************************
+*
+* $File Name:       BOOT.c$
+* @file             BOOT.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Boot sequencer source file
+* @brief            Boot sequencer source file
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/****************************************************************************//*!
+*
+*  @mainpage Boot sequencer for MPC5744P
+*
+*  @section Intro Introduction
+*
+*	This package contains a cooperative scheduler of the boot stages. The
+*	table is scanned from the first stage, the first stage whose
+*	dependencies are done and whose wait is over is called, then the scan
+*	starts again: an earlier stage of the table always gets the CPU first.
+*	Nothing is preempted, a stage keeps the CPU until it returns.
+*
+*	The critical path is rebuilt backwards from the stage done last: the
+*	predecessor of a stage is its dependency done last (binding). The time
+*	between the ready and the start of a stage is the time the CPU spent in
+*	other stages.
+*
+*  The key features of this package are the following:
+*  - No interrupt, no timer: the waits are compared with the time base
+*  - Statistics kept after the boot (BOOTstats)
+*
+*  For more information about the functions and configuration items see these documents:
+*
+*******************************************************************************
+*
+* @attention
+*
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : MPC5744P
+*   Dependencies         : MPC5744P - Basic SW drivers.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Driver created
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#include "MPC5744P_drv.h"
+#include "TIME.h"
+#include "BOOT.h"
+
+BOOT_StageStats BOOTstats[BOOT_STAGES_MAX];
+const BOOT_Stage *BOOTtable;
+uint32_t BOOTstages;
+uint32_t BOOToperationalTicks;
+
+/***************************************************************************//*!
+*   @brief The function BOOT_Start records the start of a stage.
+*	@par Include
+*					BOOT.h
+* 	@par Description
+*					The ready time is the end of the dependency done last,
+*					which is the predecessor on the critical path.
+*	@param[in] p_stages - Stage table.
+*	@param[in] stage - Number of the started stage.
+*	@param[in] now - Current time [ticks from BOOT_Run].
+********************************************************************************/
+static void BOOT_Start(const BOOT_Stage *p_stages, uint32_t stage, uint32_t now)
+{
+	BOOT_StageStats *p_stats = &BOOTstats[stage];
+	uint32_t i;
+
+	p_stats->ready = 0;
+	p_stats->binding = BOOT_NONE;
+	for (i = 0; i < BOOTstages; i++)
+	{
+		if (((p_stages[stage].after & BOOT_AFTER(i)) != 0) && (BOOTstats[i].end >= p_stats->ready))
+		{
+			p_stats->ready = BOOTstats[i].end;
+			p_stats->binding = (uint8_t)i;
+		}
+	}
+	p_stats->start = now;
+}
+
+/***************************************************************************//*!
+*   @brief The function BOOT_Run runs the boot stages.
+*	@par Include
+*					BOOT.h
+* 	@par Description
+*					The stages are called until all of them are done. A stage
+*					returning BOOT_WAIT is called again when the time base
+*					reaches the returned wait, the other ready stages run in
+*					the meantime; when all started stages wait, the function
+*					polls the time base.
+*	@param[in] p_stages - Stage table, the order gives the priority.
+*	@param[in] nbStages - Number of stages (BOOT_STAGES_MAX at most).
+*	@return 	BOOT_OK / BOOT_BLOCKED (a stage waits for a dependency
+*				which never ends, the stages not done are skipped).
+*	@remarks 	The time base shall run (TIME_Init). The waits are measured
+*				on the lower word of the time base (boot below 21 s).
+*	@par Code sample
+*			BOOT_Run(mainBoot, MAIN_STAGE_NB);
+********************************************************************************/
+uint32_t BOOT_Run(const BOOT_Stage *p_stages, uint32_t nbStages)
+{
+	uint32_t origin;
+	uint32_t done = 0;
+	uint32_t all;
+	uint32_t waiting;
+	uint32_t now;
+	uint32_t waitUs;
+	uint32_t result;
+	uint32_t i;
+
+	if (nbStages > BOOT_STAGES_MAX)
+	{
+		nbStages = BOOT_STAGES_MAX;
+	}
+	BOOTtable = p_stages;
+	BOOTstages = nbStages;
+	all = (nbStages < 32) ? (BOOT_AFTER(nbStages) - 1) : 0xFFFFFFFF;
+	for (i = 0; i < nbStages; i++)
+	{
+		BOOTstats[i].ready = 0;
+		BOOTstats[i].start = 0;
+		BOOTstats[i].end = 0;
+		BOOTstats[i].busyTicks = 0;
+		BOOTstats[i].calls = 0;
+		BOOTstats[i].state = BOOT_STATE_IDLE;
+		BOOTstats[i].binding = BOOT_NONE;
+	}
+
+	origin = TIME_ReadLow();
+	while (done != all)
+	{
+		waiting = 0;
+		for (i = 0; i < nbStages; i++)
+		{
+			BOOT_StageStats *p_stats = &BOOTstats[i];
+
+			if ((p_stats->state == BOOT_STATE_DONE) || ((p_stages[i].after & ~done) != 0))
+			{
+				continue;
+			}
+			if ((p_stats->state == BOOT_STATE_WAITING) && ((int32_t)(TIME_ReadLow() - p_stats->due) < 0))
+			{
+				waiting = 1;
+				continue;
+			}
+			now = TIME_ReadLow();
+			if (p_stats->state == BOOT_STATE_IDLE)
+			{
+				BOOT_Start(p_stages, i, now - origin);
+			}
+			waitUs = 0;
+			result = p_stages[i].run(&waitUs);
+			p_stats->calls++;
+			p_stats->busyTicks += TIME_ReadLow() - now;
+			if (result == BOOT_WAIT)
+			{
+				p_stats->state = BOOT_STATE_WAITING;
+				p_stats->due = TIME_ReadLow() + (uint32_t)TIME_US_TO_TICKS(waitUs);
+			}
+			else
+			{
+				p_stats->state = BOOT_STATE_DONE;
+				p_stats->end = TIME_ReadLow() - origin;
+				done |= BOOT_AFTER(i);
+			}
+			waiting = 1;
+			break;								//scan again from the first stage
+		}
+		if (waiting == 0)
+		{
+			BOOToperationalTicks = TIME_ReadLow() - origin;
+			return BOOT_BLOCKED;
+		}
+	}
+	BOOToperationalTicks = TIME_ReadLow() - origin;
+	return BOOT_OK;
+}
+
+/***************************************************************************//*!
+*   @brief The function BOOT_CriticalPath returns the critical path of the
+*			last boot.
+*	@par Include
+*					BOOT.h
+* 	@par Description
+*					The path starts at the stage done last and follows the
+*					binding dependencies back to a stage without dependency.
+*	@param[out] p_path - Stage numbers, the first stage of the boot first.
+*	@param[in] maxStages - Size of p_path.
+*	@return 	Number of stages of the path (at most maxStages).
+*	@par Code sample
+*			nb = BOOT_CriticalPath(path, BOOT_STAGES_MAX);
+********************************************************************************/
+uint32_t BOOT_CriticalPath(uint8_t *p_path, uint32_t maxStages)
+{
+	uint32_t last = BOOT_NONE;
+	uint32_t nb = 0;
+	uint32_t stage;
+	uint32_t i;
+
+	for (i = 0; i < BOOTstages; i++)
+	{
+		if ((BOOTstats[i].state == BOOT_STATE_DONE) && ((last == BOOT_NONE) || (BOOTstats[i].end >= BOOTstats[last].end)))
+		{
+			last = i;
+		}
+	}
+	for (stage = last; (stage != BOOT_NONE) && (nb < maxStages); stage = BOOTstats[stage].binding)
+	{
+		nb++;
+	}
+	i = nb;
+	for (stage = last; i > 0; stage = BOOTstats[stage].binding)
+	{
+		p_path[--i] = (uint8_t)stage;
+	}
+	return nb;
+}
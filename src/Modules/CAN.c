@@ -34,6 +34,7 @@
 *  - Initializate CAN module 
 *  - Send CAN frames
 *  - Disable CAN module
+*  - Handle error states (warning, passive, bus-off) and controlled bus-off recovery
 *
 *  For more information about the functions and configuration items see these documents: 
 *
@@ -54,16 +55,28 @@ Revision History:
                              Modification     Function
 Author (core ID)              Date D/M/Y       Name		  Description of Changes
 B35993		 				  23/07/2014 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   CAN_IsrError	  Error state machine and bus-off recovery added
+BRNY001					      19/10/2026 	   CAN_Init	  Bit timing computed from CAN_CLK, CAN_BR and CAN_SAMPLE_POINT
+BRNY001					      19/10/2026 	   CAN_Init	  Time-bounded freeze mode waits (TIME_WAIT)
+BRNY001					      19/10/2026 	   CAN_IsrError	  Error states and Tx shadows in the local data RAM (DRAM_BSS)
+BRNY001					      19/10/2026 	   CAN_Send	  Priority raised only from a lower priority context
+BRNY001					      19/10/2026 	   CAN_Init	  Internal buffers cleared through CAN_reserved4 (no RXIMR overrun)
+BRNY001					      19/10/2026 	   CAN_IsrBusOff	  Recovery sequence started by the bus-off interrupt (no hold time)
 
 ---------------------------   ----------    ------------  ------------------------------------------
 ==================================================================================================*/
 
 #include "MPC5744P_drv.h"
+#include "CLOCK.h"
 #include "CAN.h"
 #include "SIUL.h"
+#include "TIME.h"
 
 volatile struct CAN_tag *CAN[3] = {&CAN_0, &CAN_1, &CAN_2};
 
+DRAM_BSS CAN_ErrorStruct CANerror[CAN_MODULES_NB];		///error state and recovery statistics of each CAN module
+DRAM_BSS CAN_TxShadowStruct CANtxShadow[CAN_MODULES_NB];	///copy of the frames loaded into the Tx message buffers
+
 /***************************************************************************//*!
 *   @brief The function CAN_ConfigurePads configures pads of the CANx module.
 *	@par Include 
@@ -103,7 +116,8 @@ void CAN_ConfigurePads(uint8_t nbModule){
 *					the following parameters: <br>	
 *					 - Number of message buffers - 32. <br> 	 
 *					 - Crystal oscillator is used as a clock source. <br>	
-*					 - CAN bus speed - 500 kBd (if a 40-MHz crystal is populated).	
+*					 - CAN bus speed - CAN_BR, sample point CAN_SAMPLE_POINT 
+*					   (bit timing computed from CAN_CLK, see CLOCK_ComputeCan).	
 * 	@param[in] nbModule
 *				Number of the CAN module (0 or 1).
 *	@remarks Clock source from CAN module is configured to be derived directly 
@@ -114,8 +128,11 @@ void CAN_ConfigurePads(uint8_t nbModule){
 ********************************************************************************/
 void CAN_Init(uint8_t nbModule)
 {
+    CLOCK_CanTiming timing;
     uint32_t i; 
 
+    (void)CLOCK_ComputeCan(CAN_CLK, CAN_BR, CAN_SAMPLE_POINT, &timing);
+
     CAN_ConfigurePads(nbModule);
     
     //CLKSRC is 1 for PLL, MDIS still set after reset 
@@ -126,29 +143,26 @@ void CAN_Init(uint8_t nbModule)
     CAN[nbModule]->MCR.B.FRZ = 1;
     CAN[nbModule]->MCR.B.HALT = 1;
 
-    for(i=0; i<2000; i++)
-    {
-        if (CAN[nbModule]->MCR.B.NOTRDY && CAN[nbModule]->MCR.B.FRZACK && !CAN[nbModule]->MCR.B.LPMACK)
-            break;
-    }
+    (void)TIME_WAIT(TIME_WAIT_CAN_FREEZE, TIME_TIMEOUT_CAN_MODE_US,
+                    CAN[nbModule]->MCR.B.NOTRDY && CAN[nbModule]->MCR.B.FRZACK && !CAN[nbModule]->MCR.B.LPMACK);
 
     //Configuration
-    CAN[nbModule]->CTRL1.B.PRESDIV = 3;       // 40 MHz / (3+1) = 10 MHz
-    CAN[nbModule]->CTRL1.B.RJW = 1;
-    CAN[nbModule]->CTRL1.B.PSEG1 = 1;
-    CAN[nbModule]->CTRL1.B.PSEG2 = 1;
-    CAN[nbModule]->CTRL1.B.BOFFMSK = 0;
-    CAN[nbModule]->CTRL1.B.ERRMSK = 0;
+    CAN[nbModule]->CTRL1.B.PRESDIV = timing.presdiv;   // 40 MHz / (1+1) = 20 MHz, 20 tq per bit at 1 Mb/s
+    CAN[nbModule]->CTRL1.B.RJW = timing.rjw;
+    CAN[nbModule]->CTRL1.B.PSEG1 = timing.pseg1;
+    CAN[nbModule]->CTRL1.B.PSEG2 = timing.pseg2;
+    CAN[nbModule]->CTRL1.B.BOFFMSK = 1;       // bus-off interrupt enabled
+    CAN[nbModule]->CTRL1.B.ERRMSK = 1;        // error interrupt enabled
     CAN[nbModule]->CTRL1.B.CLKSRC = 1;        // read-only in freeze mode (value for read-back)
     CAN[nbModule]->CTRL1.B.LPB = 0;           // loopback mode is set 
-    CAN[nbModule]->CTRL1.B.TWRNMSK = 0;
-    CAN[nbModule]->CTRL1.B.RWRNMSK = 0;
+    CAN[nbModule]->CTRL1.B.TWRNMSK = 1;       // Tx warning interrupt enabled
+    CAN[nbModule]->CTRL1.B.RWRNMSK = 1;       // Rx warning interrupt enabled
     CAN[nbModule]->CTRL1.B.SMP = 0;
-    CAN[nbModule]->CTRL1.B.BOFFREC = 0;
+    CAN[nbModule]->CTRL1.B.BOFFREC = 1;       // automatic bus-off recovery disabled, see CAN_ErrorTask
     CAN[nbModule]->CTRL1.B.TSYN = 0;
     CAN[nbModule]->CTRL1.B.LBUF = 0;
     CAN[nbModule]->CTRL1.B.LOM = 0;
-    CAN[nbModule]->CTRL1.B.PROPSEG = 4;
+    CAN[nbModule]->CTRL1.B.PROPSEG = timing.propseg;
 
     CAN[nbModule]->CTRL2.B.ECRWRE = 0;
     CAN[nbModule]->CTRL2.B.WRMFRZ = 1;        // allow SRAM access in freeze mode
@@ -166,7 +180,7 @@ void CAN_Init(uint8_t nbModule)
     CAN[nbModule]->MCR.B.SOFTRST = 0;
     CAN[nbModule]->MCR.B.FRZACK = 1;
     CAN[nbModule]->MCR.B.SUPV = 1;
-    CAN[nbModule]->MCR.B.WRNEN = 0;
+    CAN[nbModule]->MCR.B.WRNEN = 1;           // TWRNINT/RWRNINT flags enabled
     CAN[nbModule]->MCR.B.LPMACK = 0;
     CAN[nbModule]->MCR.B.SRXDIS = 0;
     CAN[nbModule]->MCR.B.IRMQ = 0;
@@ -195,9 +209,9 @@ void CAN_Init(uint8_t nbModule)
         CAN[nbModule]->RXIMR[i].R = 0;
     }
 
-    //Clear internal buffers
+    //Clear internal buffers (0xA80 - 0xADF, in CAN_reserved4 after RXIMR)
     for(i=0; i<24; i++){
-        CAN[nbModule]->RXIMR[i+128].R = 0;
+        ((vuint32_t*)&CAN[nbModule]->CAN_reserved4[256])[i] = 0;
     }
 
     //Disable RX FIFO message filter (accept all)
@@ -207,12 +221,28 @@ void CAN_Init(uint8_t nbModule)
     CAN[nbModule]->MCR.B.MDIS = 0;
     CAN[nbModule]->MCR.B.HALT = 0;
 
-    CAN[nbModule]->MCR.R = 0x0000080F;   
+    CAN[nbModule]->MCR.R = 0x0020080F;        // WRNEN kept set for the warning interrupts
 
-	for(i=0; i<1000; i++){
-        if (!CAN[nbModule]->MCR.B.NOTRDY && !CAN[nbModule]->MCR.B.FRZACK && !CAN[nbModule]->MCR.B.LPMACK)
-            break;
-    }
+    (void)TIME_WAIT(TIME_WAIT_CAN_START, TIME_TIMEOUT_CAN_MODE_US,
+                    !CAN[nbModule]->MCR.B.NOTRDY && !CAN[nbModule]->MCR.B.FRZACK && !CAN[nbModule]->MCR.B.LPMACK);
+
+    //Clear error flags and error manager state
+    CAN[nbModule]->ESR1.R = CAN_ESR1_INT_FLAGS;
+    CANerror[nbModule].state = CAN_STATE_ERROR_ACTIVE;
+    CANerror[nbModule].TEC = 0;
+    CANerror[nbModule].REC = 0;
+    CANerror[nbModule].maxTEC = 0;
+    CANerror[nbModule].maxREC = 0;
+    CANerror[nbModule].errorCount = 0;
+    CANerror[nbModule].warningCount = 0;
+    CANerror[nbModule].busOffCount = 0;
+    CANerror[nbModule].lastRecoveryTime = 0;
+    CANerror[nbModule].maxRecoveryTime = 0;
+    CANerror[nbModule].lostFrames = 0;
+    CANerror[nbModule].requeuedFrames = 0;
+    CANerror[nbModule].elapsedTime = 0;
+    CANerror[nbModule].timerStamp = 0;
+    CANtxShadow[nbModule].pending = 0;
 
 } 
 
@@ -236,7 +266,9 @@ void CAN_Init(uint8_t nbModule)
 *					Local priority number is placed on the 3 most significant 
 *					bits in the same register as the IDs. 
 *	@remarks CAN module shall be initialized before (see CAN_Init function for 
-*			 details).
+*			 details). Frames of message buffers 0 - 31 are kept in the Tx 
+*			 shadow; during bus-off they are only queued and CAN_ErrorTask 
+*			 sends them after the recovery.
 *	@par Code sample
 *			CAN_Send (0,31,0xA0A0A0A0A0A0A0A0, 0x15555555);
 *			- Function sends message 0xA0A0A0A0A0A0A0A0 via CAN module 
@@ -244,6 +276,66 @@ void CAN_Init(uint8_t nbModule)
 *			Local priority:	0 / Standard ID: 0x555 / Extended ID: 0x15555
 ********************************************************************************/
 void CAN_Send(uint8_t nbModule, uint8_t nbBuffer, uint64_t message, uint32_t id) {
+	uint32_t stockPriority;
+
+	//Shadow is shared with CAN_IsrBusOff
+	stockPriority = INTC_0.CPR0.B.PRI;
+	if (stockPriority < INT_CAN_ERR_PRIORITY)
+	{
+		INTC_0.CPR0.B.PRI = INT_CAN_ERR_PRIORITY;
+	}
+
+	//Keep a copy of the frame so it can be requeued after a bus-off
+	if (nbBuffer < CAN_TX_SHADOW_NB)
+	{
+		if (CANtxShadow[nbModule].pending & (1UL << nbBuffer))
+		{
+			if (CAN[nbModule]->IFLAG1.R & (1UL << nbBuffer))
+			{
+				CAN[nbModule]->IFLAG1.R = (1UL << nbBuffer);	//previous frame transmitted, clear its flag
+			}
+			else
+			{
+				CANerror[nbModule].lostFrames++;				//previous frame overwritten before transmission
+			}
+		}
+		CANtxShadow[nbModule].frame[nbBuffer].message = message;
+		CANtxShadow[nbModule].frame[nbBuffer].id = id;
+		CANtxShadow[nbModule].pending |= (1UL << nbBuffer);
+	}
+
+	//During bus-off the frame is only queued, CAN_ErrorTask sends it after the recovery
+	if ((CANerror[nbModule].state != CAN_STATE_BUS_OFF) && (CANerror[nbModule].state != CAN_STATE_RECOVERING))
+	{
+		CAN_LoadTxBuffer(nbModule, nbBuffer, message, id);
+	}
+
+	INTC_0.CPR0.B.PRI = stockPriority;
+}
+
+/***************************************************************************//*!
+*   @brief The function CAN_LoadTxBuffer fills a message buffer and starts
+*			the transmission.
+*	@par Include 
+*					CAN.h
+* 	@par Description 
+*				This function loads ID and 8-Byte message into the specified
+*				message buffer and activates it for transmission. Unlike 
+*				CAN_Send, the frame is not stored into the Tx shadow.
+* 	@param[in] nbModule
+*					Number of the CAN module (0 or 1).
+* 	@param[in] nbBuffer
+*					Number of the CAN message buffer (from 0 till 31).
+* 	@param[in] message
+*					64-bit message to be sent through CAN bus. 
+* 	@param[in] id
+*					CAN message identifier (see CAN_Send function for details). 
+*	@remarks This function is used by the CAN_Send and CAN_ErrorTask functions.
+*	@par Code sample
+*			CAN_LoadTxBuffer(0, 31, 0xA0A0A0A0A0A0A0A0, 0x15555555);
+*			- Function activates message buffer 31 of the CAN module 0.
+********************************************************************************/
+void CAN_LoadTxBuffer(uint8_t nbModule, uint8_t nbBuffer, uint64_t message, uint32_t id) {
 
 	CAN[nbModule]->MB[nbBuffer].CS.R = 0x08680000;   //Length = 8 Bytes
 	CAN[nbModule]->MB[nbBuffer].ID.R = id;  			//Load frame IDentifier
@@ -275,6 +367,219 @@ void CAN_Stop(uint8_t nbModule, uint8_t nbBuffer) {
 
   	CAN[nbModule]->IFLAG1.R= (1 << nbBuffer);		//clear last transmission flag
 	CAN[nbModule]->MB[nbBuffer].CS.B.CODE = 0;  	// put the message buffer into INACTIVE mode, so it
+	if (nbBuffer < CAN_TX_SHADOW_NB)
+	{
+		CANtxShadow[nbModule].pending &= ~(1UL << nbBuffer);	//frame withdrawn by the application
+	}
+}
+
+/***************************************************************************//*!
+*   @brief The function CAN_UpdateErrorState refreshes the error counters
+*			and the fault confinement state of the CAN module.
+*	@par Include 
+*					CAN.h
+* 	@par Description 
+*				This function reads TEC/REC from the ECR register and the fault
+*				confinement state from ESR1, updates maximal values and the 
+*				state of the error manager. The bus-off and recovering states 
+*				are managed by CAN_IsrBusOff and CAN_ErrorTask only.
+* 	@param[in] nbModule
+*					Number of the CAN module (0 or 1).
+* 	@param[in] esr1
+*					ESR1 register value read by the caller.
+*	@remarks This function is used by the CAN interrupt routines.
+********************************************************************************/
+static void CAN_UpdateErrorState(uint8_t nbModule, uint32_t esr1) {
+	uint32_t ecr;
+
+	ecr = CAN[nbModule]->ECR.R;
+	CANerror[nbModule].TEC = (uint8_t)(ecr & 0xFF);
+	CANerror[nbModule].REC = (uint8_t)((ecr >> 8) & 0xFF);
+	if (CANerror[nbModule].TEC > CANerror[nbModule].maxTEC)
+		CANerror[nbModule].maxTEC = CANerror[nbModule].TEC;
+	if (CANerror[nbModule].REC > CANerror[nbModule].maxREC)
+		CANerror[nbModule].maxREC = CANerror[nbModule].REC;
+
+	if ((CANerror[nbModule].state == CAN_STATE_BUS_OFF) || (CANerror[nbModule].state == CAN_STATE_RECOVERING))
+		return;
+
+	switch ((esr1 & CAN_ESR1_FLTCONF_MASK) >> CAN_ESR1_FLTCONF_SHIFT)
+	{
+		case 0:	//error active
+			if (esr1 & (CAN_ESR1_TXWRN | CAN_ESR1_RXWRN))
+				CANerror[nbModule].state = CAN_STATE_ERROR_WARNING;
+			else
+				CANerror[nbModule].state = CAN_STATE_ERROR_ACTIVE;
+			break;
+		case 1:	//error passive
+			CANerror[nbModule].state = CAN_STATE_ERROR_PASSIVE;
+			break;
+		default:	//bus-off, handled by CAN_IsrBusOff
+			break;
+	}
+}
+
+/***************************************************************************//*!
+*   @brief The function CAN_IsrError is the interrupt routine for the
+*			ESR1[ERRINT] flag.
+*	@par Include 
+*					CAN.h
+* 	@par Description 
+*				This function counts protocol errors (bit, ACK, CRC, form,
+*				stuffing), updates TEC/REC and the error state of CAN module 0 
+*				and clears the error interrupt flag.
+*	@remarks Vector #520 (FlexCAN_0 ESR[ERR_INT]).
+********************************************************************************/
+void CAN_IsrError(void) {
+	uint32_t esr1;
+
+	esr1 = CAN[CAN_MODULE_0]->ESR1.R;			//reading ESR1 clears the error bits
+	CANerror[CAN_MODULE_0].errorCount++;
+	CANerror[CAN_MODULE_0].lastErrors = esr1 & CAN_ESR1_ERROR_BITS;
+	CAN_UpdateErrorState(CAN_MODULE_0, esr1);
+	CAN[CAN_MODULE_0]->ESR1.R = CAN_ESR1_ERRINT;		//w1c
+}
+
+/***************************************************************************//*!
+*   @brief The function CAN_IsrBusOff is the interrupt routine for the bus-off,
+*			Tx warning and Rx warning flags.
+*	@par Include 
+*					CAN.h
+* 	@par Description 
+*				On a warning the function updates TEC/REC and the error state.
+*				On a bus-off, automatic recovery is kept disabled (BOFFREC = 1),
+*				all Tx message buffers still waiting for transmission are 
+*				deactivated (their frames stay in the Tx shadow), the recovery
+*				time measurement and the recovery sequence are started at once
+*				(BOFFREC cleared). CAN_ErrorTask requeues the frames when the
+*				module is error active again.
+*	@remarks Vector #521 (FlexCAN_0 ESR_BOFF | Transmit_Warning | Receive_Warning).
+********************************************************************************/
+void CAN_IsrBusOff(void) {
+	uint32_t esr1;
+	uint32_t i;
+
+	esr1 = CAN[CAN_MODULE_0]->ESR1.R;
+	if (esr1 & (CAN_ESR1_TWRNINT | CAN_ESR1_RWRNINT))
+	{
+		CANerror[CAN_MODULE_0].warningCount++;
+	}
+	CAN_UpdateErrorState(CAN_MODULE_0, esr1);
+
+	if (esr1 & CAN_ESR1_BOFFINT)
+	{
+		CANerror[CAN_MODULE_0].state = CAN_STATE_BUS_OFF;
+		CANerror[CAN_MODULE_0].busOffCount++;
+		CANerror[CAN_MODULE_0].elapsedTime = 0;
+		CANerror[CAN_MODULE_0].timerStamp = (uint16_t)CAN[CAN_MODULE_0]->TIMER.R;
+
+		//Withdraw frames not transmitted yet, they are requeued after the recovery
+		for (i = 0; i < CAN_TX_SHADOW_NB; i++)
+		{
+			if (CANtxShadow[CAN_MODULE_0].pending & (1UL << i))
+			{
+				if (CAN[CAN_MODULE_0]->IFLAG1.R & (1UL << i))
+				{
+					CAN[CAN_MODULE_0]->IFLAG1.R = (1UL << i);	//frame was transmitted before bus-off
+					CANtxShadow[CAN_MODULE_0].pending &= ~(1UL << i);
+				}
+				else
+				{
+					CAN[CAN_MODULE_0]->MB[i].CS.B.CODE = 0x8;	//Tx INACTIVE
+				}
+			}
+		}
+		CAN[CAN_MODULE_0]->CTRL1.B.BOFFREC = 0;		//start recovery sequence (128 x 11 recessive bits)
+		CANerror[CAN_MODULE_0].state = CAN_STATE_RECOVERING;
+	}
+
+	CAN[CAN_MODULE_0]->ESR1.R = esr1 & (CAN_ESR1_BOFFINT | CAN_ESR1_TWRNINT | CAN_ESR1_RWRNINT);	//w1c
+}
+
+/***************************************************************************//*!
+*   @brief The function CAN_ErrorTask controls the bus-off recovery of the 
+*			CAN module.
+*	@par Include 
+*					CAN.h
+* 	@par Description 
+*				This function shall be called periodically (at least each 
+*				65535 CAN bit times). During the recovery sequence started by
+*				CAN_IsrBusOff (128 occurrences of 11 recessive bits) it 
+*				measures the elapsed time. When the module gets error active 
+*				again, the frames withdrawn from the Tx message buffers are 
+*				requeued, the automatic recovery is disabled again and the 
+*				recovery time is stored.
+* 	@param[in] nbModule
+*					Number of the CAN module (0 or 1).
+* 	@return 	Current error state of the module (CAN_STATE_xxx).
+*	@remarks Recovery time is measured in CAN bit times by the free running 
+*			 timer of the module.
+*	@par Code sample
+*			CAN_ErrorTask(0);
+*			- Function controls the bus-off recovery of the CAN module 0.
+********************************************************************************/
+uint32_t CAN_ErrorTask(uint8_t nbModule) {
+	uint16_t timer;
+	uint32_t i;
+	uint32_t stockPriority;
+
+	if (CANerror[nbModule].state != CAN_STATE_RECOVERING)
+		return CANerror[nbModule].state;
+
+	//Accumulate elapsed bit times (16-bit free running timer)
+	timer = (uint16_t)CAN[nbModule]->TIMER.R;
+	CANerror[nbModule].elapsedTime += (uint16_t)(timer - CANerror[nbModule].timerStamp);
+	CANerror[nbModule].timerStamp = timer;
+
+	if (CAN[nbModule]->ESR1.B.FLTCONF == 0)
+	{
+		//Back to error active - the CAN error ISR shall not run in between
+		stockPriority = INTC_0.CPR0.B.PRI;
+		if (stockPriority < INT_CAN_ERR_PRIORITY)
+		{
+			INTC_0.CPR0.B.PRI = INT_CAN_ERR_PRIORITY;
+		}
+
+		CAN[nbModule]->CTRL1.B.BOFFREC = 1;
+		CANerror[nbModule].state = CAN_STATE_ERROR_ACTIVE;
+		CANerror[nbModule].lastRecoveryTime = CANerror[nbModule].elapsedTime;
+		if (CANerror[nbModule].elapsedTime > CANerror[nbModule].maxRecoveryTime)
+			CANerror[nbModule].maxRecoveryTime = CANerror[nbModule].elapsedTime;
+
+		//Requeue frames withdrawn during bus-off
+		for (i = 0; i < CAN_TX_SHADOW_NB; i++)
+		{
+			if (CANtxShadow[nbModule].pending & (1UL << i))
+			{
+				CAN_LoadTxBuffer(nbModule, i, CANtxShadow[nbModule].frame[i].message, CANtxShadow[nbModule].frame[i].id);
+				CANerror[nbModule].requeuedFrames++;
+			}
+		}
+
+		INTC_0.CPR0.B.PRI = stockPriority;
+	}
+
+	return CANerror[nbModule].state;
+}
+
+/***************************************************************************//*!
+*   @brief The function CAN_GetErrorStats returns error statistics of the 
+*			CAN module.
+*	@par Include 
+*					CAN.h
+* 	@par Description 
+*				This function returns a pointer to the error manager structure
+*				containing current TEC/REC, error state, number of bus-off 
+*				events, last and maximal recovery time and number of lost and
+*				requeued frames.
+* 	@param[in] nbModule
+*					Number of the CAN module (0 or 1).
+* 	@return 	Pointer to the error structure of the module.
+*	@par Code sample
+*			if (CAN_GetErrorStats(0)->lostFrames != 0) ...
+********************************************************************************/
+const CAN_ErrorStruct *CAN_GetErrorStats(uint8_t nbModule) {
 
+	return &CANerror[nbModule];
 }
 
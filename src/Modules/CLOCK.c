@@ -0,0 +1,294 @@
+/*******************************************************************************
+*
+* Freescale Semiconductor Inc.
+* (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+* ALL RIGHTS RESERVED.
+*
+********************************************************************************
+*
+* $File Name:       CLOCK.c$
+* @file             CLOCK.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Clock tree and peripheral timing calculator source file
+* @brief            Clock tree and peripheral timing calculator source file
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/****************************************************************************//*!
+*
+*  @mainpage Clock tree and peripheral timing calculator for MPC5744P
+*
+*  @section Intro Introduction
+*
+*	This package contains the integer calculators of the serial drivers
+*	timing registers. Each calculator returns the register values, the
+*	achieved value and its error against the desired one (ppm). Settings of
+*	the application (MPC5744P_drv.h) are checked at compile time.
+*
+*  For more information about the functions and configuration items see these documents:
+*
+*******************************************************************************
+*
+* @attention
+*
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : MPC5744P
+*   Dependencies         : MPC5744P - Basic SW drivers.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Driver created
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#include "MPC5744P_drv.h"
+#include "CLOCK.h"
+
+/* Compile time checks of the configured clocks and baud rates */
+CLOCK_ASSERT(uart_baud_rate, CLOCK_ABS(CLOCK_ERROR_PPM(CLOCK_LINFLEX_BAUD(LINFLEX_CLK, LINFLEX_UART_BR), LINFLEX_UART_BR)) <= LINFLEX_UART_MAX_ERROR_PPM);
+CLOCK_ASSERT(lin_baud_rate, CLOCK_ABS(CLOCK_ERROR_PPM(CLOCK_LINFLEX_BAUD(LINFLEX_CLK, LIN_BR), LIN_BR)) <= LIN_MAX_ERROR_PPM);
+CLOCK_ASSERT(lin_divider, (CLOCK_LINFLEX_DIV16(LINFLEX_CLK, LIN_BR) >> 4) <= 0xFFFFF);
+CLOCK_ASSERT(dspi_baud_rate, (DSPI_BR <= CLOCK_DSPI_BAUD(DSPI_CLK, 2, 2)) && (DSPI_BR >= CLOCK_DSPI_BAUD(DSPI_CLK, 7, 32768)));
+CLOCK_ASSERT(can_bit_rate, (CAN_BR <= CAN_CLK / CLOCK_CAN_TQ_MIN) && (CAN_BR >= CAN_CLK / (256 * CLOCK_CAN_TQ_MAX)));
+CLOCK_ASSERT(pit_clock, (PIT_CLK % 1000000) == 0);
+
+static const uint32_t CLOCK_DspiPrescaler[4] = {2, 3, 5, 7};		///CTAR[PBR] values
+static const uint32_t CLOCK_DspiScaler[16] = {						///CTAR[BR] values
+	2, 4, 6, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384, 32768
+};
+
+/***************************************************************************//*!
+*   @brief The function CLOCK_ComputeLinflex computes the LINFlex baud rate
+*			registers.
+*	@par Include
+*					CLOCK.h
+* 	@par Description
+*					LFDIV = clk / (16 x baudRate) is rounded to 1/16, the
+*					integer part goes to LINIBRR and the fraction to LINFBRR.
+*	@param[in] clk - LINFlex clock frequency [Hz].
+*	@param[in] baudRate - Desired baud rate [Bd].
+*	@param[out] p_ibr - LINIBRR value.
+*	@param[out] p_fbr - LINFBRR value.
+*	@return 	Error of the achieved baud rate [ppm].
+*	@par Code sample
+*			CLOCK_ComputeLinflex(LINFLEX_CLK, 19200, &ibr, &fbr);
+*			- ibr = 325, fbr = 8 (100 MHz), error 52 ppm.
+********************************************************************************/
+int32_t CLOCK_ComputeLinflex(uint32_t clk, uint32_t baudRate, uint32_t *p_ibr, uint32_t *p_fbr)
+{
+	uint32_t div16 = CLOCK_LINFLEX_DIV16(clk, baudRate);
+
+	*p_ibr = div16 >> 4;
+	*p_fbr = div16 & 0xF;
+
+	return CLOCK_ERROR_PPM(clk / div16, baudRate);
+}
+
+/***************************************************************************//*!
+*   @brief The function CLOCK_ComputeDspi computes the DSPI baud rate
+*			prescaler and scaler.
+*	@par Include
+*					CLOCK.h
+* 	@par Description
+*					All PBR/BR combinations (DBR = 0) are checked and the
+*					one closest to the desired baud rate is selected.
+*	@param[in] clk - DSPI clock frequency [Hz].
+*	@param[in] baudRate - Desired baud rate [b/s].
+*	@param[out] p_pbr - CTAR[PBR] value.
+*	@param[out] p_br - CTAR[BR] value.
+*	@return 	Error of the achieved baud rate [ppm].
+*	@par Code sample
+*			CLOCK_ComputeDspi(DSPI_CLK, 1000000, &pbr, &br);
+********************************************************************************/
+int32_t CLOCK_ComputeDspi(uint32_t clk, uint32_t baudRate, uint32_t *p_pbr, uint32_t *p_br)
+{
+	uint32_t bestError = 0xFFFFFFFF;
+	uint32_t bestBaud = 0;
+	uint32_t actual, error;
+	uint32_t pbr, br;
+
+	*p_pbr = 0;
+	*p_br = 0;
+	for(pbr = 0; pbr < 4; pbr++){
+		for(br = 0; br < 16; br++){
+			actual = CLOCK_DSPI_BAUD(clk, CLOCK_DspiPrescaler[pbr], CLOCK_DspiScaler[br]);
+			error = (actual > baudRate) ? (actual - baudRate) : (baudRate - actual);
+			if(error < bestError){
+				bestError = error;
+				bestBaud = actual;
+				*p_pbr = pbr;
+				*p_br = br;
+			}
+		}
+	}
+
+	return CLOCK_ERROR_PPM(bestBaud, baudRate);
+}
+
+/***************************************************************************//*!
+*   @brief The function CLOCK_ComputeDspiDelay computes a DSPI delay
+*			prescaler and scaler (CSSCK, ASC, DT).
+*	@par Include
+*					CLOCK.h
+* 	@par Description
+*					The shortest delay prescaler x 2^(scaler + 1) clock
+*					cycles not shorter than the desired delay is selected
+*					(the longest one if the desired delay is out of range).
+*	@param[in] clk - DSPI clock frequency [Hz].
+*	@param[in] delayNs - Desired delay [ns].
+*	@param[out] p_prescaler - CTAR[PCSSCK/PASC/PDT] value.
+*	@param[out] p_scaler - CTAR[CSSCK/ASC/DT] value.
+*	@return 	Error of the achieved delay [ppm], 0 for a zero delay.
+*	@par Code sample
+*			CLOCK_ComputeDspiDelay(DSPI_CLK, 160, &pcssck, &cssck);
+*			- pcssck = 0 (1), cssck = 2 (8) at 50 MHz, 160 ns.
+********************************************************************************/
+int32_t CLOCK_ComputeDspiDelay(uint32_t clk, uint32_t delayNs, uint32_t *p_prescaler, uint32_t *p_scaler)
+{
+	uint32_t cycles = (uint32_t)(((uint64_t)clk * delayNs + 999999999u) / 1000000000u);
+	uint32_t bestCycles = 7 * 65536;
+	uint32_t actual;
+	uint32_t pre, scaler;
+
+	*p_prescaler = 3;
+	*p_scaler = 15;
+	for(pre = 0; pre < 4; pre++){
+		for(scaler = 0; scaler < 16; scaler++){
+			actual = (2 * pre + 1) << (scaler + 1);
+			if((actual >= cycles) && (actual < bestCycles)){
+				bestCycles = actual;
+				*p_prescaler = pre;
+				*p_scaler = scaler;
+			}
+		}
+	}
+	if(delayNs == 0){
+		return 0;
+	}
+
+	return CLOCK_ERROR_PPM(((uint64_t)bestCycles * 1000000000u) / clk, delayNs);
+}
+
+/***************************************************************************//*!
+*   @brief The function CLOCK_ComputeCan computes the FlexCAN bit timing.
+*	@par Include
+*					CLOCK.h
+* 	@par Description
+*					The number of time quanta per bit (8 - 25) and the
+*					prescaler giving the bit rate closest to the desired one
+*					are selected, the highest number of time quanta wins on
+*					equal errors. The bit is then split around the desired
+*					sample point (PSEG2 2 - 8 tq, PROPSEG and PSEG1 1 - 8 tq,
+*					RJW up to 4 tq).
+*	@param[in] clk - FlexCAN protocol engine clock frequency [Hz].
+*	@param[in] bitRate - Desired bit rate [b/s].
+*	@param[in] samplePoint - Desired sample point [per mille].
+*	@param[out] p_timing - Register values and achieved timing.
+*	@return 	Error of the achieved bit rate [ppm].
+*	@par Code sample
+*			CLOCK_ComputeCan(CAN_CLK, 500000, 800, &timing);
+********************************************************************************/
+int32_t CLOCK_ComputeCan(uint32_t clk, uint32_t bitRate, uint32_t samplePoint, CLOCK_CanTiming *p_timing)
+{
+	uint32_t bestError = 0xFFFFFFFF;
+	uint32_t bestTq = CLOCK_CAN_TQ_MAX;
+	uint32_t bestPrescaler = 256;
+	uint32_t tq, prescaler, actual, error;
+	uint32_t sample, pseg1, pseg2, propseg, rest;
+
+	for(tq = CLOCK_CAN_TQ_MAX; tq >= CLOCK_CAN_TQ_MIN; tq--){
+		prescaler = (clk + (bitRate * tq) / 2) / (bitRate * tq);
+		if(prescaler < 1){
+			prescaler = 1;
+		}
+		if(prescaler > 256){
+			prescaler = 256;
+		}
+		actual = CLOCK_CAN_BITRATE(clk, prescaler, tq);
+		error = (actual > bitRate) ? (actual - bitRate) : (bitRate - actual);
+		if(error < bestError){
+			bestError = error;
+			bestTq = tq;
+			bestPrescaler = prescaler;
+		}
+	}
+
+	sample = (bestTq * samplePoint + 500) / 1000;		//sync + propagation + phase 1 segments
+	pseg2 = bestTq - sample;
+	if(pseg2 < 2){
+		pseg2 = 2;
+	}
+	if(pseg2 > 8){
+		pseg2 = 8;
+	}
+	rest = bestTq - 1 - pseg2;							//propagation + phase 1 segments
+	if(rest > 16){
+		rest = 16;
+		pseg2 = bestTq - 1 - rest;
+	}
+	pseg1 = rest / 2;
+	if(pseg1 > 8){
+		pseg1 = 8;
+	}
+	propseg = rest - pseg1;
+	if(propseg > 8){
+		propseg = 8;
+		pseg1 = rest - 8;
+	}
+
+	p_timing->presdiv = bestPrescaler - 1;
+	p_timing->propseg = propseg - 1;
+	p_timing->pseg1 = pseg1 - 1;
+	p_timing->pseg2 = pseg2 - 1;
+	p_timing->rjw = ((pseg1 < 4) ? pseg1 : 4) - 1;
+	p_timing->bitRate = CLOCK_CAN_BITRATE(clk, bestPrescaler, bestTq);
+	p_timing->samplePoint = ((bestTq - pseg2) * 1000) / bestTq;
+
+	return CLOCK_ERROR_PPM(p_timing->bitRate, bitRate);
+}
+
+/***************************************************************************//*!
+*   @brief The function CLOCK_ComputeAdcSampling computes the ADC sampling
+*			phase register.
+*	@par Include
+*					CLOCK.h
+* 	@par Description
+*					INPSAMP = samplingNs x clk + 1, limited to 8 - 255.
+*	@param[in] clk - ADC conversion clock frequency [Hz].
+*	@param[in] samplingNs - Desired sampling time [ns].
+*	@param[out] p_inpsamp - CTR0[INPSAMP] value.
+*	@return 	Error of the achieved sampling time [ppm].
+*	@par Code sample
+*			CLOCK_ComputeAdcSampling(ADC_CLK, 600, &inpsamp);
+********************************************************************************/
+int32_t CLOCK_ComputeAdcSampling(uint32_t clk, uint32_t samplingNs, uint32_t *p_inpsamp)
+{
+	uint32_t inpsamp = CLOCK_ADC_INPSAMP(clk, samplingNs);
+
+	if(inpsamp < CLOCK_ADC_INPSAMP_MIN){
+		inpsamp = CLOCK_ADC_INPSAMP_MIN;
+	}
+	if(inpsamp > CLOCK_ADC_INPSAMP_MAX){
+		inpsamp = CLOCK_ADC_INPSAMP_MAX;
+	}
+	*p_inpsamp = inpsamp;
+	if(samplingNs == 0){
+		return 0;
+	}
+
+	return CLOCK_ERROR_PPM(((uint64_t)(inpsamp - 1) * 1000000000u) / clk, samplingNs);
+}
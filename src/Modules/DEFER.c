@@ -0,0 +1,220 @@
+/*******************************************************************************
+*
+* Freescale Semiconductor Inc.
+* (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+* ALL RIGHTS RESERVED.
+*
+********************************************************************************
+*
+* $File Name:       DEFER.c$
+* @file             DEFER.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Deferred interrupt work source file
+* @brief            Deferred interrupt work source file
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/****************************************************************************//*!
+*
+*  @mainpage Deferred interrupt work for MPC5744P
+*
+*  @section Intro Introduction
+*
+*	This package contains the work queues of the interrupt routines and the
+*	software interrupt running them. A queue is a ring of items with a
+*	sequence number each: a producer claims the tail by a compare and swap
+*	(a preempting producer makes the swap fail, the claim is repeated), fills
+*	the item and publishes it by its sequence number. The only consumer is
+*	DEFER_IsrSoftware, which cannot preempt itself.
+*
+*  The key features of this package are the following:
+*  - No interrupt masking, posting costs a few instructions
+*  - Full queue reported to the producer and counted, never blocking
+*  - Host build (DEFER_HOST) for the test Host/DEFER
+*
+*  For more information about the functions and configuration items see these documents:
+*
+*******************************************************************************
+*
+* @attention
+*
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : MPC5744P
+*   Dependencies         : MPC5744P - Basic SW drivers.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   DEFER_Post	  Queues in the local data RAM (DRAM_BSS)
+BRNY001					      19/10/2026 	   ALL		  Host build (DEFER_HOST) completed, tested by Host/DEFER
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#ifdef DEFER_HOST
+#include "typedefs.h"
+#define DRAM_BSS
+#else
+#include "MPC5744P_drv.h"
+#endif
+#include "DEFER.h"
+
+#ifdef DEFER_HOST
+//supplied by the host tool
+void DEFER_PortRaise(void);
+void DEFER_PortClear(void);
+#else
+#define DEFER_PortRaise()	(INTC_0.SSCIR[DEFER_SW_IRQ].R = DEFER_SSCIR_SET)
+#define DEFER_PortClear()	(INTC_0.SSCIR[DEFER_SW_IRQ].R = DEFER_SSCIR_CLR)
+#endif
+
+DRAM_BSS DEFER_Queue DEFERqueue[DEFER_LEVELS];
+
+/***************************************************************************//*!
+*   @brief The function DEFER_Init clears the work queues.
+*	@par Include
+*					DEFER.h
+*	@remarks 	Shall be called before the interrupts are enabled (xcptn_xmpl).
+*	@par Code sample
+*			DEFER_Init();
+********************************************************************************/
+void DEFER_Init(void)
+{
+	uint32_t level;
+	uint32_t i;
+
+	for (level = 0; level < DEFER_LEVELS; level++)
+	{
+		for (i = 0; i < DEFER_QUEUE_SIZE; i++)
+		{
+			DEFERqueue[level].item[i].sequence = i;
+		}
+		DEFERqueue[level].tail = 0;
+		DEFERqueue[level].head = 0;
+		DEFERqueue[level].dropped = 0;
+	}
+	DEFER_PortClear();
+}
+
+/***************************************************************************//*!
+*   @brief The function DEFER_Post posts a work item.
+*	@par Include
+*					DEFER.h
+* 	@par Description
+*					The tail of the queue is claimed, the item is filled and
+*					published, then the software interrupt is raised. The
+*					handler is called later with the argument, at
+*					INT_DEFER_PRIORITY.
+*	@param[in] level - DEFER_HIGH, DEFER_NORMAL or DEFER_LOW.
+*	@param[in] handler - Function running the work.
+*	@param[in] arg - Data captured by the caller.
+*	@return DEFER_OK / DEFER_FULL (item dropped).
+*	@remarks 	Callable from any interrupt and from the main loop.
+*	@par Code sample
+*			DEFER_Post(DEFER_LOW, FS65_DeferADC, raw);
+********************************************************************************/
+uint32_t DEFER_Post(uint32_t level, DEFER_Handler handler, uint32_t arg)
+{
+	DEFER_Queue *p_queue = &DEFERqueue[level];
+	DEFER_Item *p_item;
+	uint32_t position;
+	int32_t difference;
+
+	for (;;)
+	{
+		position = p_queue->tail;
+		p_item = &p_queue->item[position & (DEFER_QUEUE_SIZE - 1)];
+		difference = (int32_t)(p_item->sequence - position);
+		if (difference < 0)
+		{
+			(void)__sync_fetch_and_add(&p_queue->dropped, 1);	//item not run yet
+			return DEFER_FULL;
+		}
+		if ((difference == 0) && __sync_bool_compare_and_swap(&p_queue->tail, position, position + 1))
+		{
+			break;
+		}
+		//claimed by a preempting producer, try the next one
+	}
+
+	p_item->handler = handler;
+	p_item->arg = arg;
+	p_item->sequence = position + 1;
+	DEFER_PortRaise();
+	return DEFER_OK;
+}
+
+/***************************************************************************//*!
+*   @brief The function DEFER_RunPending runs the posted work items.
+*	@par Include
+*					DEFER.h
+* 	@par Description
+*					The first published item of the most urgent non-empty queue
+*					is released and run, until all queues are empty. An item
+*					posted by a handler or a preempting interrupt is run in the
+*					same call.
+*	@return Number of items run.
+*	@remarks 	Single consumer: called by DEFER_IsrSoftware only (or with the
+*				software interrupt unused).
+********************************************************************************/
+uint32_t DEFER_RunPending(void)
+{
+	DEFER_Queue *p_queue;
+	DEFER_Item *p_item;
+	DEFER_Handler handler;
+	uint32_t arg;
+	uint32_t position;
+	uint32_t level = 0;
+	uint32_t run = 0;
+
+	while (level < DEFER_LEVELS)
+	{
+		p_queue = &DEFERqueue[level];
+		position = p_queue->head;
+		p_item = &p_queue->item[position & (DEFER_QUEUE_SIZE - 1)];
+		if (p_item->sequence != position + 1)
+		{
+			level++;					//empty, or the producer is preempted before publishing
+			continue;
+		}
+		handler = p_item->handler;
+		arg = p_item->arg;
+		p_item->sequence = position + DEFER_QUEUE_SIZE;		//release the item before the handler
+		p_queue->head = position + 1;
+		handler(arg);
+		run++;
+		level = 0;
+	}
+	return run;
+}
+
+/***************************************************************************//*!
+*   @brief The function DEFER_IsrSoftware is the software interrupt running the
+*			work items.
+*	@par Include
+*					DEFER.h
+* 	@par Description
+*					The flag is cleared first, so an item posted during the
+*					run raises the interrupt again.
+*	@remarks 	Registered for the vector DEFER_SW_IRQ with the priority
+*				INT_DEFER_PRIORITY. The handlers run through the IVOR4
+*				prologue like any interrupt routine (no SPE accumulator save).
+********************************************************************************/
+void DEFER_IsrSoftware(void)
+{
+	DEFER_PortClear();
+	(void)DEFER_RunPending();
+}
@@ -53,6 +53,11 @@ Revision History:
                              Modification     Function
 Author (core ID)              Date D/M/Y       Name		  Description of Changes
 B35993		 				  28/07/2014 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   DSPI_SendBatch	  Pipelined transfer through the Tx/Rx FIFOs
+BRNY001					      19/10/2026 	   DSPI_Init	  Integer baud rate and delays (CLOCK module), DSPI_RoundBaudRate removed
+BRNY001					      19/10/2026 	   DSPI_Send	  Time-bounded waits (TIME_WAIT) instead of DSPI_SECURE_COUNTER
+BRNY001					      19/10/2026 	   DSPI_Read	  Frames recorded in the SPI trace (SPITRACE)
+BRNY001					      19/10/2026 	   DSPI_Read	  Last sent words in the local data RAM (DRAM_BSS)
 
 ---------------------------   ----------    ------------  ------------------------------------------
 ==================================================================================================*/
@@ -62,10 +67,14 @@ B35993		 				  28/07/2014 	   ALL		  Driver created
 #include "MPC5744P.h"
 #include "SIUL.h"
 #include "DSPI.h"
-#include "math.h"
+#include "CLOCK.h"
+#include "TIME.h"
+#include "SPITRACE.h"
 //#include "IntcInterrupts.h"
 
-#define DSPI_SECURE_COUNTER 50000
+#if SPITRACE_ENABLE
+static DRAM_BSS uint16_t DSPIlastTx[4];					///last word sent by DSPI_Send, recorded by DSPI_Read
+#endif
 
 /***************************************************************************//*!
 *   @brief The function DSPI_Init computes register contents and initializes the DSPIx.
@@ -106,8 +115,10 @@ B35993		 				  28/07/2014 	   ALL		  Driver created
 *						- TFFFRE - Transmit FIFO Fill Request Enable flag mask
 *						- RFOFRE - Receive FIFO Overflow Request Enable flag mask
 *						- RFDFRE - Receive FIFO Drain Request Enable flag mask
-*	@remarks 	System clock frequency should be added in multiples of the basic units 
-*				(e.g. in kHz, MHz), with respect to the units of a baud rate.
+*	@remarks 	System clock frequency shall be given in Hz. PBR/BR pair closest to 
+*				the desired baud rate is computed in integer arithmetic (see 
+*				CLOCK_ComputeDspi), delays tcsc, tasc and tdt are given by 
+*				DSPI_CSSCK_NS, DSPI_ASC_NS and DSPI_DT_NS.
 *	@par Code sample1
 *			DSPI_Init(0, MASTER, 16000000, 4000000, TCFRE);
 *			- Command initializes DSPI no. 0 in Master mode with desired baud rate     
@@ -115,7 +126,7 @@ B35993		 				  28/07/2014 	   ALL		  Driver created
 *			activated interruption when transmission is completed. System clock 
 *			frequency is 16 MHz.
 *	@par Code sample2
-*			DSPI_Init(2, SLAVE, 16, 4, TCFRE | EOQFRE);
+*			DSPI_Init(2, SLAVE, 16000000, 4000000, TCFRE | EOQFRE);
 *			- Command initializes DSPI no. 2 in Slave mode with desired baud rate         
 *			4 Mb/s and activated interruption when transmission is completed and 
 *			when request is finished.
@@ -124,121 +135,13 @@ void DSPI_Init(uint8_t DspiNumber,uint8_t mode, uint32_t sysClk, uint32_t baudRa
 {
     volatile struct SPI_tag *p_DSPI;			//base pointer 
 
-    uint32_t p1 = sysClk/baudRate;				//basic parameter
-    uint32_t realBR;
-    uint32_t realBR1;
-    uint32_t realBR2;
-    uint32_t realBR3;
-    uint32_t realBR4;
-
-    int16_t errorBR = 32767;							//undesirable value of error
-    int16_t errorBR1;
-    int16_t errorBR2;
-    int16_t errorBR3;
-    int16_t errorBR4;
-
-    uint8_t binaryPBR; 
-    uint8_t binaryBR;
+    uint32_t binaryPBR = 0;
+    uint32_t binaryBR = 0;
+    uint32_t presc, scaler;
 
     if(mode == MASTER)
-    {						
-        //prescaler PBR = 00
-        if(p1>=RATIO_MIN1 && p1<=RATIO_MAX1)
-        {						
-            realBR1 = p1*(1/PBR_VALUE1);
-            realBR1 = DSPI_RoundBaudRate(realBR1);
-            errorBR1 = baudRate - (sysClk/(PBR_VALUE1*realBR1));
-            errorBR1 = (int16_t)fabs(errorBR1);
-            if(errorBR1<errorBR)
-            {
-                errorBR = errorBR1;
-                realBR = realBR1;	
-                binaryPBR = PBR1;		
-            }
-        }		
-
-        //prescaler PBR = 01
-        if(p1>=RATIO_MIN2 && p1<=RATIO_MAX2)
-        {
-            realBR2 = p1*(1/PBR_VALUE2);	
-            realBR2 = DSPI_RoundBaudRate(realBR2);
-            errorBR2 = baudRate - (sysClk/(PBR_VALUE2*realBR2));
-            errorBR2 = (int16_t)fabs(errorBR2);
-            if(errorBR2<errorBR)
-            {
-                errorBR = errorBR2;
-                realBR = realBR2;	
-                binaryPBR = PBR2;		
-            }
-        }
-
-        //prescaler PBR = 10
-        if(p1>=RATIO_MIN3 && p1<=RATIO_MAX3)
-        {
-            realBR3 = p1*(1/PBR_VALUE3);
-            realBR3 = DSPI_RoundBaudRate(realBR3);
-            errorBR3 = baudRate - (sysClk/(PBR_VALUE3*realBR3));
-            errorBR3 = (int16_t)fabs(errorBR3);
-            if(errorBR3<errorBR)
-            {
-                errorBR = errorBR3;
-                realBR = realBR3;
-                binaryPBR = PBR3;			
-            }
-        }
-
-        //prescaler PBR = 11
-        if(p1>=RATIO_MIN4 && p1<=RATIO_MAX4)
-        {
-            realBR4 = p1*(1/PBR_VALUE4);
-            realBR4 = DSPI_RoundBaudRate(realBR4);
-            errorBR4 = baudRate - (sysClk/(PBR_VALUE4*realBR4));
-            errorBR4 = (int16_t)fabs(errorBR4);
-            if(errorBR4<errorBR)
-            {
-                errorBR = errorBR4;
-                realBR = realBR4;	
-                binaryPBR = PBR4;		
-            }
-        }
-
-        //choose the BR value
-        if(p1<RATIO_MIN1 || p1>RATIO_MAX4)
-        {
-        //out of bounds
-            if(p1<RATIO_MIN1)
-            {							
-                binaryBR = BR1;										//lower than minimum
-                binaryPBR = PBR1;
-            }
-            else
-            {
-                binaryBR = BR16;									//greater than maximum
-                binaryPBR = PBR4;
-            }
-        }
-        else
-        {																	//in the bounds			
-            switch(realBR)
-            {          
-                case BR_VALUE1	: binaryBR = BR1;	break;
-                case BR_VALUE2  : binaryBR = BR2;	break;
-                case BR_VALUE3  : binaryBR = BR3;	break;	
-                case BR_VALUE4  : binaryBR = BR4;	break;
-                case BR_VALUE5  : binaryBR = BR5;	break;
-                case BR_VALUE6  : binaryBR = BR6;	break;
-                case BR_VALUE7  : binaryBR = BR7;	break;
-                case BR_VALUE8  : binaryBR = BR8;	break;
-                case BR_VALUE9  : binaryBR = BR9;	break;
-                case BR_VALUE10	: binaryBR = BR10;	break;
-                case BR_VALUE11	: binaryBR = BR11;	break;
-                case BR_VALUE12	: binaryBR = BR12;	break;
-                case BR_VALUE13	: binaryBR = BR13;	break;
-                case BR_VALUE14	: binaryBR = BR14;	break;
-                case BR_VALUE15	: binaryBR = BR15;	break;
-                case BR_VALUE16	: binaryBR = BR16;	break;
-            }		
-        }
+    {
+        (void)CLOCK_ComputeDspi(sysClk, baudRate, &binaryPBR, &binaryBR);		//closest PBR/BR pair
     }
 
     //DSPI setting
@@ -366,14 +269,17 @@ void DSPI_Init(uint8_t DspiNumber,uint8_t mode, uint32_t sysClk, uint32_t baudRa
         p_DSPI->MODE.CTAR[0].B.BR=binaryBR;
     }
 
-    p_DSPI->MODE.CTAR[0].B.PCSSCK = PRESC_VAL1;		//tcsc
-    p_DSPI->MODE.CTAR[0].B.CSSCK = SCALER3;
+    (void)CLOCK_ComputeDspiDelay(sysClk, DSPI_CSSCK_NS, &presc, &scaler);
+    p_DSPI->MODE.CTAR[0].B.PCSSCK = presc;			//tcsc
+    p_DSPI->MODE.CTAR[0].B.CSSCK = scaler;
 
-    p_DSPI->MODE.CTAR[0].B.PDT = PRESC_VAL3;			//tdt
-    p_DSPI->MODE.CTAR[0].B.DT = SCALER4;
+    (void)CLOCK_ComputeDspiDelay(sysClk, DSPI_DT_NS, &presc, &scaler);
+    p_DSPI->MODE.CTAR[0].B.PDT = presc;				//tdt
+    p_DSPI->MODE.CTAR[0].B.DT = scaler;
 
-    p_DSPI->MODE.CTAR[0].B.PASC = PRESC_VAL1;			//tasc
-    p_DSPI->MODE.CTAR[0].B.ASC = SCALER3;					
+    (void)CLOCK_ComputeDspiDelay(sysClk, DSPI_ASC_NS, &presc, &scaler);
+    p_DSPI->MODE.CTAR[0].B.PASC = presc;			//tasc
+    p_DSPI->MODE.CTAR[0].B.ASC = scaler;
 }
 
 /***************************************************************************//*!
@@ -410,7 +316,6 @@ void DSPI_Init(uint8_t DspiNumber,uint8_t mode, uint32_t sysClk, uint32_t baudRa
 ********************************************************************************/
 void DSPI_Send(uint8_t DspiNumber,uint8_t CSmask,uint16_t Word)
 {
-    uint32_t secure_counter = 0;
     uint32_t toSend = 0;
     uint32_t wordToSend = 0;
     
@@ -434,10 +339,11 @@ void DSPI_Send(uint8_t DspiNumber,uint8_t CSmask,uint16_t Word)
 //add CS in function parameter
 	    //p_DSPI->PUSHR.PUSHR.R=((CSmask)<<16)|Word;
     p_DSPI->PUSHR.PUSHR.R = toSend;
+#if SPITRACE_ENABLE
+    DSPIlastTx[DspiNumber & 3] = Word;
+#endif
     if(p_DSPI->MCR.B.MSTR==MASTER){
-	    	while((p_DSPI->SR.B.TCF!=1) && (secure_counter < DSPI_SECURE_COUNTER)){
-			secure_counter++;
-		}; 			// Wait end of transfert if MASTER
+	    	(void)TIME_WAIT(TIME_WAIT_DSPI_TCF, TIME_TIMEOUT_DSPI_US, p_DSPI->SR.B.TCF == 1);	// Wait end of transfert if MASTER
 	    	p_DSPI->SR.B.TCF=1;									// Clear Transfert Flag	
 	    }    
 }
@@ -452,16 +358,17 @@ void DSPI_Send(uint8_t DspiNumber,uint8_t CSmask,uint16_t Word)
 * 	@param[in] DspiNumber
 *					Number of DSPI module (0 or 1 or 2).
 *	@return 32-bit received data.
-*	@remarks 	This function waits in a loop until data arrives (indicated by the RFDF flag). The DSPI 
-*				module must be previously initialized (see DSPI_Init function for details).
+*	@remarks 	This function waits in a loop until data arrives (indicated by the RFDF flag), at most 
+*				TIME_TIMEOUT_DSPI_US. The DSPI module must be previously initialized (see DSPI_Init 
+*				function for details).
 *	@par Code sample
 *			DSPI_Read(2);
 *			- Command reads and returns incoming data from DSPI2, when they are ready.
 ********************************************************************************/
 uint32_t DSPI_Read(uint8_t DspiNumber){
 		volatile struct SPI_tag *p_DSPI;				//base pointer
-    uint32_t secure_counter = 0; 
 		uint32_t recData = 0;
+		uint32_t status;
 		//pointer setting
 		switch(DspiNumber){											//choose base DSPI address
 			case 0 : p_DSPI = &SPI_0; break;
@@ -471,54 +378,18 @@ uint32_t DSPI_Read(uint8_t DspiNumber){
 			default: p_DSPI = &SPI_0; break;
 		}
 
-		while((p_DSPI->SR.B.RFDF != 1) && (secure_counter < DSPI_SECURE_COUNTER)){
-		    secure_counter++;
-		};	//wait for RX data
+		status = TIME_WAIT(TIME_WAIT_DSPI_RFDF, TIME_TIMEOUT_DSPI_US, p_DSPI->SR.B.RFDF == 1);	//wait for RX data
 		recData = p_DSPI->POPR.R;					//get received data
 		p_DSPI->SR.B.RFDF = 1;						//clear receive flag
 		p_DSPI->SR.B.TCF = 1;							//clear transfer complete flag
+#if SPITRACE_ENABLE
+		SPITRACE_Add(DspiNumber, DSPIlastTx[DspiNumber & 3], recData, (status == TIME_WAIT_OK) ? 0 : SPITRACE_FLAG_NO_ANSWER);
+#else
+		(void)status;
+#endif
 		return recData;
 }
 
-/***************************************************************************//*!
-*   @brief The function DSPI_RoundBaudRate is used by the DSPIx Init during 
-*			the baud rate setting.
-*	@par Include 
-*					DSPI.h
-* 	@par Description 
-*					This function rounds baud rate.
-* 	@param[in] pureBR
-*					Baud rate to be rounded.
-*	@return Rounded baud rate.
-*	@remarks 	This function is used during DSPI initialization (DSPI_Init) 
-*				to compute register setting for the desired baud rate.
-*	@par Code sample
-*			roundedBR= DSPI_RoundBaudRate(pureBR);
-*			- Command rounds baud rate that is given through the variable pureBR and returns 
-*			the new value through the roundedBR variable.
-********************************************************************************/
-uint32_t DSPI_RoundBaudRate(uint32_t pureBR){					//IN - computed baud rate  OUT - baud rate from a list
-    uint32_t BR = 0;
-	if(pureBR>=2 			&& pureBR<3) 			BR = 2;
-	if(pureBR>=3 			&& pureBR<5) 			BR = 4;
-	if(pureBR>=5 			&& pureBR<7) 			BR = 6;
-	if(pureBR>=7 			&& pureBR<12) 		BR = 8;
-	if(pureBR>=12 		&& pureBR<24)			BR = 16;
-	if(pureBR>=24 		&& pureBR<48) 		BR = 32;
-	if(pureBR>=48 		&& pureBR<96) 		BR = 64;
-	if(pureBR>=96 		&& pureBR<192) 		BR = 128;
-	if(pureBR>=192 		&& pureBR<384) 		BR = 256;
-	if(pureBR>=384 		&& pureBR<768) 		BR = 512;
-	if(pureBR>=768 		&& pureBR<1536) 	BR = 1024;
-	if(pureBR>=1536 	&& pureBR<3072) 	BR = 2048;
-	if(pureBR>=3072 	&& pureBR<6144) 	BR = 4096;
-	if(pureBR>=6144	 	&& pureBR<12288) 	BR = 8192;
-	if(pureBR>=12288 	&& pureBR<24576) 	BR = 16384;
-	if(pureBR>=24576 	&& pureBR<32768) 	BR = 32768;
-
-	return BR;
-}
-
 /***************************************************************************//*!
 *   @brief The function DSPI_Enable enables transfers in the DSPIx module.
 *	@par Include 
@@ -911,7 +782,7 @@ void DSPI_SendWithInt(uint8_t DspiNumber,uint8_t CSmask,uint16_t Word)
 *					Number of DSPI module (0 or 1 or 2).
 *	@return 32-bit received data.
 *	@remarks 	Function waits at first for the data (RFDF flag), so the function will be waiting in a loop 
-*				until the data will arrive. DSPI module must be previously initialized (see DSPI_Init function 
+*				until the data will arrive (at most TIME_TIMEOUT_DSPI_US). DSPI module must be previously initialized (see DSPI_Init function 
 *				for details).
 *	@par Code sample
 *			DSPI_ReadWithInt(2);
@@ -929,7 +800,7 @@ uint32_t DSPI_ReadWithInt(uint8_t DspiNumber){
 			default: p_DSPI = &SPI_0; break;
 		}
 
-		while(p_DSPI->SR.B.RFDF != 1){};	//wait for RX data
+		(void)TIME_WAIT(TIME_WAIT_DSPI_RFDF, TIME_TIMEOUT_DSPI_US, p_DSPI->SR.B.RFDF == 1);	//wait for RX data
 		recData = p_DSPI->POPR.R;					//get received data
 		p_DSPI->SR.B.TCF = 1;							//clear transfer complete flag
 		return recData;
@@ -963,3 +834,103 @@ void DSPI_ClearRFDF(uint8_t DspiNumber){
 	p_DSPI->SR.B.RFDF = 1;						//clear receive flag
 }
 
+/***************************************************************************//*!
+*   @brief The function DSPI_SendBatch sends a sequence of 16-bit words through
+*			the DSPIx using the Tx and Rx FIFOs.
+*	@par Include 
+*					DSPI.h
+* 	@par Description 
+*					This function enables the FIFOs for the duration of the
+*					transfer and keeps up to DSPI_FIFO_DEPTH frames in flight, so
+*					consecutive frames follow each other separated only by the
+*					delay after transfer (tdt) instead of a full software round
+*					trip per word. Chip select is released between frames. Each
+*					received word is stored at the index of the word that was
+*					sent in the same frame.
+* 	@param[in] DspiNumber
+*					Number of DSPI module (0 or 1 or 2).
+*	@param[in] CSmask
+*					Chip Select mask (see DSPI_Send function for details).
+*	@param[in] p_tx
+*					Words to be sent.
+*	@param[out] p_rx
+*					Received words (nbWords items).
+*	@param[in] nbWords
+*					Number of words.
+*	@return Number of received words (less than nbWords if no word is received
+*			within TIME_TIMEOUT_DSPI_US).
+*	@remarks 	Master mode only. The FIFOs are disabled again before return
+*				so the single-word functions (DSPI_Send, DSPI_Read) keep their
+*				behavior. Caller shall own the DSPI resource (priority ceiling).
+*	@par Code sample
+*			DSPI_SendBatch(0, 0x01, words, answers, 46);
+*			- Command sends 46 words on DSPI0 / PCS0 and stores 46 answers.
+********************************************************************************/
+uint32_t DSPI_SendBatch(uint8_t DspiNumber, uint8_t CSmask, const uint16_t* p_tx, uint16_t* p_rx, uint32_t nbWords)
+{
+	volatile struct SPI_tag *p_DSPI;				//base pointer
+	uint32_t gapStart;							//time of the last received word
+	uint32_t gapTicks = 0;
+	uint32_t maxGapTicks = 0;
+	uint32_t sent = 0;
+	uint32_t received = 0;
+	uint32_t command;
+#if SPITRACE_ENABLE
+	uint32_t i;
+#endif
+
+	switch(DspiNumber){											//choose base DSPI address
+		case 0 : p_DSPI = &SPI_0; break;
+		case 1 : p_DSPI = &SPI_1; break;
+		case 2 : p_DSPI = &SPI_2; break;
+		case 3 : p_DSPI = &SPI_3; break;
+		default: p_DSPI = &SPI_0; break;
+	}
+	command = ((uint32_t)CSmask << 16) & 0x00FF0000;
+
+	p_DSPI->MCR.B.HALT = 1;						//FIFO configuration only when stopped
+	p_DSPI->MCR.B.DIS_TXF = 0;
+	p_DSPI->MCR.B.DIS_RXF = 0;
+	p_DSPI->MCR.B.CLR_TXF = 1;
+	p_DSPI->MCR.B.CLR_RXF = 1;
+	p_DSPI->SR.R = DSPI_SR_FLAGS;				//clear stale flags
+	p_DSPI->MCR.B.HALT = 0;
+
+	gapStart = TIME_ReadLow();
+	while((received < nbWords) && (gapTicks < (uint32_t)TIME_US_TO_TICKS(TIME_TIMEOUT_DSPI_US))){
+		if((sent < nbWords) && ((sent - received) < DSPI_FIFO_DEPTH)){
+			p_DSPI->PUSHR.PUSHR.R = command | p_tx[sent];
+			sent++;
+		}
+		gapTicks = TIME_ReadLow() - gapStart;
+		if(p_DSPI->SR.B.RXCTR != 0){
+			p_rx[received] = (uint16_t)p_DSPI->POPR.R;
+			received++;
+			if(gapTicks > maxGapTicks){
+				maxGapTicks = gapTicks;
+			}
+			gapStart += gapTicks;
+			gapTicks = 0;
+		}
+	}
+	if(gapTicks > maxGapTicks){
+		maxGapTicks = gapTicks;
+	}
+	(void)TIME_WaitDone(TIME_WAIT_DSPI_BATCH, maxGapTicks, (received == nbWords) ? 1 : 0);
+
+	p_DSPI->MCR.B.HALT = 1;						//back to the single word mode
+	p_DSPI->MCR.B.CLR_TXF = 1;
+	p_DSPI->MCR.B.CLR_RXF = 1;
+	p_DSPI->MCR.B.DIS_TXF = 1;
+	p_DSPI->MCR.B.DIS_RXF = 1;
+	p_DSPI->SR.R = DSPI_SR_FLAGS;
+	p_DSPI->MCR.B.HALT = 0;
+
+#if SPITRACE_ENABLE
+	for(i = 0; i < nbWords; i++){				//after the transfer, the FIFO refill is not delayed
+		SPITRACE_Add(DspiNumber, p_tx[i], (i < received) ? p_rx[i] : 0,
+				(i < received) ? SPITRACE_FLAG_BATCH : (SPITRACE_FLAG_BATCH | SPITRACE_FLAG_NO_ANSWER));
+	}
+#endif
+	return received;
+}
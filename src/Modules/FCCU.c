@@ -52,6 +52,8 @@ Revision History:
                              Modification     Function
 Author (core ID)              Date D/M/Y       Name		  Description of Changes
 B35993		 				  25/07/2014 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   FCCU_SetProtocol	  Time-bounded OPS waits (TIME_WAIT)
+BRNY001					      19/10/2026 	   FCCU_SetProtocol	  Timed out operation returned as FCCU_RETURN_ERROR
 
 ---------------------------   ----------    ------------  ------------------------------------------
 ==================================================================================================*/
@@ -59,6 +61,7 @@ B35993		 				  25/07/2014 	   ALL		  Driver created
 #include "MPC5744P_drv.h"
 #include "ME.h" 
 #include "FCCU.h"
+#include "TIME.h"
 
 /***************************************************************************//*!
 *   @brief The function FCCU_SetProtocol sets protocol for the FCCU's safety output pins.
@@ -79,17 +82,27 @@ B35993		 				  25/07/2014 	   ALL		  Driver created
 *	@remarks 	Execution of this function should not be interrupt by any event 
 *				(e.g. break point). Function must be executed in the real time 
 *				in one sequence, otherwise time delays for using access keys will 
-*				be applied and protocol will not be changed.
+*				be applied and protocol will not be changed. A timed out
+*				operation is counted in TIMEwait[TIME_WAIT_FCCU_OPS]. If the
+*				configuration state is not entered nothing is written; if
+*				the normal state is not entered back, the FCCU leaves the
+*				configuration state at its configuration timeout with a
+*				fault. The caller shall go to a safe state on
+*				FCCU_RETURN_ERROR (fault signalling not configured).
+*	@return		FCCU_RETURN_OK - protocol set, FCCU_RETURN_ERROR - an
+*				operation timed out.
 *	@par Code sample
 *			FCCU_SetProtocol(FCCU_BI_STABLE);
 *			- Command sets bistable protocol for the FCCU_Fx pins.
 ********************************************************************************/
-void FCCU_SetProtocol(uint32_t protocol){
+uint32_t FCCU_SetProtocol(uint32_t protocol){
     // Enter FCCU Configuration Mode
     FCCU.TRANS_LOCK.R = 0xBC;    
     FCCU.CTRLK.R = FCCU_CTRLK_OP1;
     FCCU.CTRL.R = FCCU_OPR_SET_CONFIG;
-    while(FCCU.CTRL.B.OPS != FCCU_OPS_SUCCESS);
+    if (TIME_WAIT(TIME_WAIT_FCCU_OPS, TIME_TIMEOUT_FCCU_OPS_US, FCCU.CTRL.B.OPS == FCCU_OPS_SUCCESS) != TIME_WAIT_OK){
+	return FCCU_RETURN_ERROR;		//configuration state not entered
+    }
     
     // Disable all faults
     FCCU.NCF_E[0].R = 0x00000000;	
@@ -106,6 +119,8 @@ void FCCU_SetProtocol(uint32_t protocol){
     // Exit FCCU Configuration Mode
     FCCU.CTRLK.R = FCCU_KEY_NORMAL ;
     FCCU.CTRL.R = FCCU_OPR_SET_NORMAL;
-    while(FCCU.CTRL.B.OPS != FCCU_OPS_SUCCESS);
-
+    if (TIME_WAIT(TIME_WAIT_FCCU_OPS, TIME_TIMEOUT_FCCU_OPS_US, FCCU.CTRL.B.OPS == FCCU_OPS_SUCCESS) != TIME_WAIT_OK){
+	return FCCU_RETURN_ERROR;		//normal state not entered
+    }
+    return FCCU_RETURN_OK;
 }
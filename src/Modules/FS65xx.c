@@ -63,6 +63,22 @@
   B35993 / BRNY001		18/08/2015 	   ALL		  		Driver ported from MC33908
   BRNY001				30/10/2016	FS65_ProcessSPI		Added missing registers (WU_source, Diag_Vcore, Diag_vcca)
   BRNY001				04/10/2017  LDT related functions  Bug correction
+  BRNY001				19/10/2026  FS65_SendBatch		Batched register access through the DSPI FIFOs
+  BRNY001				19/10/2026  FS65_IsrSIUL		Latency histograms from the interrupt entry to the callbacks
+  BRNY001				19/10/2026  FS65_IsrXXX		SPI, float and callback work deferred to the DEFER software interrupt
+  BRNY001				19/10/2026  FS65_Snapshot		Register and voltage stores sequence locked, snapshot readers
+  BRNY001				19/10/2026  FS65_SendCmdXX		Call site of the SPI frames (SPITRACE_SITE)
+  BRNY001				19/10/2026  INTstruct		Register shadow in the local data RAM (DRAM_BSS)
+  BRNY001				19/10/2026  FS65_InitStep		Resumable initialization, FS65_Init runs it with blocking waits
+  BRNY001				19/10/2026  FS65_SaveVkam		Warm resume from the keep-alive RAM snapshot (FS65_InitStep)
+  BRNY001				19/10/2026  FS65_SetLPOFFmode	VKAM_EN kept by the LPOFF commands
+  BRNY001				19/10/2026  FS65_ApplyConfig	INIT and non-INIT registers written only if not in effect
+  BRNY001				19/10/2026  FS65_ApplyConfig	Command buffer sized for one table and initialized
+  BRNY001				19/10/2026  FS65_IsrSIUL		Event handled by the routine if the DEFER queue is full
+  BRNY001				19/10/2026  FS65_InitStep		Live WD LFSR restored from FS65_Vkam, .vkam cleared after BAT_FAIL
+  BRNY001				19/10/2026  FS65_SendBatch		Ceiling released between chunks of FS65_BATCH_CHUNK commands
+  BRNY001				19/10/2026  FS65_InitStep		INIT_VREG read once, BAT_FAIL kept for the cold initialization
+  BRNY001				19/10/2026  FS65_Init_FSSM		WD_LFSR out of the compared table, seeded by FS65_InitStep
 
   ---------------------------   ----------    ------------  ------------------------------------------
   ==================================================================================================*/
@@ -76,11 +92,21 @@
 #include "ADC.h"
 #include "DSPI.h"
 #include "PIT.h"
+#include "TIME.h"
+#include "DEFER.h"
+#include "SPITRACE.h"
 
 /*==================================================================================================
 /                    Global Variables
  *==================================================================================================*/
 uint8_t	FS65_Error = FS65_ERROR_OK;
+FS65_Latency_struct FS65_Latency[FS65_EVENT_NB];		///latency histograms of the events (see FS65_IsrSIUL)
+SEQ_Lock FS65_RegistersLock;							///INTstruct and SPIstruct.statusPwSBC updates
+SEQ_Lock FS65_VoltagesLock;								///ADCstruct.actualVoltage updates
+DRAM_BSS struct FS65_INT_tag INTstruct;					///register shadow (FS65xx_driver.h) in the local data RAM
+VKAM_DATA FS65_Vkam_struct FS65_Vkam;						///warm resume snapshot, kept across LPOFF (FS65_SaveVkam)
+uint8_t FS65_WarmResume;								///1 - last initialization resumed from FS65_Vkam
+FS65_ConfigDiff FS65_ConfigReport[FS65_CONFIG_NB];		///last FS65_ApplyConfig of each configuration table
 
 
 /*==================================================================================================*
@@ -230,17 +256,147 @@ void FS65_UserConfigNonInit(void) {
 	//Add your code below ----------
 }
 
+/*==================================================================================================*/
+/*                    Configuration tables (FS65_ApplyConfig)										*/
+/*==================================================================================================*/
+
+///Main State Machine, INIT_INT excepted (FS65_Init_MSM)
+static const FS65_ConfigItem FS65_ConfigMSM[] = {
+    {INIT_VREG_ADR,					0,										0xF2,	&FS65_Registers_InitValues.INIT_VREG,				(const register32_struct *)&INTstruct.INIT_VREG},
+    {INIT_WU1_ADR,					0,										0xFF,	&FS65_Registers_InitValues.INIT_WU1,				(const register32_struct *)&INTstruct.INIT_WU1},
+    {INIT_WU2_ADR,					0,										0xF7,	&FS65_Registers_InitValues.INIT_WU2,				(const register32_struct *)&INTstruct.INIT_WU2},
+    {INIT_INH_INT_ADR,				0,										0x1F,	&FS65_Registers_InitValues.INIT_INH_INT,			(const register32_struct *)&INTstruct.INIT_INH_INT},
+};
+
+///Fail-Safe State Machine, WD_WINDOW included (FS65_Init_FSSM). WD_LFSR is not compared: the
+///live LFSR moves at each WD refresh, it never matches the seed (seeded by FS65_InitStep)
+static const FS65_ConfigItem FS65_ConfigFSSM[] = {
+    {INIT_FS1B_TIMING_ADR,			FS65_APPLY_SECURE | FS65_APPLY_NIBBLE,	0x0F,	&FS65_Registers_InitValues.INIT_FS1B_TIMING,		(const register32_struct *)&INTstruct.INIT_FS1B_TIMING},
+    {INIT_SUPERVISOR_ADR,			FS65_APPLY_SECURE | FS65_APPLY_NIBBLE,	0x0F,	&FS65_Registers_InitValues.INIT_SUPERVISOR,			(const register32_struct *)&INTstruct.INIT_SUPERVISOR},
+    {INIT_FAULT_ADR,				FS65_APPLY_SECURE | FS65_APPLY_NIBBLE,	0x0F,	&FS65_Registers_InitValues.INIT_FAULT,				(const register32_struct *)&INTstruct.INIT_FAULT},
+    {INIT_FSSM_ADR,					FS65_APPLY_SECURE | FS65_APPLY_NIBBLE,	0x0F,	&FS65_Registers_InitValues.INIT_FSSM,				(const register32_struct *)&INTstruct.INIT_FSSM},
+    {INIT_SF_IMPACT_ADR,			FS65_APPLY_SECURE | FS65_APPLY_NIBBLE,	0x0F,	&FS65_Registers_InitValues.INIT_SF_IMPACT,			(const register32_struct *)&INTstruct.INIT_SF_IMPACT},
+    {WD_WINDOW_ADR,					FS65_APPLY_SECURE | FS65_APPLY_NIBBLE,	0x0F,	&FS65_Registers_InitValues.WD_WINDOW,				(const register32_struct *)&INTstruct.WD_WINDOW},
+    {INIT_WD_CNT_ADR,				FS65_APPLY_SECURE | FS65_APPLY_NIBBLE,	0x0F,	&FS65_Registers_InitValues.INIT_WD_CNT,				(const register32_struct *)&INTstruct.INIT_WD_CNT},
+    {INIT_VCORE_OVUV_IMPACT_ADR,	FS65_APPLY_SECURE | FS65_APPLY_NIBBLE,	0x0F,	&FS65_Registers_InitValues.INIT_VCORE_OVUV_IMPACT,	(const register32_struct *)&INTstruct.INIT_VCORE_OVUV_IMPACT},
+    {INIT_VCCA_OVUV_IMPACT_ADR,		FS65_APPLY_SECURE | FS65_APPLY_NIBBLE,	0x0F,	&FS65_Registers_InitValues.INIT_VCCA_OVUV_IMPACT,	(const register32_struct *)&INTstruct.INIT_VCCA_OVUV_IMPACT},
+    {INIT_VAUX_OVUV_IMPACT_ADR,		FS65_APPLY_SECURE | FS65_APPLY_NIBBLE,	0x0F,	&FS65_Registers_InitValues.INIT_VAUX_OVUV_IMPACT,	(const register32_struct *)&INTstruct.INIT_VAUX_OVUV_IMPACT},
+};
+
+///NORMAL registers (FS65_Config_NonInit)
+static const FS65_ConfigItem FS65_ConfigNonInit[] = {
+    {CAN_LIN_MODE_ADR,				0,										0xFC,	&FS65_Registers_InitValues.CAN_LIN_MODE,			(const register32_struct *)&INTstruct.CAN_LIN_MODE},
+};
+
+#define FS65_CONFIG_ITEMS(table)	(sizeof(table) / sizeof((table)[0]))
+
 /*==================================================================================================*/
 /*                    PUBLIC FUNCTIONS																*/
 /*==================================================================================================*/
 
+/****************************************************************************!
+ *   @brief 	The function FS65_ApplyConfig writes the registers of a
+ *		configuration table which are not in effect
+ *   @par Include
+ *		FS65xx.h
+ *   @par Description
+ *		The content in effect is read in one DSPI batch (FS65_APPLY_READ) or
+ *		taken from the register shadow (FS65_APPLY_CACHED), its configuration
+ *		bits are compared with the values of the table. Only the registers which
+ *		differ are written, each one followed by its read back, in a second
+ *		batch: when the FS65 already holds the configuration (reset of the MCU
+ *		only), the function costs the reads. The writes are one frame apart,
+ *		more than the 3 us between two writes of fail-safe registers.
+ *   @param[in] p_items - Configuration table.
+ *   @param[in] nbItems - Number of registers (at most FS65_APPLY_MAX).
+ *   @param[in] source - FS65_APPLY_READ / FS65_APPLY_CACHED.
+ *   @param[out] p_diff - Diff report: registers written, not verified, frames.
+ *   @return
+ *		- FS65_RETURN_OK 		- Configuration in effect
+ *		- OTHERS			 	- Number of errors encountered (register not
+ *								  verified, SPI failure)
+ *   @remarks 	FS65_APPLY_CACHED requires a shadow read since the last restart of
+ *		the FS65 (e.g. FS65_GetStatus), the INIT registers can be written in the
+ *		INIT phases only.
+ *   @par Code sample
+ *		errors = FS65_ApplyConfig(FS65_ConfigFSSM, 10, FS65_APPLY_READ, &diff);
+ ********************************************************************************/
+uint32_t FS65_ApplyConfig(const FS65_ConfigItem* p_items, uint32_t nbItems, uint32_t source, FS65_ConfigDiff* p_diff)
+{
+    uint32_t cmd[2 * FS65_APPLY_MAX] = {0};		//write and read back of each register
+    uint16_t answer[2 * FS65_APPLY_MAX];
+    uint8_t expected[FS65_APPLY_MAX];
+    uint32_t current;
+    uint32_t errorCode = FS65_RETURN_OK;
+    uint32_t nbCmd = 0;
+    uint32_t i;
+
+    p_diff->differ = 0;
+    p_diff->failed = 0;
+    p_diff->reads = 0;
+    p_diff->writes = 0;
+    if (nbItems > FS65_APPLY_MAX) {
+	return FS65_RETURN_ERROR;
+    }
+
+    // 1. Content in effect
+    if (source == FS65_APPLY_READ) {
+	for (i = 0; i < nbItems; i++) {
+	    cmd[i] = (uint32_t)p_items[i].address << 9;
+	    answer[i] = 0xFFFF;							//same as no SPI answer
+	}
+	p_diff->reads = (uint8_t)nbItems;
+	if (FS65_SendBatch(cmd, answer, nbItems) != FS65_RETURN_OK) {
+	    return FS65_RETURN_ERROR;
+	}
+    }
+
+    // 2. Registers not in effect: write and read back
+    for (i = 0; i < nbItems; i++) {
+	expected[i] = (uint8_t)((((p_items[i].flags & FS65_APPLY_NIBBLE) != 0) ? (*p_items[i].p_value >> 4) : *p_items[i].p_value)
+				& p_items[i].mask);
+	current = (source == FS65_APPLY_READ) ? answer[i] : p_items[i].p_shadow->R;
+	if ((current & p_items[i].mask) != expected[i]) {
+	    p_diff->differ |= 1UL << i;
+	    cmd[nbCmd++] = (((p_items[i].flags & FS65_APPLY_SECURE) != 0) ? FS65_BATCH_SECURE : 0)
+			   | 0x8000 | ((uint32_t)p_items[i].address << 9) | *p_items[i].p_value;
+	    cmd[nbCmd++] = (uint32_t)p_items[i].address << 9;
+	}
+    }
+    if (nbCmd == 0) {
+	return FS65_RETURN_OK;
+    }
+    for (i = 0; i < nbCmd; i++) {
+	answer[i] = 0xFFFF;
+    }
+    p_diff->writes = (uint8_t)(nbCmd / 2);
+    p_diff->reads += (uint8_t)(nbCmd / 2);
+    if (FS65_SendBatch(cmd, answer, nbCmd) != FS65_RETURN_OK) {
+	errorCode++;
+    }
+
+    // 3. Read back of the registers written
+    nbCmd = 1;
+    for (i = 0; i < nbItems; i++) {
+	if ((p_diff->differ & (1UL << i)) != 0) {
+	    if ((answer[nbCmd] & p_items[i].mask) != expected[i]) {
+		p_diff->failed |= 1UL << i;
+		errorCode++;
+	    }
+	    nbCmd += 2;
+	}
+    }
+    return errorCode;
+}
+
 /****************************************************************************!
  *   @brief 	The function FS65_Config_NonInit initialize the non-INIT registers
  *   @par Include
  *		FS65xx.h
  *   @par Description
  *       This function initializes some NORMAL registers of the FSSM and MSM.
- *       The register CAN_LIN_MODE is updated and the function FS65_UserConfigNonInit()
+ *       The register CAN_LIN_MODE is written if not in effect (FS65_ApplyConfig, diff
+ *       report in FS65_ConfigReport[FS65_CONFIG_NON_INIT]) and the function FS65_UserConfigNonInit()
  *       is called. The user should add its own configuration in the function
  *       FS65_UserConfigNonInit().
  *       The initial value is recorded in the structure "FS65_Registers_InitValues".
@@ -252,7 +408,8 @@ uint32_t FS65_Config_NonInit(void)
 {
     uint32_t errorCode = FS65_RETURN_OK;
 
-    errorCode += FS65_Set_CAN_LIN_MODE(FS65_Registers_InitValues.CAN_LIN_MODE);
+    errorCode += FS65_ApplyConfig(FS65_ConfigNonInit, FS65_CONFIG_ITEMS(FS65_ConfigNonInit), FS65_APPLY_READ,
+				  &FS65_ConfigReport[FS65_CONFIG_NON_INIT]);
     FS65_UserConfigNonInit();
 
     return errorCode;
@@ -266,47 +423,19 @@ uint32_t FS65_Config_NonInit(void)
  *   @par Description
  *		This function initializes all the INIT registers of the Fail-Safe State Machine
  *		according to the values stored in the structure "FS65_Registers_InitValues"
- *		In addition, the registers WD_WINDOW and WD_LFSR are also initialized
+ *		In addition, the register WD_WINDOW is also initialized. WD_LFSR is
+ *		not compared (the live LFSR differs from the seed once the watchdog
+ *		runs), the cold initialization seeds it (FS65_InitStep).
+ *		Only the registers not in effect are written (FS65_ApplyConfig, diff report
+ *		in FS65_ConfigReport[FS65_CONFIG_FSSM]).
  *   @return
  *		- FS65_RETURN_OK 		- Operation sucessful
  *		- OTHERS			 	- Number of errors encountered
  ********************************************************************************/
 uint32_t FS65_Init_FSSM(void)
 {
-    uint32_t errorCode = FS65_RETURN_OK;
-
-    errorCode = FS65_Set_INIT_FS1B_TIMING(FS65_Registers_InitValues.INIT_FS1B_TIMING);
-    PIT_wait_micsec(3);  //Wait 3micsec
-
-    errorCode += FS65_Set_INIT_SUPERVISOR(FS65_Registers_InitValues.INIT_SUPERVISOR);	//Normal threshold for Vcore/Vcca/Vaux
-    PIT_wait_micsec(3);  //Wait 3micsec
-
-    errorCode += FS65_Set_INIT_FAULT(FS65_Registers_InitValues.INIT_FAULT);		//FLT_ERR final=6,FSx activated when FLT_ERR reaches intermediate
-    PIT_wait_micsec(3);                                          //no CAN Tx when FS1b is activated
-
-    errorCode += FS65_Set_INIT_FSSM(FS65_Registers_InitValues.INIT_FSSM);
-    PIT_wait_micsec(3);  //Wait 3micsec
-
-    errorCode += FS65_Set_INIT_SF_IMPACT(FS65_Registers_InitValues.INIT_SF_IMPACT);	//FS1b in delay mode, 8sec timer enabled for reset,Reset act on WD accumulated error
-    PIT_wait_micsec(3);  //Wait 3micsec
-
-    errorCode += FS65_ChangeWDwindow(FS65_Registers_InitValues.WD_WINDOW);				//3msec window
-    PIT_wait_micsec(3);  //Wait 3micsec
-
-    errorCode += FS65_SendSeed(FS65_Registers_InitValues.WD_LFSR);							//0xB2
-    PIT_wait_micsec(3);  //Wait 3micsec
-
-    errorCode += FS65_Set_INIT_WD_CNT(FS65_Registers_InitValues.INIT_WD_CNT);			//WD_CNT_ERR max=6, WD_CNT_RFR=6
-    PIT_wait_micsec(3);  //Wait 3micsec
-
-    errorCode += FS65_Set_INIT_VCORE_OVUV_IMPACT(FS65_Registers_InitValues.INIT_VCORE_OVUV_IMPACT);	//OV : RST&FS, UV : FS
-    PIT_wait_micsec(3);  //Wait 3micsec
-    errorCode += FS65_Set_INIT_VCCA_OVUV_IMPACT(FS65_Registers_InitValues.INIT_VCCA_OVUV_IMPACT);		//OV : RST&FS, UV : FS
-    PIT_wait_micsec(3);  //Wait 3micsec
-    errorCode += FS65_Set_INIT_VAUX_OVUV_IMPACT(FS65_Registers_InitValues.INIT_VAUX_OVUV_IMPACT);		//OV : RST&FS, UV : FS
-
-    return errorCode;
-
+    return FS65_ApplyConfig(FS65_ConfigFSSM, FS65_CONFIG_ITEMS(FS65_ConfigFSSM), FS65_APPLY_READ,
+			    &FS65_ConfigReport[FS65_CONFIG_FSSM]);
 }
 
 /****************************************************************************!
@@ -316,6 +445,8 @@ uint32_t FS65_Init_FSSM(void)
  *   @par Description
  *		This function initializes all the INIT registers of the Main State Machine (excepted INIT_INT)
  *		according to the values stored in the structure "FS65_Registers_InitValues".
+ *		Only the registers not in effect are written (FS65_ApplyConfig, diff report
+ *		in FS65_ConfigReport[FS65_CONFIG_MSM]).
  *		INIT_INT should be initialized independently because after its initialization
  *		the INIT mode is exited.
  *   @return
@@ -324,40 +455,130 @@ uint32_t FS65_Init_FSSM(void)
  ********************************************************************************/
 uint32_t FS65_Init_MSM(void)
 {
-    uint32_t errorCode = FS65_RETURN_OK;
-
-    errorCode = FS65_Set_INIT_VREG(FS65_Registers_InitValues.INIT_VREG);		//
-    errorCode += FS65_Set_INIT_WU1(FS65_Registers_InitValues.INIT_WU1);
-    errorCode += FS65_Set_INIT_WU2(FS65_Registers_InitValues.INIT_WU2);
-    errorCode += FS65_Set_INIT_INH_INT(FS65_Registers_InitValues.INIT_INH_INT);
-
-    return errorCode;
+    return FS65_ApplyConfig(FS65_ConfigMSM, FS65_CONFIG_ITEMS(FS65_ConfigMSM), FS65_APPLY_READ,
+			    &FS65_ConfigReport[FS65_CONFIG_MSM]);
 }
 
 /****************************************************************************!
- *   @brief 	The function FS65_Init_MSM initialize the Main State Machine
+ *   @brief 	The function FS65_Init initializes the FS65 device
  *   @par Include
  *		FS65xx.h
  *   @par Description
  *		This function implements the full initialization of the FS65 device.
- *		It calls the function FS65_Init_FSSM() and FS65_Init_MSM(). When an error is encountered,
+ *		It runs FS65_InitStep() until the end, the waits between the steps
+ *		are blocking (PIT_wait_micsec). When an error is encountered,
  *		the function FS65_ErrorCallback is called. The user should define this callback function.
  *		For a complete description of this function, please refer to the document
  *		FS6500_Quick_Starter_Guide.pdf available on the web.
- *   @return
- *		- FS65_RETURN_OK 		- Operation successful
- *		- OTHERS			 	- Number of errors encountered
  ********************************************************************************/
 void FS65_Init(void) {
 
-    uint32_t fs65_error_code;
+    uint32_t waitUs;
+
+    while (FS65_InitStep(&waitUs) == FS65_INIT_WAIT) {
+	PIT_wait_micsec(waitUs);
+    }
+}
 
-    // 0. Get silicon version
-    fs65_error_code = FS65_UpdateRegisterContent(DEVICE_ID_ADR);
+//Steps of FS65_InitStep
+#define FS65_INIT_START			0
+#define FS65_INIT_FS1B			1
+#define FS65_INIT_FS1B_POLL		2
+#define FS65_INIT_FS1B_ABIST	3
+#define FS65_INIT_FS1B_CHECK	4
+#define FS65_INIT_VAUX_ABIST	5
+#define FS65_INIT_VAUX_CHECK	6
+
+static uint32_t FS65_InitPhase = FS65_INIT_START;
+
+///INIT registers of the warm resume, in the order of FS65_Init_MSM, INIT_INT and FS65_Init_FSSM,
+///WD_LFSR after WD_WINDOW (written with the live LFSR, not compared by FS65_Init_FSSM)
+static const struct {
+    uint32_t		cmd;			///write command without data, FS65_BATCH_SECURE if secured
+    const vuint8_t	*p_value;		///value written (FS65_Registers_InitValues)
+    const register32_struct *p_saved;	///content read back before the LPOFF, 0 - the value written
+    uint8_t		mask;			///configuration bits of the read back (latched flags excluded)
+} FS65_WarmInit[FS65_WARM_INIT_NB] = {
+    {0x8000 | (INIT_VREG_ADR << 9),									&FS65_Registers_InitValues.INIT_VREG,				(const register32_struct *)&FS65_Vkam.registers.INIT_VREG,	0xF2},
+    {0x8000 | (INIT_WU1_ADR << 9),									&FS65_Registers_InitValues.INIT_WU1,				(const register32_struct *)&FS65_Vkam.registers.INIT_WU1,	0xFF},
+    {0x8000 | (INIT_WU2_ADR << 9),									&FS65_Registers_InitValues.INIT_WU2,				(const register32_struct *)&FS65_Vkam.registers.INIT_WU2,	0xF7},
+    {0x8000 | (INIT_INH_INT_ADR << 9),								&FS65_Registers_InitValues.INIT_INH_INT,			(const register32_struct *)&FS65_Vkam.registers.INIT_INH_INT,	0x1F},
+    {0x8000 | (INIT_INT_ADR << 9),									&FS65_Registers_InitValues.INIT_INT,				(const register32_struct *)&FS65_Vkam.registers.INIT_INT,	0xFF},
+    {FS65_BATCH_SECURE | 0x8000 | (INIT_FS1B_TIMING_ADR << 9),		&FS65_Registers_InitValues.INIT_FS1B_TIMING,		(const register32_struct *)&FS65_Vkam.registers.INIT_FS1B_TIMING,	0x0F},
+    {FS65_BATCH_SECURE | 0x8000 | (INIT_SUPERVISOR_ADR << 9),		&FS65_Registers_InitValues.INIT_SUPERVISOR,			(const register32_struct *)&FS65_Vkam.registers.INIT_SUPERVISOR,	0x0F},
+    {FS65_BATCH_SECURE | 0x8000 | (INIT_FAULT_ADR << 9),			&FS65_Registers_InitValues.INIT_FAULT,				(const register32_struct *)&FS65_Vkam.registers.INIT_FAULT,	0x0F},
+    {FS65_BATCH_SECURE | 0x8000 | (INIT_FSSM_ADR << 9),				&FS65_Registers_InitValues.INIT_FSSM,				(const register32_struct *)&FS65_Vkam.registers.INIT_FSSM,	0x0F},
+    {FS65_BATCH_SECURE | 0x8000 | (INIT_SF_IMPACT_ADR << 9),		&FS65_Registers_InitValues.INIT_SF_IMPACT,			(const register32_struct *)&FS65_Vkam.registers.INIT_SF_IMPACT,	0x0F},
+    {FS65_BATCH_SECURE | 0x8000 | (WD_WINDOW_ADR << 9),				&FS65_Registers_InitValues.WD_WINDOW,				(const register32_struct *)&FS65_Vkam.registers.WD_WINDOW,	0x0F},
+    {0x8000 | (WD_LFSR_ADR << 9),									&FS65_Vkam.wdLfsr,									0,		0xFF},		//LFSR of the last run, not the seed
+    {FS65_BATCH_SECURE | 0x8000 | (INIT_WD_CNT_ADR << 9),			&FS65_Registers_InitValues.INIT_WD_CNT,				(const register32_struct *)&FS65_Vkam.registers.INIT_WD_CNT,	0x0F},
+    {FS65_BATCH_SECURE | 0x8000 | (INIT_VCORE_OVUV_IMPACT_ADR << 9),	&FS65_Registers_InitValues.INIT_VCORE_OVUV_IMPACT,	(const register32_struct *)&FS65_Vkam.registers.INIT_VCORE_OVUV_IMPACT,	0x0F},
+    {FS65_BATCH_SECURE | 0x8000 | (INIT_VCCA_OVUV_IMPACT_ADR << 9),	&FS65_Registers_InitValues.INIT_VCCA_OVUV_IMPACT,	(const register32_struct *)&FS65_Vkam.registers.INIT_VCCA_OVUV_IMPACT,	0x0F},
+    {FS65_BATCH_SECURE | 0x8000 | (INIT_VAUX_OVUV_IMPACT_ADR << 9),	&FS65_Registers_InitValues.INIT_VAUX_OVUV_IMPACT,	(const register32_struct *)&FS65_Vkam.registers.INIT_VAUX_OVUV_IMPACT,	0x0F},
+};
+
+#define FS65_WARM_MSM_NB		5			///FS65_WarmInit entries of the main state machine (INIT_INT included)
+
+/****************************************************************************!
+ *   @brief 	The function FS65_InitWarm initializes the FS65 device from the
+ *		keep-alive RAM snapshot
+ *   @par Include
+ *		FS65xx.h
+ *   @par Description
+ *		The FS65 restarts after LPOFF like after a power-up: the INIT registers
+ *		must be written again. The identification and configuration registers
+ *		(DEVICE_ID, HW_CONFIG, DEVICE_ID_FS, ...) are taken from the snapshot,
+ *		the INIT registers are written and read back in one DSPI batch, the
+ *		read back content is compared with the snapshot instead of being decoded
+ *		register per register. Only BIST, WU_SOURCE, MODE and the DIAG registers
+ *		are read. WD_LFSR gets the LFSR saved before the LPOFF, the watchdog
+ *		does not restart its sequence from the seed. The writes of the
+ *		fail-safe registers are one frame apart, more than the 3 us required
+ *		between two fail-safe writes.
+ *		When an error is encountered, the function FS65_ErrorCallback is called.
+ *   @remarks 	The snapshot shall be checked before (FS65_CheckVkam).
+ ********************************************************************************/
+static void FS65_InitWarm(void) {
+
+    static const uint16_t diagReads[10] = {DIAG_VPRE_ADR << 9, DIAG_VCORE_ADR << 9, DIAG_VCCA_ADR << 9,
+	DIAG_VAUX_ADR << 9, DIAG_VSUP_VCAN_ADR << 9, DIAG_CAN_FD_ADR << 9, DIAG_CAN_LIN_ADR << 9,
+	DIAG_SPI_ADR << 9, DIAG_SF_IOS_ADR << 9, DIAG_SF_ERR_ADR << 9};
+    uint32_t cmd[FS65_BATCH_MAX];
+    uint16_t answer[FS65_BATCH_MAX];
+    const vuint32_t *p_src = (const vuint32_t *)&FS65_Vkam.registers;
+    vuint32_t *p_dst = (vuint32_t *)&INTstruct;
+    uint32_t expected;
+    uint32_t token;
+    uint32_t nbCmd = 0;
+    uint32_t i;
+
+    //Register shadow of the last run, the batch below updates the registers read
+    token = SEQ_WriteBegin(&FS65_RegistersLock);
+    for (i = 0; i < sizeof(INTstruct) / 4; i++) {
+	p_dst[i] = p_src[i];
+    }
+    SEQ_WriteEnd(&FS65_RegistersLock, token);
+
+    // 1.LBIST & ABIST1 of the restart
+    cmd[nbCmd++] = BIST_ADR << 9;
+    // 3., 5. INIT registers, each one read back
+    for (i = 0; i < FS65_WARM_INIT_NB; i++) {
+	cmd[nbCmd++] = FS65_WarmInit[i].cmd | *FS65_WarmInit[i].p_value;
+	cmd[nbCmd++] = FS65_WarmInit[i].cmd & 0x7E00;
+	if (i == (FS65_WARM_MSM_NB - 1)) {
+	    cmd[nbCmd++] = WU_SOURCE_ADR << 9;		//Read and clear WU sources
+	}
+    }
+    // 5bis, 6. Mode and diagnostics (bits cleared by the read)
+    cmd[nbCmd++] = MODE_ADR << 9;
+    for (i = 0; i < 10; i++) {
+	cmd[nbCmd++] = diagReads[i];
+    }
 
-    // 1.Check LBIST & ABIST1 completion
-    fs65_error_code = FS65_UpdateRegisterContent(BIST_ADR);
-    if (fs65_error_code != FS65_RETURN_OK ) {
+    for (i = 0; i < nbCmd; i++) {
+	answer[i] = 0xFFFF;							//same as no SPI answer
+    }
+    if (FS65_SendBatch(cmd, answer, nbCmd) != FS65_RETURN_OK) {
 	FS65_Error = FS65_SPI_FAIL;
 	FS65_ErrorCallback();
     }
@@ -372,13 +593,88 @@ void FS65_Init(void) {
 	FS65_Error = FS65_ABIST1_FAIL;
 	FS65_ErrorCallback();
     }
-
-    // 2. Get cause of SBC restart
-    fs65_error_code = FS65_UpdateRegisterContent(INIT_VREG_ADR);
-    if (fs65_error_code != FS65_RETURN_OK ) {
-	FS65_Error = FS65_SPI_FAIL;
-	FS65_ErrorCallback();
+    for (i = 0; i < FS65_WARM_INIT_NB; i++) {
+	//read back after the write: answer 2 + 2 * i (+ WU_SOURCE after the main registers)
+	expected = (FS65_WarmInit[i].p_saved != 0) ? FS65_WarmInit[i].p_saved->R : *FS65_WarmInit[i].p_value;
+	if ((answer[2 + 2 * i + ((i >= FS65_WARM_MSM_NB) ? 1 : 0)] & FS65_WarmInit[i].mask) != (expected & FS65_WarmInit[i].mask)) {
+	    // Error during initialization, user action required
+	    FS65_Error = (i < FS65_WARM_MSM_NB) ? FS65_INIT_MSM_FAIL : FS65_INIT_FSSM_FAIL;
+	    FS65_ErrorCallback();
+	}
     }
+}
+
+/****************************************************************************!
+ *   @brief 	The function FS65_InitStep runs the FS65 initialization up to
+ *		the next wait
+ *   @par Include
+ *		FS65xx.h
+ *   @par Description
+ *		Same sequence as FS65_Init() (FS65_Init_MSM, FS65_Init_FSSM, diagnostics,
+ *		ABIST2 of FS1B and VAUX), cut at the waits for the device: FS1B still
+ *		high because of its delay (polled each FS65_INIT_POLL_US) and the two
+ *		ABIST2 runs (FS65_INIT_ABIST2_US). The caller is free to do other work
+ *		during a wait, e.g. the boot sequencer (BOOT.c) initializes the other
+ *		peripherals during the ABIST2 runs. When an error is encountered,
+ *		the function FS65_ErrorCallback is called.
+ *		After an LPOFF with a valid keep-alive RAM snapshot (FS65_SaveVkam),
+ *		the first step is FS65_InitWarm instead of the register per register
+ *		initialization; the snapshot is used once. INIT_VREG is read first:
+ *		after the loss of the battery (BAT_FAIL) the keep-alive RAM is not
+ *		read but cleared (VKAM_Clear). This read is the only one of the
+ *		initialization (step 2, cause of the restart): its flags are
+ *		cleared on read, INTstruct.INIT_VREG keeps BAT_FAIL.
+ *   @param[out] p_waitUs - Minimal time before the next call [us] (FS65_INIT_WAIT).
+ *   @return
+ *		- FS65_INIT_DONE 		- Initialization finished (next call starts again)
+ *		- FS65_INIT_WAIT	 	- Call again after *p_waitUs
+ ********************************************************************************/
+uint32_t FS65_InitStep(uint32_t *p_waitUs) {
+
+    uint32_t fs65_error_code;
+    uint32_t initVregError;
+
+    switch (FS65_InitPhase) {
+    case FS65_INIT_START:
+	//BAT_FAIL: the keep-alive supply was lost with the battery, content and ECC of .vkam too
+	initVregError = FS65_UpdateRegisterContent(INIT_VREG_ADR);
+	if ((initVregError != FS65_RETURN_OK) || (INTstruct.INIT_VREG.B.BAT_FAIL == 1)) {
+	    VKAM_Clear();
+	}
+	FS65_WarmResume = (FS65_CheckVkam() == FS65_RETURN_OK) ? 1 : 0;
+	if (FS65_WarmResume == 1) {
+	    FS65_Vkam.magic = 0;				//used once
+	    FS65_InitWarm();
+	    FS65_InitPhase = FS65_INIT_FS1B;
+	    return FS65_InitStep(p_waitUs);
+	}
+
+	// 0. Get silicon version
+	fs65_error_code = FS65_UpdateRegisterContent(DEVICE_ID_ADR);
+
+	// 1.Check LBIST & ABIST1 completion
+	fs65_error_code = FS65_UpdateRegisterContent(BIST_ADR);
+	if (fs65_error_code != FS65_RETURN_OK ) {
+	    FS65_Error = FS65_SPI_FAIL;
+	    FS65_ErrorCallback();
+	}
+
+	if (INTstruct.BIST.B.LBIST_OK != 1) {
+	    // LBIST Fail, FSx can not be released, user action required
+	    FS65_Error = FS65_LBIST_FAIL;
+	    FS65_ErrorCallback();
+	}
+	if (INTstruct.BIST.B.ABIST1_OK !=1) {
+	    // ABIST1 Fail, FSx can not be relaesed, user action required
+	    FS65_Error = FS65_ABIST1_FAIL;
+	    FS65_ErrorCallback();
+	}
+
+	// 2. Cause of SBC restart: INIT_VREG read above (a second read would clear BAT_FAIL)
+	if (initVregError != FS65_RETURN_OK ) {
+	    FS65_Error = FS65_SPI_FAIL;
+	    FS65_ErrorCallback();
+	}
 
 	// 3. Power-On Reset, Init Main registers should be initialized
 	fs65_error_code = FS65_Init_MSM();
@@ -396,56 +692,63 @@ void FS65_Init(void) {
 	    FS65_ErrorCallback();
 	}
 
-    // 5. Init FSSM registers
-    fs65_error_code = FS65_Init_FSSM();
-    if (fs65_error_code != FS65_RETURN_OK) {
-        // Error during initialization, user action required
-	FS65_Error = FS65_INIT_FSSM_FAIL;
-	FS65_ErrorCallback();
-    }
+	// 5. Init FSSM registers, WD_LFSR seed (no read back: each WD answer is computed from the LFSR read live)
+	fs65_error_code = FS65_Init_FSSM();
+	fs65_error_code += FS65_SendCmdW(0x8000 | (WD_LFSR_ADR << 9) | FS65_Registers_InitValues.WD_LFSR);
+	if (fs65_error_code != FS65_RETURN_OK) {
+	    // Error during initialization, user action required
+	    FS65_Error = FS65_INIT_FSSM_FAIL;
+	    FS65_ErrorCallback();
+	}
 
-    // 5bis; Get current mode of operation
-    fs65_error_code = FS65_UpdateRegisterContent(MODE_ADR);
-    if (fs65_error_code != FS65_RETURN_OK) {
-        // Error during initialization, user action required
-	FS65_Error = FS65_INIT_FSSM_FAIL;
-	FS65_ErrorCallback();
-    }
+	// 5bis; Get current mode of operation
+	fs65_error_code = FS65_UpdateRegisterContent(MODE_ADR);
+	if (fs65_error_code != FS65_RETURN_OK) {
+	    // Error during initialization, user action required
+	    FS65_Error = FS65_INIT_FSSM_FAIL;
+	    FS65_ErrorCallback();
+	}
 
-    // 5ter; Check HW configuration of Vaux/Vcca
-    fs65_error_code = FS65_UpdateRegisterContent(HW_CONFIG_ADR);
-    if (fs65_error_code != FS65_RETURN_OK) {
-        // Error during initialization, user action required
-	FS65_Error = FS65_INIT_FSSM_FAIL;
-	FS65_ErrorCallback();
-    }
+	// 5ter; Check HW configuration of Vaux/Vcca
+	fs65_error_code = FS65_UpdateRegisterContent(HW_CONFIG_ADR);
+	if (fs65_error_code != FS65_RETURN_OK) {
+	    // Error during initialization, user action required
+	    FS65_Error = FS65_INIT_FSSM_FAIL;
+	    FS65_ErrorCallback();
+	}
 
-    // 6. Read all Diag registers to clear all bits
-    fs65_error_code = FS65_RETURN_OK;
-    fs65_error_code += FS65_UpdateRegisterContent(DIAG_VPRE_ADR);
-    fs65_error_code += FS65_UpdateRegisterContent(DIAG_VCORE_ADR);
-    fs65_error_code += FS65_UpdateRegisterContent(DIAG_VCCA_ADR);
-    fs65_error_code += FS65_UpdateRegisterContent(DIAG_VAUX_ADR);
-    fs65_error_code += FS65_UpdateRegisterContent(DIAG_VSUP_VCAN_ADR);
-    fs65_error_code += FS65_UpdateRegisterContent(DIAG_CAN_FD_ADR);
-    fs65_error_code += FS65_UpdateRegisterContent(DIAG_CAN_LIN_ADR);
-    fs65_error_code += FS65_UpdateRegisterContent(DIAG_SPI_ADR);
-    fs65_error_code += FS65_UpdateRegisterContent(DIAG_SF_IOS_ADR);
-    fs65_error_code += FS65_UpdateRegisterContent(DIAG_SF_ERR_ADR);
-    if (fs65_error_code != FS65_RETURN_OK ) {
-	FS65_Error = FS65_SPI_FAIL;
-	FS65_ErrorCallback();
-    }
+	// 6. Read all Diag registers to clear all bits
+	fs65_error_code = FS65_RETURN_OK;
+	fs65_error_code += FS65_UpdateRegisterContent(DIAG_VPRE_ADR);
+	fs65_error_code += FS65_UpdateRegisterContent(DIAG_VCORE_ADR);
+	fs65_error_code += FS65_UpdateRegisterContent(DIAG_VCCA_ADR);
+	fs65_error_code += FS65_UpdateRegisterContent(DIAG_VAUX_ADR);
+	fs65_error_code += FS65_UpdateRegisterContent(DIAG_VSUP_VCAN_ADR);
+	fs65_error_code += FS65_UpdateRegisterContent(DIAG_CAN_FD_ADR);
+	fs65_error_code += FS65_UpdateRegisterContent(DIAG_CAN_LIN_ADR);
+	fs65_error_code += FS65_UpdateRegisterContent(DIAG_SPI_ADR);
+	fs65_error_code += FS65_UpdateRegisterContent(DIAG_SF_IOS_ADR);
+	fs65_error_code += FS65_UpdateRegisterContent(DIAG_SF_ERR_ADR);
+	if (fs65_error_code != FS65_RETURN_OK ) {
+	    FS65_Error = FS65_SPI_FAIL;
+	    FS65_ErrorCallback();
+	}
 
-    // 7. Check if FS1b implemented
-    fs65_error_code = FS65_UpdateRegisterContent(DEVICE_ID_FS_ADR);
-    if (fs65_error_code != FS65_RETURN_OK ) {
-	FS65_Error = FS65_SPI_FAIL;
-	FS65_ErrorCallback();
-    }
+	// 7. Check if FS1b implemented
+	fs65_error_code = FS65_UpdateRegisterContent(DEVICE_ID_FS_ADR);
+	if (fs65_error_code != FS65_RETURN_OK ) {
+	    FS65_Error = FS65_SPI_FAIL;
+	    FS65_ErrorCallback();
+	}
+	FS65_InitPhase = FS65_INIT_FS1B;
+	return FS65_InitStep(p_waitUs);
+
+    case FS65_INIT_FS1B:
+	if (INTstruct.DEVICE_ID_FS.B.FS1 != 1) {
+	    FS65_InitPhase = FS65_INIT_VAUX_ABIST;
+	    return FS65_InitStep(p_waitUs);
+	}
 
-    if (INTstruct.DEVICE_ID_FS.B.FS1 == 1)
-    {
 	//FS1B is implemented, it should be zero at this stage
 	fs65_error_code = FS65_UpdateRegisterContent(RELEASE_FSxB_ADR);
 	if (fs65_error_code != FS65_RETURN_OK ) {
@@ -456,31 +759,34 @@ void FS65_Init(void) {
 	if (INTstruct.RELEASE_FSxB.B.FS1B_SNS == 1)
 	{
 	    //FS1B already high
-	    //fs65_error_code = FS65_UpdateRegisterContent(DIAG_SF_IOS_ADR);
-	    if (fs65_error_code != FS65_RETURN_OK ) {
-		FS65_Error = FS65_SPI_FAIL;
-		FS65_ErrorCallback();
-	    }
-
 	    if (INTstruct.DIAG_SF_IOS.B.FS1B_DIAG >= 2)
 	    {
 		//FS1b short-circuited to high, user action required
 		FS65_Error = FS65_FS1B_SHORT2HIGH;
 		FS65_ErrorCallback();
 	    }
-	    else
-	    {   //FS1B is still high because of the running delay, wait a little
-		do {
-		    fs65_error_code = FS65_UpdateRegisterContent(RELEASE_FSxB_ADR);
-		    if (fs65_error_code != FS65_RETURN_OK ) {
-			FS65_Error = FS65_SPI_FAIL;
-			FS65_ErrorCallback();
-		    }
-		}
-		while (INTstruct.RELEASE_FSxB.B.FS1B_SNS == 1);
-	    }
+	    //FS1B is still high because of the running delay, wait a little
+	    FS65_InitPhase = FS65_INIT_FS1B_POLL;
+	    *p_waitUs = FS65_INIT_POLL_US;
+	    return FS65_INIT_WAIT;
+	}
+	FS65_InitPhase = FS65_INIT_FS1B_ABIST;
+	return FS65_InitStep(p_waitUs);
+
+    case FS65_INIT_FS1B_POLL:
+	fs65_error_code = FS65_UpdateRegisterContent(RELEASE_FSxB_ADR);
+	if (fs65_error_code != FS65_RETURN_OK ) {
+	    FS65_Error = FS65_SPI_FAIL;
+	    FS65_ErrorCallback();
+	}
+	if (INTstruct.RELEASE_FSxB.B.FS1B_SNS == 1) {
+	    *p_waitUs = FS65_INIT_POLL_US;
+	    return FS65_INIT_WAIT;
 	}
+	FS65_InitPhase = FS65_INIT_FS1B_ABIST;
+	return FS65_InitStep(p_waitUs);
 
+    case FS65_INIT_FS1B_ABIST:
 	//Run ABIST2_FS1B
 	fs65_error_code = FS65_RunABIST2_FS1B();
 	if (fs65_error_code != FS65_RETURN_OK) {
@@ -488,8 +794,11 @@ void FS65_Init(void) {
 	    FS65_Error = FS65_ABIST2_FS1B_FAIL;
 	    FS65_ErrorCallback();
 	}
-	PIT_wait_micsec(200);  //Wait 200micsec
+	FS65_InitPhase = FS65_INIT_FS1B_CHECK;
+	*p_waitUs = FS65_INIT_ABIST2_US;
+	return FS65_INIT_WAIT;
 
+    case FS65_INIT_FS1B_CHECK:
 	fs65_error_code = FS65_UpdateRegisterContent(BIST_ADR);
 	if (fs65_error_code != FS65_RETURN_OK ) {
 	    FS65_Error = FS65_SPI_FAIL;
@@ -501,27 +810,33 @@ void FS65_Init(void) {
 	   FS65_Error = FS65_ABIST2_FS1B_FAIL;
 	   FS65_ErrorCallback();
 	}
-    }
-
-    // 8. BIST Vaux if necessary
-    fs65_error_code = FS65_UpdateRegisterContent(INIT_VAUX_OVUV_IMPACT_ADR);
-    if (fs65_error_code != FS65_RETURN_OK ) {
-	FS65_Error = FS65_SPI_FAIL;
-	FS65_ErrorCallback();
-    }
+	FS65_InitPhase = FS65_INIT_VAUX_ABIST;
+	return FS65_InitStep(p_waitUs);
 
-    if ((INTstruct.INIT_VAUX_OVUV_IMPACT.B.VAUX_FS_OV != 0) && (INTstruct.INIT_VAUX_OVUV_IMPACT.B.VAUX_FS_UV != 0))
-    {   // Vaux is safety critical, need to BIST it
-	//Run ABIST2_VAUX
-	fs65_error_code = FS65_RunABIST2_VAUX();
-	if (fs65_error_code != FS65_RETURN_OK) {
-	    // Error during ABIST2 VAUX, user action required
-	    FS65_Error = FS65_ABIST2_VAUX_FAIL;
+    case FS65_INIT_VAUX_ABIST:
+	// 8. BIST Vaux if necessary
+	fs65_error_code = FS65_UpdateRegisterContent(INIT_VAUX_OVUV_IMPACT_ADR);
+	if (fs65_error_code != FS65_RETURN_OK ) {
+	    FS65_Error = FS65_SPI_FAIL;
 	    FS65_ErrorCallback();
 	}
 
-	PIT_wait_micsec(200);  //Wait 200micsec
+	if ((INTstruct.INIT_VAUX_OVUV_IMPACT.B.VAUX_FS_OV != 0) && (INTstruct.INIT_VAUX_OVUV_IMPACT.B.VAUX_FS_UV != 0))
+	{   // Vaux is safety critical, need to BIST it
+	    //Run ABIST2_VAUX
+	    fs65_error_code = FS65_RunABIST2_VAUX();
+	    if (fs65_error_code != FS65_RETURN_OK) {
+		// Error during ABIST2 VAUX, user action required
+		FS65_Error = FS65_ABIST2_VAUX_FAIL;
+		FS65_ErrorCallback();
+	    }
+	    FS65_InitPhase = FS65_INIT_VAUX_CHECK;
+	    *p_waitUs = FS65_INIT_ABIST2_US;
+	    return FS65_INIT_WAIT;
+	}
+	break;
 
+    case FS65_INIT_VAUX_CHECK:
 	fs65_error_code = FS65_UpdateRegisterContent(BIST_ADR);
 	if (fs65_error_code != FS65_RETURN_OK ) {
 	    FS65_Error = FS65_SPI_FAIL;
@@ -533,7 +848,13 @@ void FS65_Init(void) {
 	    FS65_Error = FS65_ABIST2_VAUX_FAIL;
 	    FS65_ErrorCallback();
 	}
-  }
+	break;
+
+    default:
+	break;
+    }
+    FS65_InitPhase = FS65_INIT_START;
+    return FS65_INIT_DONE;
 }
 
 /****************************************************************************!
@@ -915,7 +1236,7 @@ uint32_t FS65_ConfWakeUpValue(uint32_t value){
  *		FS65xx.h
  *   @par Description
  *		This function sets bit GO_LPOFF in the MODE register to switch FS65xx
- *		into the Low power Vreg OFF mode.
+ *		into the Low power Vreg OFF mode. VKAM_EN keeps its last read value.
  *   @return
  *		Return value can be returned only in the case that the MCU is
  *		supplied externally (not using Vcore of the PwSBC). In the
@@ -939,6 +1260,7 @@ uint32_t FS65_SetLPOFFmode(void){
     cmd.B.RW = 1;		//write command
     cmd.B.ADR = MODE_ADR;	//set address
     cmd.B.GO_LPOFF = 1;		//LPOFF mode
+    cmd.B.VKAM_EN = INTstruct.MODE.B.VKAM_EN;	//Vkam kept (last MODE read)
 
     errorCode = FS65_SendSecureCmdW(cmd.R);
     return errorCode;
@@ -951,7 +1273,8 @@ uint32_t FS65_SetLPOFFmode(void){
  *		FS65xx.h
  *   @par Description
  *		This function sets bit LP_OFF_AUTO_WU in the MODE register to switch FS65xx
- *		into the Low power Vreg OFF mode with auto WU
+ *		into the Low power Vreg OFF mode with auto WU. VKAM_EN keeps its last
+ *		read value.
  *   @return
  *		Return value can be returned only in the case that the MCU is
  *		supplied externally (not using Vcore of the PwSBC). In the
@@ -973,6 +1296,7 @@ uint32_t FS65_SetLPOFFmode_autoWU(void){
     cmd.B.RW = 1;			//write command
     cmd.B.ADR = MODE_ADR;		//set address
     cmd.B.LP_OFF_AUTO_WU = 1;		//LPOFF mode with WU
+    cmd.B.VKAM_EN = INTstruct.MODE.B.VKAM_EN;	//Vkam kept (last MODE read)
 
     errorCode = FS65_SendSecureCmdW(cmd.R);
     return errorCode;
@@ -1078,6 +1402,91 @@ uint32_t FS65_DisableVKAM(void){
     }
 }
 
+/******************************************************************************!
+ *   @brief 	The function FS65_ComputeCRC32 computes the CRC-32 of a buffer.
+ *   @par Description
+ *		CRC-32 (reflected polynomial 0xEDB88320), one bit per loop: the
+ *		snapshot is checked once per start.
+ *   @param[in] p_data - Buffer.
+ *   @param[in] length - Number of Bytes.
+ *   @param[in] crc - 0 or CRC of the previous part of the data.
+ *   @return 	CRC-32.
+ ********************************************************************************/
+static uint32_t FS65_ComputeCRC32(const uint8_t *p_data, uint32_t length, uint32_t crc){
+    uint32_t i;
+    uint32_t bit;
+
+    crc = ~crc;
+    for(i = 0; i < length; i++){
+	crc ^= p_data[i];
+	for(bit = 0; bit < 8; bit++){
+	    crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+	}
+    }
+    return ~crc;
+}
+
+/******************************************************************************!
+ *   @brief 	The function FS65_SaveVkam saves the warm resume snapshot in the
+ *		keep-alive RAM.
+ *   @par Include
+ *		FS65xx.h
+ *   @par Description
+ *		This function reads WD_LFSR, copies the register shadow (INTstruct),
+ *		the LFSR and the hash of the initial values (FS65_Registers_InitValues)
+ *		into FS65_Vkam, which the startup code does not clear, and protects
+ *		them with a CRC-32.
+ *		After the wake-up, FS65_InitStep() initializes the device from the
+ *		snapshot (see FS65_CheckVkam).
+ *   @return
+ *		- FS65_RETURN_OK - Snapshot saved. <br>
+ *		- FS65_RETURN_ERROR - WD_LFSR not read or register shadow being updated,
+ *		  nothing saved.
+ *   @remarks 	Call it just before the LPOFF command, after the last register
+ *		access. Vkam should be enabled (FS65_EnableVKAM) if it supplies the
+ *		RAM of the MCU.
+ *   @par Code sample
+ *		FS65_SaveVkam();
+ *		FS65_SetLPOFFmode_autoWU();
+ ********************************************************************************/
+uint32_t FS65_SaveVkam(void){
+
+    FS65_Vkam.magic = 0;
+    if(FS65_UpdateRegisterContent(WD_LFSR_ADR) != FS65_RETURN_OK){	//live LFSR
+	return FS65_RETURN_ERROR;
+    }
+    if(FS65_SnapshotRegisters(&FS65_Vkam.registers, 0) != SEQ_OK){
+	return FS65_RETURN_ERROR;
+    }
+    FS65_Vkam.wdLfsr = (uint8_t)FS65_Vkam.registers.WD_LFSR.B.WD_LFSR;
+    FS65_Vkam.configHash = FS65_ComputeCRC32((const uint8_t *)&FS65_Registers_InitValues, sizeof(FS65_Registers_InitValues), 0);
+    FS65_Vkam.magic = FS65_VKAM_MAGIC;
+    FS65_Vkam.crc = FS65_ComputeCRC32((const uint8_t *)&FS65_Vkam, sizeof(FS65_Vkam) - 4, 0);
+    return FS65_RETURN_OK;
+}
+
+/******************************************************************************!
+ *   @brief 	The function FS65_CheckVkam checks the warm resume snapshot.
+ *   @par Include
+ *		FS65xx.h
+ *   @par Description
+ *		The snapshot is valid if it was saved (magic), if the keep-alive RAM
+ *		kept it (CRC) and if the initial values of the INIT registers did not
+ *		change since (hash, e.g. new software).
+ *   @return
+ *		- FS65_RETURN_OK - Valid snapshot, FS65_InitStep() resumes from it. <br>
+ *		- FS65_RETURN_ERROR - No snapshot (cold start).
+ ********************************************************************************/
+uint32_t FS65_CheckVkam(void){
+
+    if((FS65_Vkam.magic != FS65_VKAM_MAGIC)
+	|| (FS65_Vkam.crc != FS65_ComputeCRC32((const uint8_t *)&FS65_Vkam, sizeof(FS65_Vkam) - 4, 0))
+	|| (FS65_Vkam.configHash != FS65_ComputeCRC32((const uint8_t *)&FS65_Registers_InitValues, sizeof(FS65_Registers_InitValues), 0))){
+	return FS65_RETURN_ERROR;
+    }
+    return FS65_RETURN_OK;
+}
+
 
 /*==================================================================================================
  *======================================  REG_MODE functions  ======================================
@@ -3154,6 +3563,68 @@ uint32_t FS65_ComputeSecurityBits(uint32_t cmd){
 }
 
 
+/******************************************************************************!
+ *   @brief The function FS65_StoreRegister stores a received register content.
+ *	@par Include
+ *					FS65xx.h
+ * 	@par Description
+ *					This function stores the word received on the SPI MISO line
+ *					in the global structure INTstruct.
+ * 	@param[in] address - register address of the command sent in the same frame.
+ * 	@param[in] response - word received on the MISO line.
+ ********************************************************************************/
+static void FS65_StoreRegister(uint32_t address, uint32_t response){
+
+    switch(address){
+	case	INIT_VREG_ADR				:	INTstruct.INIT_VREG.R = response; break;
+	case	INIT_WU1_ADR				:	INTstruct.INIT_WU1.R = response; break;
+	case	INIT_WU2_ADR				:	INTstruct.INIT_WU2.R = response; break;
+	case 	INIT_INT_ADR				:	INTstruct.INIT_INT.R = response; break;
+	case	INIT_INH_INT_ADR			:	INTstruct.INIT_INH_INT.R = response; break;
+	case	LONG_DURATION_TIMER_ADR			:	INTstruct.LONG_DURATION_TIMER.R = response; break;
+	case	HW_CONFIG_ADR				:	INTstruct.HW_CONFIG.R = response; break;
+	case	WU_SOURCE_ADR				:	INTstruct.WU_SOURCE.R = response; break;
+	case	DEVICE_ID_ADR				:	INTstruct.DEVICE_ID.R = response; break;
+	case	IO_INPUT_ADR				:	INTstruct.IO_INPUT.R = response; break;
+	case	DIAG_VPRE_ADR				:	INTstruct.DIAG_VPRE.R = response; break;
+	case	DIAG_VCORE_ADR				:	INTstruct.DIAG_VCORE.R = response; break;
+	case	DIAG_VCCA_ADR				:	INTstruct.DIAG_VCCA.R = response; break;
+	case	DIAG_VAUX_ADR				:	INTstruct.DIAG_VAUX.R = response; break;
+	case	DIAG_VSUP_VCAN_ADR			:	INTstruct.DIAG_VSUP_VCAN.R = response; break;
+	case	DIAG_CAN_FD_ADR				:	INTstruct.DIAG_CAN_FD.R = response; break;
+	case	DIAG_CAN_LIN_ADR			:	INTstruct.DIAG_CAN_LIN.R = response; break;
+	case	DIAG_SPI_ADR				:	INTstruct.DIAG_SPI.R = response; break;
+	case	MODE_ADR					:	INTstruct.MODE.R = response; break;
+	case	REG_MODE_ADR				:	INTstruct.REG_MODE.R = response; break;
+	case	IO_OUT_AMUX_ADR				:	INTstruct.IO_OUT_AMUX.R = response; break;
+	case	CAN_LIN_MODE_ADR			:	INTstruct.CAN_LIN_MODE.R = response; break;
+	case	LDT_AFTER_RUN_1_ADR			:	INTstruct.LDT_AFTER_RUN_1.R = response; break;
+	case	LDT_AFTER_RUN_2_ADR			:	INTstruct.LDT_AFTER_RUN_2.R = response; break;
+	case	LDT_WAKE_UP_1_ADR			: 	INTstruct.LDT_WAKE_UP_1.R = response; break;
+	case	LDT_WAKE_UP_2_ADR			: 	INTstruct.LDT_WAKE_UP_2.R = response; break;
+	case	LDT_WAKE_UP_3_ADR			: 	INTstruct.LDT_WAKE_UP_3.R = response; break;
+	case	INIT_FS1B_TIMING_ADR		:	INTstruct.INIT_FS1B_TIMING.R = response; break;
+	case	BIST_ADR					: 	INTstruct.BIST.R = response; break;
+	case	INIT_SUPERVISOR_ADR			:	INTstruct.INIT_SUPERVISOR.R = response; break;
+	case	INIT_FAULT_ADR				:	INTstruct.INIT_FAULT.R = response; break;
+	case	INIT_FSSM_ADR				:	INTstruct.INIT_FSSM.R = response; break;
+	case	INIT_SF_IMPACT_ADR			:	INTstruct.INIT_SF_IMPACT.R = response; break;
+	case	WD_WINDOW_ADR				:	INTstruct.WD_WINDOW.R = response; break;
+	case	WD_LFSR_ADR				:	INTstruct.WD_LFSR.R = response; break;
+	case	WD_ANSWER_ADR				:	INTstruct.WD_ANSWER.R = response; break;
+	case	RELEASE_FSxB_ADR			:	INTstruct.RELEASE_FSxB.R = response; break;
+	case	SF_OUTPUT_REQUEST_ADR			:	INTstruct.SF_OUTPUT_REQUEST.R = response; break;
+	case	INIT_WD_CNT_ADR				:	INTstruct.INIT_WD_CNT.R = response; break;
+	case	DIAG_SF_IOS_ADR				: 	INTstruct.DIAG_SF_IOS.R = response; break;
+	case	WD_COUNTER_ADR				:	INTstruct.WD_COUNTER.R = response; break;
+	case	DIAG_SF_ERR_ADR				: 	INTstruct.DIAG_SF_ERR.R = response; break;
+	case	INIT_VCORE_OVUV_IMPACT_ADR		:	INTstruct.INIT_VCORE_OVUV_IMPACT.R = response; break;
+	case	INIT_VCCA_OVUV_IMPACT_ADR		:	INTstruct.INIT_VCCA_OVUV_IMPACT.R = response; break;
+	case	INIT_VAUX_OVUV_IMPACT_ADR		:	INTstruct.INIT_VAUX_OVUV_IMPACT.R = response; break;
+	case	DEVICE_ID_FS_ADR			:	INTstruct.DEVICE_ID_FS.R = response; break;
+    }
+}
+
 /******************************************************************************!
  *   @brief The function FS65_ProcessSPI treats the data received on the SPI MISO line.
  *	@par Include
@@ -3173,59 +3644,15 @@ uint32_t FS65_ComputeSecurityBits(uint32_t cmd){
 void FS65_ProcessSPI(void){
 
     uint32_t address = 0;
+    uint32_t token = 0;
 
     SPIstruct.response = DSPI_Read(DSPI_NB);
-    SPIstruct.statusPwSBC.R = SPIstruct.response >> 8;
-
     address = (SPIstruct.readCmd & 0x00007E00) >> 9;									//mask register address from the read command
-    switch(address){
-	case	INIT_VREG_ADR				:	INTstruct.INIT_VREG.R = SPIstruct.response; break;
-	case	INIT_WU1_ADR				:	INTstruct.INIT_WU1.R = SPIstruct.response; break;
-	case	INIT_WU2_ADR				:	INTstruct.INIT_WU2.R = SPIstruct.response; break;
-	case 	INIT_INT_ADR				:	INTstruct.INIT_INT.R = SPIstruct.response; break;
-	case	INIT_INH_INT_ADR			:	INTstruct.INIT_INH_INT.R = SPIstruct.response; break;
-	case	LONG_DURATION_TIMER_ADR			:	INTstruct.LONG_DURATION_TIMER.R = SPIstruct.response; break;
-	case	HW_CONFIG_ADR				:	INTstruct.HW_CONFIG.R = SPIstruct.response; break;
-	case	WU_SOURCE_ADR				:	INTstruct.WU_SOURCE.R = SPIstruct.response; break;
-	case	DEVICE_ID_ADR				:	INTstruct.DEVICE_ID.R = SPIstruct.response; break;
-	case	IO_INPUT_ADR				:	INTstruct.IO_INPUT.R = SPIstruct.response; break;
-	case	DIAG_VPRE_ADR				:	INTstruct.DIAG_VPRE.R = SPIstruct.response; break;
-	case	DIAG_VCORE_ADR				:	INTstruct.DIAG_VCORE.R = SPIstruct.response; break;
-	case	DIAG_VCCA_ADR				:	INTstruct.DIAG_VCCA.R = SPIstruct.response; break;
-	case	DIAG_VAUX_ADR				:	INTstruct.DIAG_VAUX.R = SPIstruct.response; break;
-	case	DIAG_VSUP_VCAN_ADR			:	INTstruct.DIAG_VSUP_VCAN.R = SPIstruct.response; break;
-	case	DIAG_CAN_FD_ADR				:	INTstruct.DIAG_CAN_FD.R = SPIstruct.response; break;
-	case	DIAG_CAN_LIN_ADR			:	INTstruct.DIAG_CAN_LIN.R = SPIstruct.response; break;
-	case	DIAG_SPI_ADR				:	INTstruct.DIAG_SPI.R = SPIstruct.response; break;
-	case	MODE_ADR					:	INTstruct.MODE.R = SPIstruct.response; break;
-	case	REG_MODE_ADR				:	INTstruct.REG_MODE.R = SPIstruct.response; break;
-	case	IO_OUT_AMUX_ADR				:	INTstruct.IO_OUT_AMUX.R = SPIstruct.response; break;
-	case	CAN_LIN_MODE_ADR			:	INTstruct.CAN_LIN_MODE.R = SPIstruct.response; break;
-	case	LDT_AFTER_RUN_1_ADR			:	INTstruct.LDT_AFTER_RUN_1.R = SPIstruct.response; break;
-	case	LDT_AFTER_RUN_2_ADR			:	INTstruct.LDT_AFTER_RUN_2.R = SPIstruct.response; break;
-	case	LDT_WAKE_UP_1_ADR			: 	INTstruct.LDT_WAKE_UP_1.R = SPIstruct.response; break;
-	case	LDT_WAKE_UP_2_ADR			: 	INTstruct.LDT_WAKE_UP_2.R = SPIstruct.response; break;
-	case	LDT_WAKE_UP_3_ADR			: 	INTstruct.LDT_WAKE_UP_3.R = SPIstruct.response; break;
-	case	INIT_FS1B_TIMING_ADR		:	INTstruct.INIT_FS1B_TIMING.R = SPIstruct.response; break;
-	case	BIST_ADR					: 	INTstruct.BIST.R = SPIstruct.response; break;
-	case	INIT_SUPERVISOR_ADR			:	INTstruct.INIT_SUPERVISOR.R = SPIstruct.response; break;
-	case	INIT_FAULT_ADR				:	INTstruct.INIT_FAULT.R = SPIstruct.response; break;
-	case	INIT_FSSM_ADR				:	INTstruct.INIT_FSSM.R = SPIstruct.response; break;
-	case	INIT_SF_IMPACT_ADR			:	INTstruct.INIT_SF_IMPACT.R = SPIstruct.response; break;
-	case	WD_WINDOW_ADR				:	INTstruct.WD_WINDOW.R = SPIstruct.response; break;
-	case	WD_LFSR_ADR				:	INTstruct.WD_LFSR.R = SPIstruct.response; break;
-	case	WD_ANSWER_ADR				:	INTstruct.WD_ANSWER.R = SPIstruct.response; break;
-	case	RELEASE_FSxB_ADR			:	INTstruct.RELEASE_FSxB.R = SPIstruct.response; break;
-	case	SF_OUTPUT_REQUEST_ADR			:	INTstruct.SF_OUTPUT_REQUEST.R = SPIstruct.response; break;
-	case	INIT_WD_CNT_ADR				:	INTstruct.INIT_WD_CNT.R = SPIstruct.response; break;
-	case	DIAG_SF_IOS_ADR				: 	INTstruct.DIAG_SF_IOS.R = SPIstruct.response; break;
-	case	WD_COUNTER_ADR				:	INTstruct.WD_COUNTER.R = SPIstruct.response; break;
-	case	DIAG_SF_ERR_ADR				: 	INTstruct.DIAG_SF_ERR.R = SPIstruct.response; break;
-	case	INIT_VCORE_OVUV_IMPACT_ADR		:	INTstruct.INIT_VCORE_OVUV_IMPACT.R = SPIstruct.response; break;
-	case	INIT_VCCA_OVUV_IMPACT_ADR		:	INTstruct.INIT_VCCA_OVUV_IMPACT.R = SPIstruct.response; break;
-	case	INIT_VAUX_OVUV_IMPACT_ADR		:	INTstruct.INIT_VAUX_OVUV_IMPACT.R = SPIstruct.response; break;
-	case	DEVICE_ID_FS_ADR			:	INTstruct.DEVICE_ID_FS.R = SPIstruct.response; break;
-    }
+
+    token = SEQ_WriteBegin(&FS65_RegistersLock);
+    SPIstruct.statusPwSBC.R = SPIstruct.response >> 8;
+    FS65_StoreRegister(address, SPIstruct.response);
+    SEQ_WriteEnd(&FS65_RegistersLock, token);
 }
 
 /******************************************************************************!
@@ -3251,6 +3678,7 @@ uint32_t FS65_SendCmdR(uint32_t cmd){
 
     stockPriority = INTC_0.CPR0.B.PRI;			//save current priority
     INTC_0.CPR0.B.PRI = INT_CEIL_PRIORITY;		//block DSPI resource
+    SPITRACE_SITE();							//frames recorded with the caller address
 
     SPIstruct.writeCmd = 0;					//NO write cmd
     SPIstruct.readCmd = cmd;				//set read cmd
@@ -3311,6 +3739,7 @@ uint32_t FS65_SendCmdW(uint32_t cmd){
 
     stockPriority = INTC_0.CPR0.B.PRI;				//save current priority
     INTC_0.CPR0.B.PRI = INT_CEIL_PRIORITY;			//block DSPI resource
+    SPITRACE_SITE();							//frames recorded with the caller address
 
     SPIstruct.writeCmd = cmd;
     SPIstruct.writeCmd = FS65_ComputeParity(SPIstruct.writeCmd);
@@ -3371,9 +3800,11 @@ uint32_t FS65_SendCmdW(uint32_t cmd){
  ********************************************************************************/
 uint32_t  FS65_SendCmdRW(uint32_t cmd){
     uint32_t stockPriority = 0;
+    uint32_t token = 0;
 
     stockPriority = INTC_0.CPR0.B.PRI;			//save current priority
     INTC_0.CPR0.B.PRI = INT_CEIL_PRIORITY;		//block DSPI resource
+    SPITRACE_SITE();							//frames recorded with the caller address
 
     SPIstruct.writeCmd = cmd | 0x8000;							//create write cmd
     SPIstruct.readCmd = cmd & 0x7E00;							//create read cmd
@@ -3381,7 +3812,9 @@ uint32_t  FS65_SendCmdRW(uint32_t cmd){
 
     DSPI_Send(DSPI_NB, DSPI_CS, SPIstruct.writeCmd);			//send the write command, function waits for result
     SPIstruct.response = DSPI_Read(DSPI_NB);					//read result and release inp. buffer
+    token = SEQ_WriteBegin(&FS65_RegistersLock);
     SPIstruct.statusPwSBC.R = SPIstruct.response >> 8;
+    SEQ_WriteEnd(&FS65_RegistersLock, token);
 
     DSPI_Send(DSPI_NB, DSPI_CS, SPIstruct.readCmd);				//send the read command, function waits for result
     FS65_ProcessSPI();												//read received cmd and save it in the global structure
@@ -3439,9 +3872,11 @@ uint32_t  FS65_SendCmdRW(uint32_t cmd){
  ********************************************************************************/
 uint32_t FS65_SendSecureCmdRW(uint32_t cmd){
     uint32_t stockPriority = 0;
+    uint32_t token = 0;
 
     stockPriority = INTC_0.CPR0.B.PRI;			//save current priority
     INTC_0.CPR0.B.PRI = INT_CEIL_PRIORITY;	//block DSPI resource
+    SPITRACE_SITE();							//frames recorded with the caller address
 
     SPIstruct.writeCmd = cmd | 0x8000;									//create write cmd
     SPIstruct.readCmd = cmd & 0x7E00;									//create read cmd
@@ -3452,7 +3887,9 @@ uint32_t FS65_SendSecureCmdRW(uint32_t cmd){
 
     DSPI_Send(DSPI_NB, DSPI_CS, SPIstruct.writeCmd);					//send the write command, function waits for result
     SPIstruct.response = DSPI_Read(DSPI_NB);							//read result and release inp. buffer
+    token = SEQ_WriteBegin(&FS65_RegistersLock);
     SPIstruct.statusPwSBC.R = SPIstruct.response >> 8;
+    SEQ_WriteEnd(&FS65_RegistersLock, token);
 
     DSPI_Send(DSPI_NB, DSPI_CS, SPIstruct.readCmd);						//send the read command, function waits for result
     FS65_ProcessSPI();														//read received cmd and save it in the global structure
@@ -3508,6 +3945,7 @@ uint32_t FS65_SendSecureCmdW(uint32_t cmd){
 
     stockPriority = INTC_0.CPR0.B.PRI;			//save current priority
     INTC_0.CPR0.B.PRI = INT_CEIL_PRIORITY;	//block DSPI resource
+    SPITRACE_SITE();							//frames recorded with the caller address
 
     SPIstruct.writeCmd = cmd;
     SPIstruct.writeCmd = FS65_ComputeSecurityBits(SPIstruct.writeCmd);
@@ -3544,70 +3982,252 @@ uint32_t FS65_SendSecureCmdW(uint32_t cmd){
 }
 
 /******************************************************************************!
- *   @brief The function FS65_GetVoltageTight reads a value from the ADC and recomputes it into a voltage considering
- *			a tight voltage range ratio.
- *	@par Include
- *					PwSBC.h
- * 	@par Description
- *					This function reads value from ADC and recomputes it into voltage
- *					considering tight voltage range ratio.
- * 	@return 	Voltage [V] that was measured on the active AMUX channel.
- *				The returned value is computed as follows:
- *				(Vcca/ADC_RESOLUTION)*x*VAMUX_TG_X, where:
- *				- Vcca - if the parameter ADC_SOURCE_CALIB is defined in
- *				the global defines, then its value is used as a Vcca. If this
- *				parameter is not defined, then either 3.3 or 5.0 V is used
- *				instead depending on the Vcca_HW bit. This bit is checked and
- *				the appropriate voltage is chosen automatically by this function.
- *				- ADC_RESOLUTION - this parameter is defined in the global
- *				defines. By default for the MPC5744P the 12-bit ADC is used,
- *				so the number (2^12)-1 = 4095 corresponds to this parameter.
- *				- x - number obtained from ADC in the 12-bit range (value from
- *				0 till 4095)
- *				- VAMUX_TG_X - divider ration tight input voltage range.
- *				(VAMUX_TG_X = 2 for Vcca = 5 V; VAMUX_TG_X = 3 for Vcca = 3.3 V)
- *	@remarks 	This function works only when the tight range is being used.
- *				This range allows to measure voltages from 2 till 10 V. If
- *				a wider range is necessary, then FS65_GetVoltageWide should be
- *				used instead.
- *				- Example of computations (Vcca = 3.3 V, ADC_SOURCE_CALIB is not
- *				defined, ADC_RESOLUTION = 4095 by default, VAMUX_TG_X = 3,
- *				x = 1089):	(3.3/4095)*1089*3 = 2.63V
+ *   @brief Sends a batch of read and write commands and waits until the end
+ *			of transmission.
+ *	@par Include:
+ *					FS65xx.h
+ * 	@par Description:
+ *					Function sends all commands back to back through the DSPI
+ *					FIFOs (see DSPI_SendBatch) and stores each answer in the
+ *					global structure, as the single command functions do. A
+ *					refresh of all registers thus costs one pipelined transfer
+ *					instead of one blocking transfer per register.
+ *					The commands are sent in chunks of FS65_BATCH_CHUNK, the
+ *					INT_CEIL_PRIORITY ceiling is released between two chunks:
+ *					a long batch (GUI READ_ALL) blocks the WD refresh for one
+ *					chunk only.
+ * 	@param[in] p_cmd - 	16-bit commands. Commands with the R/W bit set are
+ *						write commands, parity is computed by this function.
+ *						Write commands ORed with FS65_BATCH_SECURE get also the
+ *						four security bits.
+ * 	@param[out] p_response - Answer of each command (status and register content).
+ * 	@param[in] nbCmd - 	Number of commands (at most FS65_BATCH_MAX).
+ * 	@return 	0 - All commands were sent without any error. <br>
+ *				1 - SPI_G error reported in an answer, no SPI answer or too
+ *				many commands.
+ *	@remarks 	Commands are independent: a write is not followed by a read
+ *				back automatically, put a read command after it if the
+ *				register content shall be verified. Other FS65 accesses may
+ *				run between two chunks.
  *	@par Code sample
- *													</para>
- *			float voltage;							</para>
- *			voltage = FS65_GetVoltageTight();		</para>
- *			- This function reads value from ADC (depending on actual AMUX channel)
- *			and returns value as a voltage [V].
+ *			FS65_SendBatch(cmd, answer, 2);
+ *			- Sends both commands of the cmd array in one transfer.
  ********************************************************************************/
-float FS65_GetVoltageTight(void){
+uint32_t FS65_SendBatch(const uint32_t* p_cmd, uint16_t* p_response, uint32_t nbCmd){
+    uint16_t txWords[FS65_BATCH_MAX];
+    Status_32B_tag status;
+    uint32_t stockPriority = 0;
+    uint32_t errorCode = FS65_RETURN_OK;
+    uint32_t received = 0;
+    uint32_t first = 0;
+    uint32_t count = 0;
+    uint32_t i = 0;
+    uint32_t token = 0;
+
+    if(nbCmd > FS65_BATCH_MAX){
+	return FS65_RETURN_ERROR;
+    }
+    for(i = 0; i < nbCmd; i++){
+	if(p_cmd[i] & 0x8000){
+	    txWords[i] = (uint16_t)p_cmd[i];
+	    if(p_cmd[i] & FS65_BATCH_SECURE){
+		txWords[i] = (uint16_t)FS65_ComputeSecurityBits(txWords[i]);
+	    }
+	    txWords[i] = (uint16_t)FS65_ComputeParity(txWords[i]);
+	}
+	else{
+	    txWords[i] = (uint16_t)(p_cmd[i] & 0x7E00);				//read command, parity bit 0
+	}
+    }
+
+    for(first = 0; first < nbCmd; first += count){
+	count = ((nbCmd - first) < FS65_BATCH_CHUNK) ? (nbCmd - first) : FS65_BATCH_CHUNK;
+	stockPriority = INTC_0.CPR0.B.PRI;			//save current priority
+	INTC_0.CPR0.B.PRI = INT_CEIL_PRIORITY;		//block DSPI resource
+	SPITRACE_SITE();							//frames recorded with the caller address
+
+	received = DSPI_SendBatch(DSPI_NB, DSPI_CS, &txWords[first], &p_response[first], count);
+	token = SEQ_WriteBegin(&FS65_RegistersLock);
+	for(i = first; i < first + received; i++){
+	    FS65_StoreRegister((txWords[i] & 0x7E00) >> 9, p_response[i]);
+	    status.R = p_response[i] >> 8;
+	    if(status.B.SPI_G == 1){
+		errorCode = FS65_RETURN_ERROR;							//error -> SPI_G error
+	    }
+	}
+	if(received != 0){
+	    i = first + received - 1;
+	    SPIstruct.writeCmd = (txWords[i] & 0x8000) ? txWords[i] : 0;
+	    SPIstruct.readCmd = txWords[i] & 0x7E00;
+	    SPIstruct.response = p_response[i];
+	    SPIstruct.statusPwSBC.R = SPIstruct.response >> 8;
+	}
+	SEQ_WriteEnd(&FS65_RegistersLock, token);
+	INTC_0.CPR0.B.PRI = stockPriority;			//release DSPI resource, higher priorities served between the chunks
+	if(received != count){
+	    return FS65_RETURN_ERROR;									//error -> no answer on SPI
+	}
+    }
+    return errorCode;
+}
+
+/*******************************************************************************
+ *   @brief The function FS65_SnapshotRegisters copies the last received registers.
+ *	@par Include
+ *					FS65xx.h
+ * 	@par Description
+ *					INTstruct and SPIstruct.statusPwSBC are copied together
+ *					under FS65_RegistersLock: the copy shows the registers and
+ *					the status of the same SPI exchanges, without raising the
+ *					priority.
+ * 	@param[out] p_registers - Copy of INTstruct.
+ * 	@param[out] p_status - Copy of the general status (0 - not needed).
+ * 	@return 	SEQ_OK / SEQ_BUSY (copy not consistent, see SEQ_Read).
+ *	@remarks 	For a group of registers, SEQ_Read can be used directly:
+ *				SEQ_Read(&FS65_RegistersLock, &INTstruct.DIAG_VPRE, &diag, 5 * 4);
+ *				copies DIAG_VPRE to DIAG_VSUP_VCAN.
+ *	@par Code sample
+ *			if(FS65_SnapshotRegisters(&registers, &status) == SEQ_OK){
+ *				...
+ *			}
+ ********************************************************************************/
+uint32_t FS65_SnapshotRegisters(struct FS65_INT_tag *p_registers, Status_32B_tag *p_status){
+    const vuint32_t *p_src = (const vuint32_t *)&INTstruct;
+    uint32_t *p_dst = (uint32_t *)p_registers;
+    uint32_t sequence = 0;
+    uint32_t status = 0;
+    uint32_t retry = 0;
+    uint32_t i = 0;
+
+    for(retry = 0; retry < SEQ_RETRIES; retry++){
+	sequence = SEQ_ReadBegin(&FS65_RegistersLock);
+	for(i = 0; i < sizeof(INTstruct) / 4; i++){
+	    p_dst[i] = p_src[i];
+	}
+	status = SPIstruct.statusPwSBC.R;
+	if(SEQ_ReadValid(&FS65_RegistersLock, sequence) != 0){
+	    if(p_status != 0){
+		p_status->R = status;
+	    }
+	    return SEQ_OK;
+	}
+    }
+    return SEQ_BUSY;
+}
+
+/*******************************************************************************
+ *   @brief The function FS65_SnapshotVoltages copies the last sampled voltages.
+ *	@par Include
+ *					FS65xx.h
+ * 	@par Description
+ *					ADCstruct.actualVoltage is copied under FS65_VoltagesLock.
+ * 	@param[out] p_voltages - Copy of ADCstruct.actualVoltage.
+ * 	@return 	SEQ_OK / SEQ_BUSY (copy not consistent, see SEQ_Read).
+ *	@par Code sample
+ *			FS65_SnapshotVoltages(&voltages);
+ ********************************************************************************/
+uint32_t FS65_SnapshotVoltages(struct FS65_Voltage_tag *p_voltages){
+    return SEQ_Read(&FS65_VoltagesLock, &ADCstruct.actualVoltage, p_voltages, sizeof(*p_voltages));
+}
+
+/******************************************************************************!
+ *   @brief The function FS65_ConvertADC recomputes an ADC result into a voltage.
+ *	@par Include
+ *					FS65xx.h
+ * 	@par Description
+ *					Common computation of FS65_GetVoltage, FS65_GetVoltageTight,
+ *					FS65_GetVoltageWide and of the deferred ADC work:
+ *					(Vcca/ADC_RESOLUTION)*x*ratio, see FS65_GetVoltageTight.
+ * 	@param[in] x - ADC result.
+ * 	@param[in] ratio33 - AMUX divider ratio for Vcca = 3.3 V.
+ * 	@param[in] ratio5 - AMUX divider ratio for Vcca = 5 V.
+ * 	@return 	Voltage [V].
+ ********************************************************************************/
+static double FS65_ConvertADC(uint32_t x, double ratio33, double ratio5){
     double voltage = 0;
-    uint32_t x;
 #ifdef ADC_SOURCE_CALIB
     float treshold = 4.15;
 #endif
 
-    x = ADC_GetChannelValue(ADC_NB, ADC_CH);
 #ifdef ADC_SOURCE_CALIB																	//reference voltage for ADC is stored in ADC_SOURCE_CALIB
     voltage = (ADC_SOURCE_CALIB / ADC_RESOLUTION) * x;
     if(ADC_SOURCE_CALIB < treshold){													//choose between 3.3V and 5V ratio for computations
-	voltage *= VAMUX_TG_33;
+	voltage *= ratio33;
     }
     else{
-	voltage *= VAMUX_TG_5;
+	voltage *= ratio5;
     }
 #else																										//reference voltage is set to Vcca
     if(INTstruct.HW_CONFIG.B.VCCA_HW == 0){							//choose between 3.3V and 5V used as Vcca
 	voltage = (3.3 / ADC_RESOLUTION) * x;
-	voltage *= VAMUX_TG_33;
+	voltage *= ratio33;
     }
     else{
 	voltage = (5.0 / ADC_RESOLUTION) * x;
-	voltage *= VAMUX_TG_5;
+	voltage *= ratio5;
     }
 #endif
 
-    return (float)voltage;
+    return voltage;
+}
+
+/******************************************************************************!
+ *   @brief The function FS65_ConvertTemperature recomputes an ADC result into a temperature.
+ *	@par Include
+ *					FS65xx.h
+ * 	@param[in] x - ADC result.
+ * 	@return 	Temperature in degrees of Celsius, see FS65_GetTemperature.
+ ********************************************************************************/
+static double FS65_ConvertTemperature(uint32_t x){
+    double voltage = FS65_ConvertADC(x, 1.0, 1.0);
+
+    // Temperature computations from input voltage:
+    // temp				temperature in degrees of Celsius
+    // VAMUX_TP_0		nominal voltage at 0 degrees of Celsius
+    // VAMUX_TP_CO		coefficient in mV/degrees of Celsius
+
+    return ((voltage * 1000) - VAMUX_TP_0)/VAMUX_TP_CO;
+}
+
+/******************************************************************************!
+ *   @brief The function FS65_GetVoltageTight reads a value from the ADC and recomputes it into a voltage considering
+ *			a tight voltage range ratio.
+ *	@par Include
+ *					PwSBC.h
+ * 	@par Description
+ *					This function reads value from ADC and recomputes it into voltage
+ *					considering tight voltage range ratio.
+ * 	@return 	Voltage [V] that was measured on the active AMUX channel.
+ *				The returned value is computed as follows:
+ *				(Vcca/ADC_RESOLUTION)*x*VAMUX_TG_X, where:
+ *				- Vcca - if the parameter ADC_SOURCE_CALIB is defined in
+ *				the global defines, then its value is used as a Vcca. If this
+ *				parameter is not defined, then either 3.3 or 5.0 V is used
+ *				instead depending on the Vcca_HW bit. This bit is checked and
+ *				the appropriate voltage is chosen automatically by this function.
+ *				- ADC_RESOLUTION - this parameter is defined in the global
+ *				defines. By default for the MPC5744P the 12-bit ADC is used,
+ *				so the number (2^12)-1 = 4095 corresponds to this parameter.
+ *				- x - number obtained from ADC in the 12-bit range (value from
+ *				0 till 4095)
+ *				- VAMUX_TG_X - divider ration tight input voltage range.
+ *				(VAMUX_TG_X = 2 for Vcca = 5 V; VAMUX_TG_X = 3 for Vcca = 3.3 V)
+ *	@remarks 	This function works only when the tight range is being used.
+ *				This range allows to measure voltages from 2 till 10 V. If
+ *				a wider range is necessary, then FS65_GetVoltageWide should be
+ *				used instead.
+ *				- Example of computations (Vcca = 3.3 V, ADC_SOURCE_CALIB is not
+ *				defined, ADC_RESOLUTION = 4095 by default, VAMUX_TG_X = 3,
+ *				x = 1089):	(3.3/4095)*1089*3 = 2.63V
+ *	@par Code sample
+ *													</para>
+ *			float voltage;							</para>
+ *			voltage = FS65_GetVoltageTight();		</para>
+ *			- This function reads value from ADC (depending on actual AMUX channel)
+ *			and returns value as a voltage [V].
+ ********************************************************************************/
+float FS65_GetVoltageTight(void){
+    return (float)FS65_ConvertADC(ADC_GetChannelValue(ADC_NB, ADC_CH), VAMUX_TG_33, VAMUX_TG_5);
 }
 
 /******************************************************************************!
@@ -3649,33 +4269,7 @@ float FS65_GetVoltageTight(void){
  *			and returns value as a voltage [V].
  ********************************************************************************/
 float FS65_GetVoltageWide(void){
-    double voltage = 0;
-    uint32_t x;
-#ifdef ADC_SOURCE_CALIB
-    float treshold = 4.15;
-#endif
-
-    x = ADC_GetChannelValue(ADC_NB, ADC_CH);
-#ifdef ADC_SOURCE_CALIB																	//reference voltage for ADC is stored in ADC_SOURCE_CALIB
-    voltage = (ADC_SOURCE_CALIB / ADC_RESOLUTION) * x;
-    if(ADC_SOURCE_CALIB < treshold){													//choose between 3.3V and 5V ratio for computations
-	voltage *= VAMUX_WD_33;
-    }
-    else{
-	voltage *= VAMUX_WD_5;
-    }
-#else																										//reference voltage is set to Vcca
-    if(INTstruct.HW_CONFIG.B.VCCA_HW == 0){							//choose between 3.3V and 5V used as Vcca
-	voltage = (3.3 / ADC_RESOLUTION) * x;
-	voltage *= VAMUX_WD_33;
-    }
-    else{
-	voltage = (5.0 / ADC_RESOLUTION) * x;
-	voltage *= VAMUX_WD_5;
-    }
-#endif
-
-    return (float)voltage;
+    return (float)FS65_ConvertADC(ADC_GetChannelValue(ADC_NB, ADC_CH), VAMUX_WD_33, VAMUX_WD_5);
 }
 
 /******************************************************************************!
@@ -3714,22 +4308,7 @@ float FS65_GetVoltageWide(void){
  *			- This function reads value from ADC and returns value as a voltage [V].
  ********************************************************************************/
 float FS65_GetVoltage(void){
-    double voltage = 0;
-    uint32_t x;
-
-    x = ADC_GetChannelValue(ADC_NB, ADC_CH);
-#ifdef ADC_SOURCE_CALIB																	//reference voltage for ADC is stored in ADC_SOURCE_CALIB
-    voltage = (ADC_SOURCE_CALIB / ADC_RESOLUTION) * x;
-#else																										//reference voltage is set to Vcca
-    if(INTstruct.HW_CONFIG.B.VCCA_HW == 0){							//choose between 3.3V and 5V used as Vcca
-	voltage = (3.3 / ADC_RESOLUTION) * x;
-    }
-    else{
-	voltage = (5.0 / ADC_RESOLUTION) * x;
-    }
-#endif
-
-    return (float)voltage;
+    return (float)FS65_ConvertADC(ADC_GetChannelValue(ADC_NB, ADC_CH), 1.0, 1.0);
 }
 
 /******************************************************************************!
@@ -3762,30 +4341,7 @@ float FS65_GetVoltage(void){
  *			- This function reads value from ADC and returns it as a die temperature.
  ********************************************************************************/
 float FS65_GetTemperature(void){
-    double voltage = 0;
-    double temp = 0;
-    uint32_t x;
-
-    x = ADC_GetChannelValue(ADC_NB, ADC_CH);
-#ifdef ADC_SOURCE_CALIB																	//reference voltage for ADC is stored in ADC_SOURCE_CALIB
-    voltage = (ADC_SOURCE_CALIB / ADC_RESOLUTION) * x;
-#else																										//reference voltage is set to Vcca
-    if(INTstruct.HW_CONFIG.B.VCCA_HW == 0){							//choose between 3.3V and 5V used as Vcca
-	voltage = (3.3 / ADC_RESOLUTION) * x;
-    }
-    else{
-	voltage = (5.0 / ADC_RESOLUTION) * x;
-    }
-#endif
-
-    // Temperature computations from input voltage:
-    // temp				temperature in degrees of Celsius
-    // VAMUX_TP_0		nominal voltage at 0 degrees of Celsius
-    // VAMUX_TP_CO		coefficient in mV/degrees of Celsius
-
-    temp = ((voltage * 1000) - VAMUX_TP_0)/VAMUX_TP_CO;
-
-    return (float)temp;
+    return (float)FS65_ConvertTemperature(ADC_GetChannelValue(ADC_NB, ADC_CH));
 }
 
 
@@ -3795,6 +4351,29 @@ float FS65_GetTemperature(void){
 /*==================================================================================================*/
 
 
+/*******************************************************************************
+ *   @brief The function FS65_DeferWD is the deferred part of FS65_IsrPIT_WD.
+ *	@par Include
+ *					FS65xx.h
+ * 	@par Description
+ *					Refreshes the error and WD counters and releases the FS0B
+ *					and FS1B outputs after the 7th good WD refresh.
+ * 	@param[in] nbWDrefresh - Number of WD refreshes done by FS65_IsrPIT_WD.
+ *	@remarks 	Run by DEFER_IsrSoftware (DEFER_NORMAL queue).
+ ********************************************************************************/
+static void FS65_DeferWD(uint32_t nbWDrefresh){
+    static uint32_t FSOUTreleased = 0;
+
+    FS65_UpdateRegisterContent(DIAG_SF_ERR_ADR);				//refresh ERR counter
+    FS65_UpdateRegisterContent(DIAG_SF_ERR_ADR);				//refresh ERR counter
+    FS65_UpdateRegisterContent(WD_COUNTER_ADR);					//refresh WD counter
+
+    if((FSOUTreleased == 0) & (nbWDrefresh >= 7)){
+	  FSOUTreleased = 1;
+	  FS65_ReleaseFS0andFS1out();
+    }
+}
+
 /*---------------------------------------------------------------------------\
  * PIT interruption service routine for WD refresh called by a TIF flag
  \****************************************************************************/
@@ -3811,7 +4390,8 @@ float FS65_GetTemperature(void){
  *					If WD is refreshed without any error, function clears PIT
  *					interrupt flag and ends. If any error occurs, error strategy
  *					will be used reach a successfulWD refresh (see ALGORITHMS
- *					for details).
+ *					for details). The counter reads and the FS0B/FS1B release
+ *					are deferred to FS65_DeferWD.
  *	@remarks 	PIT channel used for periodical WD refresh is defined in global
  *				defines as a PIT_WD_CH. This function shall be registered as
  *				an interrupt service routine for specified interrupt vector with
@@ -3826,7 +4406,6 @@ float FS65_GetTemperature(void){
 void FS65_IsrPIT_WD(void){
 
     static uint32_t nbWDrefresh = 0;
-    static uint32_t FSOUTreleased = 0;
 
     nbWDrefresh++;
 
@@ -3838,14 +4417,7 @@ void FS65_IsrPIT_WD(void){
     PITstruct.WD_answer = FS65_ComputeLFSR(INTstruct.WD_LFSR.R);
     FS65_RefreshWD(PITstruct.WD_answer);
 
-    FS65_UpdateRegisterContent(DIAG_SF_ERR_ADR);				//refresh ERR counter
-    FS65_UpdateRegisterContent(DIAG_SF_ERR_ADR);				//refresh ERR counter
-    FS65_UpdateRegisterContent(WD_COUNTER_ADR);					//refresh WD counter
-
-    if((FSOUTreleased == 0) & (nbWDrefresh >= 7)){
-	  FSOUTreleased = 1;
-	  FS65_ReleaseFS0andFS1out();
-    }
+    (void)DEFER_Post(DEFER_NORMAL, FS65_DeferWD, nbWDrefresh);	//counters and FSxB release
 
     if(ADCstruct.scanVoltage.R > 0){
 	ADC_StartNormalConversion(ADC_NB, ADC_MASK);				//start new ADC conversion if required by scanVoltage mask
@@ -3854,39 +4426,111 @@ void FS65_IsrPIT_WD(void){
     PIT_ClearFlag(PIT_WD_CH);		//clear interrupt TIF flag
 }
 
-/*****************************************************************************\
- * EXTernal pin interruption service routine called by RFDF flag
- \****************************************************************************/
+/*******************************************************************************
+ *   @brief The function FS65_RecordLatency records the latency of a callback.
+ *	@par Include
+ *					FS65xx.h
+ * 	@par Description
+ *					Called by FS65_IsrSIUL just before a user callback. The time
+ *					elapsed since the entry of the interrupt routine is added
+ *					to the histogram of the event (log2 buckets).
+ * 	@param[in] event - FS65_EVENT_xxx.
+ * 	@param[in] entry - Lower word of the time base at the entry of FS65_IsrSIUL.
+ ********************************************************************************/
+static void FS65_RecordLatency(uint32_t event, uint32_t entry){
+    FS65_Latency_struct *p_latency = &FS65_Latency[event];
+    uint32_t ticks = TIME_ReadLow() - entry;
+    uint32_t scaled = ticks >> FS65_LATENCY_BASE_LOG2;
+    uint32_t bucket = 0;
+
+    if(scaled != 0){
+	bucket = 32 - __builtin_clz(scaled);
+	if(bucket >= FS65_LATENCY_BUCKETS){
+	    bucket = FS65_LATENCY_BUCKETS - 1;
+	}
+    }
+    p_latency->bucket[bucket]++;
+    p_latency->count++;
+    p_latency->lastTicks = ticks;
+    if(ticks > p_latency->maxTicks){
+	p_latency->maxTicks = ticks;
+    }
+}
 
 /*******************************************************************************
- *   @brief The function FS65xx_IsrSIUL is an SIUL external interrupt service routine.
+ *   @brief The function FS65_GetLatency reads the latency histogram of an event.
  *	@par Include
  *					FS65xx.h
  * 	@par Description
- *					This function is an interrupt service routine for external event
- *					handling. This function reads general status register and looks
- *					for the interrupt source. If the an active interrupt flag
- *					in the FS65xx has been found, function calls appropriate
- *					event handler.
- *	@remarks 	Input that is being used for external interrupt handling is
- *				defined by parameter SIUL_INT_EIRQ. This function shall be registered
- *				as an interrupt service routine for specified interrupt vector
- *				with specified priority (parameter INT_SIUL_PRIORITY in the
- *				global defines).
+ *					The histogram is copied with the current priority raised
+ *					to INT_SIUL_PRIORITY, so the copy is consistent while the
+ *					interrupts keep running.
+ * 	@param[in] event - FS65_EVENT_xxx.
+ * 	@param[out] p_latency - Copy of the histogram.
+ *	@remarks 	The latency is counted from the entry of FS65_IsrSIUL; the
+ *				delay between the INTb edge and this entry (interrupt latency,
+ *				preemption by higher priorities) is not included.
  *	@par Code sample
- *			INTC_InstallINTCInterruptHandler(FS65xx_IsrSIUL,41, INT_SIUL_PRIORITY);
- *			- This function registers FS65xx_IsrSIUL interrupt routine with interrupt
- *			vector no. 41 (corresponds to EIRQ no. 7) and priority defined by
- *			parameter INT_SIUL_PRIORITY (placed in global defines).
+ *			FS65_GetLatency(FS65_EVENT_CAN_G, &latency);
+ *			us = TIME_TicksToUs(latency.maxTicks);
  ********************************************************************************/
-void FS65_IsrSIUL(void){
+void FS65_GetLatency(uint32_t event, FS65_Latency_struct *p_latency){
+    uint32_t stockPriority = INTC_0.CPR0.B.PRI;
+
+    if(stockPriority < INT_SIUL_PRIORITY){
+	INTC_0.CPR0.B.PRI = INT_SIUL_PRIORITY;		//block FS65_IsrSIUL
+    }
+    *p_latency = FS65_Latency[event];
+    INTC_0.CPR0.B.PRI = stockPriority;
+}
+
+/*******************************************************************************
+ *   @brief The function FS65_ClearLatency clears the latency histograms.
+ *	@par Include
+ *					FS65xx.h
+ *	@par Code sample
+ *			FS65_ClearLatency();
+ ********************************************************************************/
+void FS65_ClearLatency(void){
+    uint32_t stockPriority = INTC_0.CPR0.B.PRI;
+    uint32_t event;
+    uint32_t i;
+
+    if(stockPriority < INT_SIUL_PRIORITY){
+	INTC_0.CPR0.B.PRI = INT_SIUL_PRIORITY;		//block FS65_IsrSIUL
+    }
+    for(event = 0; event < FS65_EVENT_NB; event++){
+	FS65_Latency[event].count = 0;
+	FS65_Latency[event].lastTicks = 0;
+	FS65_Latency[event].maxTicks = 0;
+	for(i = 0; i < FS65_LATENCY_BUCKETS; i++){
+	    FS65_Latency[event].bucket[i] = 0;
+	}
+    }
+    INTC_0.CPR0.B.PRI = stockPriority;
+}
 
+/*******************************************************************************
+ *   @brief The function FS65_DeferSIUL is the deferred part of FS65_IsrSIUL.
+ *	@par Include
+ *					FS65xx.h
+ * 	@par Description
+ *					Reads the general status register, looks for the interrupt
+ *					sources, reads their diagnostic registers and calls the
+ *					appropriate event handlers. The latency from the entry of
+ *					FS65_IsrSIUL to each event handler is recorded in
+ *					FS65_Latency.
+ * 	@param[in] entry - Lower word of the time base at the entry of FS65_IsrSIUL.
+ *	@remarks 	Run by DEFER_IsrSoftware (DEFER_HIGH queue).
+ ********************************************************************************/
+static void FS65_DeferSIUL(uint32_t entry){
 // Any get function to update FS65xx status field
     FS65_UpdateRegisterContent(INIT_VREG_ADR);
 
 // check SPI_G event
     if(SPIstruct.statusPwSBC.B.SPI_G == 1){
 	FS65_UpdateRegisterContent(DIAG_SPI_ADR);
+	FS65_RecordLatency(FS65_EVENT_SPI_G, entry);
 	FS65_SPI_INT_Callback();
     }
 
@@ -3896,12 +4540,15 @@ void FS65_IsrSIUL(void){
 	if (INTstruct.WU_SOURCE.B.PHY_WU == 1){		//event in the physical layer of the CAN or LIN bus
 	    FS65_UpdateRegisterContent(DIAG_CAN_FD_ADR);
 	    FS65_UpdateRegisterContent(DIAG_CAN_LIN_ADR);
+	    FS65_RecordLatency(FS65_EVENT_WU, entry);
 	    FS65_PHYWU_INT_Callback();
         }
 	if (INTstruct.WU_SOURCE.B.AUTO_WU == 1){	//auto-wake up
+		FS65_RecordLatency(FS65_EVENT_WU, entry);
 		FS65_AutoWU_INT_Callback();
         }
 	if (INTstruct.WU_SOURCE.B.LDT_WU == 1){		//LDT-wake up
+		FS65_RecordLatency(FS65_EVENT_WU, entry);
 		FS65_LDTWU_INT_Callback();
         }
     }
@@ -3910,6 +4557,7 @@ void FS65_IsrSIUL(void){
     if(SPIstruct.statusPwSBC.B.CAN_G == 1){
 	FS65_UpdateRegisterContent(DIAG_CAN_FD_ADR);
 	FS65_UpdateRegisterContent(DIAG_CAN_LIN_ADR);
+	FS65_RecordLatency(FS65_EVENT_CAN_G, entry);
 	FS65_CAN_INT_Callback();
 
     }
@@ -3917,6 +4565,7 @@ void FS65_IsrSIUL(void){
 // check LIN_G event
     if(SPIstruct.statusPwSBC.B.LIN_G == 1){
 	FS65_UpdateRegisterContent(DIAG_CAN_LIN_ADR);
+	FS65_RecordLatency(FS65_EVENT_LIN_G, entry);
 	FS65_LIN_INT_Callback();
     }
 
@@ -3924,18 +4573,21 @@ void FS65_IsrSIUL(void){
     if(SPIstruct.statusPwSBC.B.IO_G == 1){
 	FS65_UpdateRegisterContent(IO_INPUT_ADR);
 	//write your code there...
+	FS65_RecordLatency(FS65_EVENT_IO_G, entry);
 	FS65_IO_INT_Callback();
     }
 
 // check Vpre_G event
     if(SPIstruct.statusPwSBC.B.Vpre_G == 1){
 	FS65_UpdateRegisterContent(DIAG_VPRE_ADR);
+	FS65_RecordLatency(FS65_EVENT_Vpre_G, entry);
 	FS65_VPRE_INT_Callback();
     }
 
 // check Vcore_G event
     if(SPIstruct.statusPwSBC.B.Vcore_G == 1){
 	FS65_UpdateRegisterContent(DIAG_VCORE_ADR);
+	FS65_RecordLatency(FS65_EVENT_Vcore_G, entry);
 	FS65_VCORE_INT_Callback();
     }
 
@@ -3944,60 +4596,84 @@ void FS65_IsrSIUL(void){
 	FS65_UpdateRegisterContent(DIAG_VCCA_ADR);
 	FS65_UpdateRegisterContent(DIAG_VAUX_ADR);
 	FS65_UpdateRegisterContent(DIAG_VSUP_VCAN_ADR);
+	FS65_RecordLatency(FS65_EVENT_Vothers_G, entry);
 	FS65_VXXX_INT_Callback();
     }
-
-    SIUL_ClearExtIntFlag(SIUL_INT_EIRQ);											//clear interrupt EIF flag
 }
 
-
-/*---------------------------------------------------------------------------\
- * ADC interruption service routine called by EOC flag
+/*****************************************************************************\
+ * EXTernal pin interruption service routine called by RFDF flag
  \****************************************************************************/
 
-/***************************************************************************
- *   @brief The function FS65xx_IsrADC si an ADC interrupt service routine.
+/*******************************************************************************
+ *   @brief The function FS65xx_IsrSIUL is an SIUL external interrupt service routine.
  *	@par Include
  *					FS65xx.h
  * 	@par Description
- *					This function is an interrupt service routine to process results
- *					from AD conversions (called with every end of conversion).
- *					Depending on the active AMUX channel, function treats ADC
- *					results and stores them in the global structures. Then AMUX
- *					channel is switched and function ends (for details see
- *					ALGORITHMS).
- *	@remarks 	ADC module that is being used for ADC conversions is defined by
- *				ADC_NB parameter in global defines. Priority of the ADC interrupt
- *				is defined by INT_ADC_PRIORITY parameter.
+ *					This function is an interrupt service routine for external event
+ *					handling. It clears the interrupt flag and posts the event
+ *					handling (FS65_DeferSIUL) with its entry time. The general
+ *					status register is read, the interrupt sources are looked for
+ *					and the event handlers are called by the deferred work. If the
+ *					DEFER_HIGH queue is full, the handling is run by this routine
+ *					(below INT_CEIL_PRIORITY, the FS65 functions are allowed).
+ *	@remarks 	Input that is being used for external interrupt handling is
+ *				defined by parameter SIUL_INT_EIRQ. This function shall be registered
+ *				as an interrupt service routine for specified interrupt vector
+ *				with specified priority (parameter INT_SIUL_PRIORITY in the
+ *				global defines).
  *	@par Code sample
- *			INTC_InstallINTCInterruptHandler(FS65xx_IsrADC,(62 + 20*ADC_NB),
- *				INT_ADC_PRIORITY);
- *			- This function registers FS65xx_IsrADC function as an interrupt service
- *			routine for interrupt vector no. 62 (corresponds to the end of
- *			conversion event for ADC module no. 0) with priority
- *			INT_ADC_PRIORITY.
+ *			INTC_InstallINTCInterruptHandler(FS65xx_IsrSIUL,41, INT_SIUL_PRIORITY);
+ *			- This function registers FS65xx_IsrSIUL interrupt routine with interrupt
+ *			vector no. 41 (corresponds to EIRQ no. 7) and priority defined by
+ *			parameter INT_SIUL_PRIORITY (placed in global defines).
  ********************************************************************************/
-void FS65_IsrADC(void){
-    uint8_t actualCH = 0;
+void FS65_IsrSIUL(void){
+    uint32_t entry = TIME_ReadLow();
+
+    SIUL_ClearExtIntFlag(SIUL_INT_EIRQ);											//clear interrupt EIF flag, an edge during the handling is kept
+    if (DEFER_Post(DEFER_HIGH, FS65_DeferSIUL, entry) != DEFER_OK){
+	FS65_DeferSIUL(entry);														//queue full: handled here, the event is not lost
+    }
+}
+
+
+/*******************************************************************************
+ *   @brief The function FS65_DeferADC is the deferred part of FS65_IsrADC.
+ *	@par Include
+ *					FS65xx.h
+ * 	@par Description
+ *					Recomputes the ADC result of the AMUX channel and stores it
+ *					in the global structures. Then AMUX is switched to the next
+ *					masked channel (for details see ALGORITHMS).
+ * 	@param[in] sample - AMUX channel (bits 16 - 23) and ADC result (bits 0 - 15).
+ *	@remarks 	Run by DEFER_IsrSoftware (DEFER_LOW queue). The next conversion
+ *				is started by FS65_IsrPIT_WD; until the switch it converts the
+ *				same AMUX channel again.
+ ********************************************************************************/
+static void FS65_DeferADC(uint32_t sample){
+    uint8_t actualCH = (uint8_t)(sample >> 16);
+    uint32_t x = sample & 0xFFFF;
     uint8_t nbAMUX = 0;
     uint8_t mask = 0;
     uint8_t i = 0;
-
-    actualCH = (uint8_t)INTstruct.IO_OUT_AMUX.B.AMUX;				//actual channel used by ADC
+    uint32_t token = 0;
 
 /* store actual channel to the structure */
+    token = SEQ_WriteBegin(&FS65_VoltagesLock);
     switch(actualCH){
-	case	AMUX_VREF	:	ADCstruct.actualVoltage.Vref = FS65_GetVoltage(); break;
-	case	AMUX_VSNS_WIDE	:	ADCstruct.actualVoltage.VsnsW = FS65_GetVoltageWide(); break;
-	case	AMUX_IO0_WIDE	:	ADCstruct.actualVoltage.IO0W = FS65_GetVoltageWide(); break;
-	case	AMUX_IO5_WIDE	:	ADCstruct.actualVoltage.IO5W = FS65_GetVoltageWide(); break;
-	case	AMUX_VSNS_TIGHT	:	ADCstruct.actualVoltage.VsnsT = FS65_GetVoltageTight(); break;
-	case	AMUX_IO0_TIGHT	: 	ADCstruct.actualVoltage.IO0T = FS65_GetVoltageTight(); break;
-	case	AMUX_IO5_TIGHT	: 	ADCstruct.actualVoltage.IO5T = FS65_GetVoltageTight(); break;
-	case	AMUX_TEMP	: 	ADCstruct.actualVoltage.Temp = FS65_GetTemperature(); break;
-    }
-
-/* switch AMUX to the following masked channel and start next conversion */
+	case	AMUX_VREF	:	ADCstruct.actualVoltage.Vref = (float)FS65_ConvertADC(x, 1.0, 1.0); break;
+	case	AMUX_VSNS_WIDE	:	ADCstruct.actualVoltage.VsnsW = (float)FS65_ConvertADC(x, VAMUX_WD_33, VAMUX_WD_5); break;
+	case	AMUX_IO0_WIDE	:	ADCstruct.actualVoltage.IO0W = (float)FS65_ConvertADC(x, VAMUX_WD_33, VAMUX_WD_5); break;
+	case	AMUX_IO5_WIDE	:	ADCstruct.actualVoltage.IO5W = (float)FS65_ConvertADC(x, VAMUX_WD_33, VAMUX_WD_5); break;
+	case	AMUX_VSNS_TIGHT	:	ADCstruct.actualVoltage.VsnsT = (float)FS65_ConvertADC(x, VAMUX_TG_33, VAMUX_TG_5); break;
+	case	AMUX_IO0_TIGHT	: 	ADCstruct.actualVoltage.IO0T = (float)FS65_ConvertADC(x, VAMUX_TG_33, VAMUX_TG_5); break;
+	case	AMUX_IO5_TIGHT	: 	ADCstruct.actualVoltage.IO5T = (float)FS65_ConvertADC(x, VAMUX_TG_33, VAMUX_TG_5); break;
+	case	AMUX_TEMP	: 	ADCstruct.actualVoltage.Temp = (float)FS65_ConvertTemperature(x); break;
+    }
+    SEQ_WriteEnd(&FS65_VoltagesLock, token);
+
+/* switch AMUX to the following masked channel */
     nbAMUX = actualCH;
 
     for(i = 0;i < 8;i++){
@@ -4013,9 +4689,38 @@ void FS65_IsrADC(void){
 	    break;
 	  }
     }
+}
 
-    ADC_ClearAllEOCflags(ADC_NB);										//clear EOC flags
+/*---------------------------------------------------------------------------\
+ * ADC interruption service routine called by EOC flag
+ \****************************************************************************/
 
+/***************************************************************************
+ *   @brief The function FS65xx_IsrADC si an ADC interrupt service routine.
+ *	@par Include
+ *					FS65xx.h
+ * 	@par Description
+ *					This function is an interrupt service routine to process results
+ *					from AD conversions (called with every end of conversion).
+ *					The ADC result and the active AMUX channel are posted to
+ *					FS65_DeferADC, which stores the voltage in the global
+ *					structures and switches the AMUX channel.
+ *	@remarks 	ADC module that is being used for ADC conversions is defined by
+ *				ADC_NB parameter in global defines. Priority of the ADC interrupt
+ *				is defined by INT_ADC_PRIORITY parameter.
+ *	@par Code sample
+ *			INTC_InstallINTCInterruptHandler(FS65xx_IsrADC,(62 + 20*ADC_NB),
+ *				INT_ADC_PRIORITY);
+ *			- This function registers FS65xx_IsrADC function as an interrupt service
+ *			routine for interrupt vector no. 62 (corresponds to the end of
+ *			conversion event for ADC module no. 0) with priority
+ *			INT_ADC_PRIORITY.
+ ********************************************************************************/
+void FS65_IsrADC(void){
+    uint32_t actualCH = INTstruct.IO_OUT_AMUX.B.AMUX;				//actual channel used by ADC
+
+    (void)DEFER_Post(DEFER_LOW, FS65_DeferADC, (actualCH << 16) | (ADC_GetChannelValue(ADC_NB, ADC_CH) & 0xFFFF));
+    ADC_ClearAllEOCflags(ADC_NB);										//clear EOC flags
 }
 
 
@@ -0,0 +1,649 @@
+/*******************************************************************************
+*
+* Freescale Semiconductor Inc.
+* (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+* ALL RIGHTS RESERVED.
+*
+********************************************************************************
+*
+* $File Name:       GUI.c$
+* @file             GUI.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      GUI link source file
+* @brief            GUI link source file
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/****************************************************************************//*!
+*
+*  @mainpage GUI link for MPC5744P
+*
+*  @section Intro Introduction
+*
+*	This package contains the protocol layer of the UART link between the
+*	FS65xx DEMO and the Graphical User Interface (GUI). Frame and record
+*	formats are described in GUI.h.
+*
+*  The key features of this package are the following:
+*  - COBS framing with CRC-16 of each frame
+*  - Timestamped register-change and measurement records
+*  - Delta encoding (only changed values are sent)
+*
+*  For more information about the functions and configuration items see these documents:
+*
+*******************************************************************************
+*
+* @attention
+*
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : MPC5744P
+*   Dependencies         : MPC5744P - Basic SW drivers.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   GUI_ProcessRequests	  Batched register requests
+BRNY001					      19/10/2026 	   GUI_GetTime	  Time read from the TIME module
+BRNY001					      19/10/2026 	   GUI_Task	  Changes detected on sequence locked snapshots
+BRNY001					      19/10/2026 	   GUI_Task	  Registers compared through register32_struct (host build)
+BRNY001					      19/10/2026 	   GUI_SendSpiTrace	  SPI trace records sent on GUI_CMD_SPI_TRACE
+BRNY001					      19/10/2026 	   GUI_PutTime	  GUI_REC_TIME resets the GUI values (keyframe), sent without changes too
+BRNY001					      19/10/2026 	   GUI_Task	  Measurement delta computed after GUI_BeginRecord (keyframe base)
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#include "MPC5744P_drv.h"
+#include "FS65xx_driver.h"
+#include "LINFLEX.h"
+#include "TIME.h"
+#include "SPITRACE.h"
+#include "GUI.h"
+
+GUI_StreamStruct GUIstream;
+GUI_RequestStruct GUIrequest;
+
+///FS65 register address of each INTstruct item (same order as INTstruct)
+const uint8_t GUI_RegAddress[GUI_REG_NB] = {
+	INIT_VREG_ADR, INIT_WU1_ADR, INIT_WU2_ADR, INIT_INT_ADR, INIT_INH_INT_ADR,
+	LONG_DURATION_TIMER_ADR, HW_CONFIG_ADR, WU_SOURCE_ADR, DEVICE_ID_ADR, IO_INPUT_ADR,
+	DIAG_VPRE_ADR, DIAG_VCORE_ADR, DIAG_VCCA_ADR, DIAG_VAUX_ADR, DIAG_VSUP_VCAN_ADR,
+	DIAG_CAN_FD_ADR, DIAG_CAN_LIN_ADR, DIAG_SPI_ADR, MODE_ADR, REG_MODE_ADR,
+	IO_OUT_AMUX_ADR, CAN_LIN_MODE_ADR, LDT_AFTER_RUN_1_ADR, LDT_AFTER_RUN_2_ADR, LDT_WAKE_UP_1_ADR,
+	LDT_WAKE_UP_2_ADR, LDT_WAKE_UP_3_ADR, INIT_FS1B_TIMING_ADR, BIST_ADR, INIT_SUPERVISOR_ADR,
+	INIT_FAULT_ADR, INIT_FSSM_ADR, INIT_SF_IMPACT_ADR, WD_WINDOW_ADR, WD_LFSR_ADR,
+	WD_ANSWER_ADR, RELEASE_FSxB_ADR, SF_OUTPUT_REQUEST_ADR, INIT_WD_CNT_ADR, DIAG_SF_IOS_ADR,
+	WD_COUNTER_ADR, DIAG_SF_ERR_ADR, INIT_VCORE_OVUV_IMPACT_ADR, INIT_VCCA_OVUV_IMPACT_ADR, INIT_VAUX_OVUV_IMPACT_ADR,
+	DEVICE_ID_FS_ADR
+};
+
+/***************************************************************************//*!
+*   @brief The function GUI_GetTime returns time used for the record timestamps.
+*	@par Include
+*					GUI.h
+* 	@par Description
+*					This function converts the timebase ticks elapsed since
+*					GUI_Init to microseconds.
+*	@return 	Time in microseconds since GUI_Init (wraps after 71 minutes).
+********************************************************************************/
+uint32_t GUI_GetTime(void)
+{
+	return (uint32_t)TIME_TicksToUs(TIME_Read() - GUIstream.start);
+}
+
+/***************************************************************************//*!
+*   @brief The function GUI_ComputeCRC computes CRC-16/CCITT of a buffer.
+*	@par Include
+*					GUI.h
+*	@param[in] p_data -  Pointer to the data.
+*	@param[in] length -  Number of Bytes.
+*	@return 	CRC-16 (polynomial 0x1021, initial value 0xFFFF).
+********************************************************************************/
+uint16_t GUI_ComputeCRC(const uint8_t* p_data, uint32_t length)
+{
+	uint16_t crc = 0xFFFF;
+	uint32_t i;
+	uint8_t bit;
+
+	for (i = 0; i < length; i++)
+	{
+		crc ^= (uint16_t)p_data[i] << 8;
+		for (bit = 0; bit < 8; bit++)
+		{
+			if (crc & 0x8000)
+				crc = (crc << 1) ^ 0x1021;
+			else
+				crc <<= 1;
+		}
+	}
+	return crc;
+}
+
+/***************************************************************************//*!
+*   @brief The function GUI_EncodeCOBS encodes a buffer using Consistent
+*			Overhead Byte Stuffing.
+*	@par Include
+*					GUI.h
+* 	@par Description
+*					This function removes all zero Bytes from the buffer so 0x00
+*					can be used as the frame delimiter. The delimiter is appended.
+*	@param[in] p_src -  Pointer to the data to be encoded.
+*	@param[in] length -  Number of Bytes to be encoded.
+*	@param[out] p_dst -  Destination buffer, at least length + length/254 + 2 Bytes.
+*	@return 	Number of Bytes written into p_dst including the delimiter.
+********************************************************************************/
+uint32_t GUI_EncodeCOBS(const uint8_t* p_src, uint32_t length, uint8_t* p_dst)
+{
+	uint32_t read = 0;
+	uint32_t write = 1;
+	uint32_t codeIndex = 0;
+	uint8_t code = 1;
+
+	while (read < length)
+	{
+		if (p_src[read] == 0)
+		{
+			p_dst[codeIndex] = code;
+			codeIndex = write++;
+			code = 1;
+		}
+		else
+		{
+			p_dst[write++] = p_src[read];
+			code++;
+			if (code == 0xFF)
+			{
+				p_dst[codeIndex] = code;
+				codeIndex = write++;
+				code = 1;
+			}
+		}
+		read++;
+	}
+	p_dst[codeIndex] = code;
+	p_dst[write++] = 0x00;				//frame delimiter
+
+	return write;
+}
+
+/***************************************************************************//*!
+*   @brief The function GUI_PutVarint appends an unsigned LEB128 number.
+*	@param[in] value -  Number to be appended.
+********************************************************************************/
+static void GUI_PutVarint(uint32_t value)
+{
+	while (value >= 0x80)
+	{
+		GUIstream.payload[GUIstream.length++] = (uint8_t)(value | 0x80);
+		value >>= 7;
+	}
+	GUIstream.payload[GUIstream.length++] = (uint8_t)value;
+}
+
+/***************************************************************************//*!
+*   @brief The function GUI_FlushFrame appends CRC, encodes the current frame
+*			and sends it.
+*	@par Include
+*					GUI.h
+* 	@par Description
+*					Frames without records are not sent. If the UART Tx ring
+*					buffer cannot accept the whole frame, the frame is dropped
+*					and a keyframe is requested to resynchronize the GUI.
+********************************************************************************/
+void GUI_FlushFrame(void)
+{
+	uint8_t encoded[GUI_COBS_SIZE];
+	uint32_t length;
+	uint16_t crc;
+
+	if (GUIstream.length <= 1)
+	{
+		return;									//sequence number only
+	}
+	crc = GUI_ComputeCRC(GUIstream.payload, GUIstream.length);
+	GUIstream.payload[GUIstream.length++] = (uint8_t)(crc >> 8);
+	GUIstream.payload[GUIstream.length++] = (uint8_t)crc;
+	length = GUI_EncodeCOBS(GUIstream.payload, GUIstream.length, encoded);
+
+	if (LINFLEX_GetTxFreeUART() >= length)
+	{
+		LINFLEX_WriteUART(LINFLEX_UART_NB, encoded, length);
+		GUIstream.frames++;
+	}
+	else
+	{
+		GUIstream.droppedFrames++;
+		GUI_RequestKeyframe();					//deltas of the lost frame are unknown to the GUI
+	}
+
+	GUIstream.payload[0] = ++GUIstream.sequence;
+	GUIstream.length = 1;
+}
+
+/***************************************************************************//*!
+*   @brief The function GUI_PutTime appends the keyframe time record.
+*	@param[in] now -  Time of the record [us].
+*	@remarks 	The GUI resets its values to zero on this record, the shadows
+*				have to be zero too (see GUI_RequestKeyframe).
+********************************************************************************/
+static void GUI_PutTime(uint32_t now)
+{
+	if (GUIstream.length > (GUI_FRAME_SIZE - 24))
+	{
+		GUI_FlushFrame();
+	}
+	GUIstream.payload[GUIstream.length++] = GUI_REC_TIME;
+	GUI_PutVarint(now);
+	GUIstream.lastTime = now;
+	GUIstream.timeSent = 1;
+	GUIstream.records++;
+}
+
+/***************************************************************************//*!
+*   @brief The function GUI_BeginRecord starts a new record.
+*	@param[in] type -  Record type (GUI_REC_xxx).
+*	@param[in] now -  Time of the record [us].
+*	@remarks 	The frame is flushed first if the longest record would not fit.
+********************************************************************************/
+static void GUI_BeginRecord(uint8_t type, uint32_t now)
+{
+	uint32_t dt;
+
+	if (GUIstream.length > (GUI_FRAME_SIZE - 24))
+	{
+		GUI_FlushFrame();
+	}
+	if (GUIstream.timeSent == 0)
+	{
+		GUI_PutTime(now);
+	}
+	dt = now - GUIstream.lastTime;
+	GUIstream.lastTime = now;
+	GUIstream.payload[GUIstream.length++] = type;
+	GUI_PutVarint(dt);
+	GUIstream.records++;
+}
+
+/***************************************************************************//*!
+*   @brief The function GUI_DecodeCOBS decodes a COBS encoded buffer.
+*	@par Include
+*					GUI.h
+*	@param[in] p_src -  Pointer to the encoded data (without the delimiter).
+*	@param[in] length -  Number of encoded Bytes.
+*	@param[out] p_dst -  Destination buffer, at least length Bytes.
+*	@return 	Number of decoded Bytes, 0 on a format error.
+********************************************************************************/
+uint32_t GUI_DecodeCOBS(const uint8_t* p_src, uint32_t length, uint8_t* p_dst)
+{
+	uint32_t read = 0;
+	uint32_t write = 0;
+	uint8_t code;
+	uint8_t i;
+
+	while (read < length)
+	{
+		code = p_src[read++];
+		if ((code == 0) || ((read + code - 1) > length))
+		{
+			return 0;
+		}
+		for (i = 1; i < code; i++)
+		{
+			p_dst[write++] = p_src[read++];
+		}
+		if ((code != 0xFF) && (read < length))
+		{
+			p_dst[write++] = 0;
+		}
+	}
+	return write;
+}
+
+#if SPITRACE_ENABLE
+/***************************************************************************//*!
+*   @brief The function GUI_SendSpiTrace sends records of the SPI trace.
+* 	@par Description
+*					One GUI_REC_SPI_TRACE record of a dedicated frame with at
+*					most GUI_TRACE_RECORDS records from the record first. The
+*					records are copied without stopping the recorder, the copy
+*					ends at the first record overwritten meanwhile.
+*	@param[in] first -  Number of the first record.
+********************************************************************************/
+static void GUI_SendSpiTrace(uint32_t first)
+{
+	SPITRACE_Record record;
+	uint32_t head = SPITRACEhead;
+	uint32_t countIndex;
+	uint32_t count = 0;
+
+	if ((head - first) > SPITRACE_SIZE)
+	{
+		first = head - SPITRACE_SIZE;				//overwritten, oldest record instead
+	}
+	GUI_BeginRecord(GUI_REC_SPI_TRACE, GUI_GetTime());
+	GUI_PutVarint(head);
+	GUI_PutVarint(first);
+	countIndex = GUIstream.length++;
+	while ((count < GUI_TRACE_RECORDS) && ((first + count) != head)
+			&& (SPITRACE_Copy(first + count, &record) != 0))
+	{
+		SPITRACE_Pack(&record, &GUIstream.payload[GUIstream.length]);
+		GUIstream.length += SPITRACE_RECORD_SIZE;
+		count++;
+	}
+	GUIstream.payload[countIndex] = (uint8_t)count;
+	GUI_FlushFrame();
+}
+#endif
+
+/***************************************************************************//*!
+*   @brief The function GUI_ExecuteRequest executes one decoded request and
+*			sends the response.
+* 	@par Description
+*					All FS65 commands of the request are collected first and
+*					sent in one batch (FS65_SendBatch), the answers are sent in
+*					one GUI_REC_RESPONSE record of a dedicated frame.
+*	@param[in] p_req -  Tag and commands (CRC removed).
+*	@param[in] length -  Number of Bytes.
+********************************************************************************/
+static void GUI_ExecuteRequest(const uint8_t* p_req, uint32_t length)
+{
+	uint32_t cmd[GUI_BATCH_MAX];
+	uint16_t answer[GUI_BATCH_MAX];
+	uint32_t nbCmd = 0;
+	uint32_t read = 1;
+	uint8_t status = GUI_STATUS_OK;
+	uint32_t i;
+#if SPITRACE_ENABLE
+	uint32_t traceRequested = 0;
+	uint32_t traceFirst = 0;
+#endif
+
+	while ((read < length) && (status == GUI_STATUS_OK))
+	{
+		switch (p_req[read++])
+		{
+			case GUI_CMD_READ:
+				if (read >= length)
+					status = GUI_STATUS_FORMAT_ERROR;
+				else if (nbCmd >= GUI_BATCH_MAX)
+					status = GUI_STATUS_TOO_LONG;
+				else
+					cmd[nbCmd++] = (uint32_t)(p_req[read++] & 0x3F) << 9;
+				break;
+
+			case GUI_CMD_WRITE:
+			case GUI_CMD_WRITE_SECURE:
+				if ((read + 1) >= length)
+					status = GUI_STATUS_FORMAT_ERROR;
+				else if (nbCmd >= GUI_BATCH_MAX)
+					status = GUI_STATUS_TOO_LONG;
+				else
+				{
+					cmd[nbCmd] = 0x8000 | ((uint32_t)(p_req[read] & 0x3F) << 9) | p_req[read + 1];
+					if (p_req[read - 1] == GUI_CMD_WRITE_SECURE)
+						cmd[nbCmd] |= FS65_BATCH_SECURE;
+					nbCmd++;
+					read += 2;
+				}
+				break;
+
+			case GUI_CMD_READ_ALL:
+				if ((nbCmd + GUI_REG_NB) > GUI_BATCH_MAX)
+					status = GUI_STATUS_TOO_LONG;
+				else
+				{
+					for (i = 0; i < GUI_REG_NB; i++)
+						cmd[nbCmd++] = (uint32_t)GUI_RegAddress[i] << 9;
+				}
+				break;
+
+			case GUI_CMD_KEYFRAME:
+				GUI_RequestKeyframe();
+				break;
+
+#if SPITRACE_ENABLE
+			case GUI_CMD_SPI_TRACE:
+				if ((read + 3) >= length)
+					status = GUI_STATUS_FORMAT_ERROR;
+				else
+				{
+					traceFirst = ((uint32_t)p_req[read] << 24) | ((uint32_t)p_req[read + 1] << 16)
+							| ((uint32_t)p_req[read + 2] << 8) | p_req[read + 3];
+					traceRequested = 1;
+					read += 4;
+				}
+				break;
+#endif
+
+			default:
+				status = GUI_STATUS_FORMAT_ERROR;
+				break;
+		}
+	}
+
+	if (status != GUI_STATUS_OK)
+	{
+		nbCmd = 0;									//nothing executed
+	}
+	else if (nbCmd != 0)
+	{
+		for (i = 0; i < nbCmd; i++)
+		{
+			answer[i] = 0xFFFF;						//same as no SPI answer
+		}
+		if (FS65_SendBatch(cmd, answer, nbCmd) != FS65_RETURN_OK)
+		{
+			status = GUI_STATUS_SPI_ERROR;
+		}
+	}
+
+	GUI_FlushFrame();								//keep stream records before the response
+	GUI_BeginRecord(GUI_REC_RESPONSE, GUI_GetTime());
+	GUIstream.payload[GUIstream.length++] = p_req[0];
+	GUIstream.payload[GUIstream.length++] = status;
+	GUIstream.payload[GUIstream.length++] = (uint8_t)nbCmd;
+	for (i = 0; i < nbCmd; i++)
+	{
+		GUIstream.payload[GUIstream.length++] = (uint8_t)((cmd[i] >> 9) & 0x3F);
+		GUIstream.payload[GUIstream.length++] = (uint8_t)(answer[i] >> 8);
+		GUIstream.payload[GUIstream.length++] = (uint8_t)answer[i];
+	}
+	GUI_FlushFrame();
+#if SPITRACE_ENABLE
+	if ((status == GUI_STATUS_OK) && (traceRequested != 0))
+	{
+		GUI_SendSpiTrace(traceFirst);
+	}
+#endif
+}
+
+/***************************************************************************//*!
+*   @brief The function GUI_ProcessRequests executes requests received from
+*			the GUI.
+*	@par Include
+*					GUI.h
+* 	@par Description
+*					This function reads the UART Rx ring buffer, splits the
+*					received Bytes on the 0x00 delimiter and executes each
+*					request with a valid CRC. Bytes of an incomplete request
+*					are kept for the next call.
+*	@remarks 	Called by GUI_Task. A response lost because of a full Tx ring
+*				buffer is counted in GUIstream.droppedFrames, the GUI shall
+*				repeat the request (same tag) after a time-out.
+********************************************************************************/
+void GUI_ProcessRequests(void)
+{
+	uint8_t chunk[32];
+	uint8_t decoded[GUI_REQUEST_SIZE];
+	uint32_t count;
+	uint32_t size;
+	uint32_t i;
+
+	while ((count = LINFLEX_ReadRxRing(chunk, sizeof(chunk))) != 0)
+	{
+		for (i = 0; i < count; i++)
+		{
+			if (chunk[i] != 0x00)
+			{
+				if (GUIrequest.length < GUI_REQUEST_SIZE)
+					GUIrequest.frame[GUIrequest.length++] = chunk[i];
+				else
+					GUIrequest.overflow = 1;
+				continue;
+			}
+
+			size = GUIrequest.overflow ? 0 : GUI_DecodeCOBS(GUIrequest.frame, GUIrequest.length, decoded);
+			if ((size < 3) ||
+				(GUI_ComputeCRC(decoded, size - 2) != (uint16_t)((decoded[size - 2] << 8) | decoded[size - 1])))
+			{
+				if (GUIrequest.length != 0)
+					GUIrequest.rejected++;			//empty frames only resynchronize
+			}
+			else
+			{
+				GUIrequest.requests++;
+				GUI_ExecuteRequest(decoded, size - 2);
+			}
+			GUIrequest.length = 0;
+			GUIrequest.overflow = 0;
+		}
+	}
+}
+
+/***************************************************************************//*!
+*   @brief The function GUI_Init initializes the GUI stream.
+*	@par Include
+*					GUI.h
+* 	@par Description
+*					This function clears the stream state and requests a
+*					keyframe so the first GUI_Task sends all register and
+*					measured values.
+*	@remarks 	UART and the timebase shall be initialized before (see
+*				LINFLEX_InitUART and TIME_Init).
+********************************************************************************/
+void GUI_Init(void)
+{
+	GUIstream.sequence = 0;
+	GUIstream.payload[0] = 0;
+	GUIstream.length = 1;
+	GUIstream.start = TIME_Read();
+	GUIstream.lastTime = 0;
+	GUIstream.frames = 0;
+	GUIstream.records = 0;
+	GUIstream.droppedFrames = 0;
+	GUIrequest.length = 0;
+	GUIrequest.overflow = 0;
+	GUIrequest.requests = 0;
+	GUIrequest.rejected = 0;
+	GUI_RequestKeyframe();
+}
+
+/***************************************************************************//*!
+*   @brief The function GUI_RequestKeyframe forces a full refresh of the GUI.
+*	@par Include
+*					GUI.h
+* 	@par Description
+*					The values known by the GUI are reset to zero and the
+*					absolute time is resent, so the next GUI_Task reports all
+*					non-zero registers and measured values. The GUI resets its
+*					values to zero on the GUI_REC_TIME record as well, the
+*					records sent before it (or lost) do not matter.
+********************************************************************************/
+void GUI_RequestKeyframe(void)
+{
+	uint32_t i;
+
+	for (i = 0; i < GUI_REG_NB; i++)
+	{
+		GUIstream.regShadow[i] = 0;
+	}
+	for (i = 0; i < GUI_MEAS_NB; i++)
+	{
+		GUIstream.measShadow[i] = 0;
+	}
+	GUIstream.timeSent = 0;
+}
+
+/***************************************************************************//*!
+*   @brief The function GUI_Task sends changed register and measured values.
+*	@par Include
+*					GUI.h
+* 	@par Description
+*					This function compares the last received FS65xx registers
+*					(INTstruct) and the last measured voltages
+*					(ADCstruct.actualVoltage) with the values known by the GUI
+*					and appends one record per changed value. Nothing is sent
+*					in the steady state. Pending GUI requests are executed
+*					first (see GUI_ProcessRequests). The values are compared on
+*					sequence locked snapshots, a group skipped on SEQ_BUSY is
+*					compared on the next call.
+*	@remarks 	Shall be called periodically from the main loop. Record
+*				timestamp is the time when the change was detected.
+*	@par Code sample
+*			GUI_Task();
+********************************************************************************/
+void GUI_Task(void)
+{
+	struct FS65_INT_tag registers;
+	struct FS65_Voltage_tag voltages;
+	const register32_struct *p_reg = (const register32_struct *)&registers;
+	const float *p_meas = &voltages.Temp;
+	uint32_t registersOk;
+	uint32_t voltagesOk;
+	uint32_t now;
+	uint32_t value;
+	int32_t measure;
+	int32_t delta;
+	uint32_t i;
+
+	GUI_ProcessRequests();
+
+	now = GUI_GetTime();
+	registersOk = FS65_SnapshotRegisters(&registers, 0);
+	voltagesOk = FS65_SnapshotVoltages(&voltages);
+
+	for (i = 0; (registersOk == SEQ_OK) && (i < GUI_REG_NB); i++)
+	{
+		value = p_reg[i].R;
+		if (value != GUIstream.regShadow[i])
+		{
+			GUI_BeginRecord(GUI_REC_REGISTER, now);
+			GUIstream.payload[GUIstream.length++] = GUI_RegAddress[i];
+			GUI_PutVarint(value ^ GUIstream.regShadow[i]);
+			GUIstream.regShadow[i] = value;
+		}
+	}
+
+	for (i = 0; (voltagesOk == SEQ_OK) && (i < GUI_MEAS_NB); i++)
+	{
+		measure = (int32_t)(p_meas[i] * 1000.0f);	//milli-units
+		if (measure != GUIstream.measShadow[i])
+		{
+			GUI_BeginRecord(GUI_REC_MEASURE, now);	//may start a keyframe (shadows cleared)
+			delta = measure - GUIstream.measShadow[i];
+			GUIstream.payload[GUIstream.length++] = (uint8_t)i;
+			GUI_PutVarint(((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31));	//zigzag
+			GUIstream.measShadow[i] = measure;
+		}
+	}
+	if (GUIstream.timeSent == 0)
+	{
+		GUI_PutTime(now);						//keyframe of zero values only
+	}
+
+	GUI_FlushFrame();
+}
@@ -0,0 +1,669 @@
+/*******************************************************************************
+*
+* Freescale Semiconductor Inc.
+* (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+* ALL RIGHTS RESERVED.
+*
+********************************************************************************
+*
+* $File Name:       LIN.c$
+* @file             LIN.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      LIN schedule table driver source file
+* @brief            LIN schedule table driver source file
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/****************************************************************************//*!
+*
+*  @mainpage LIN schedule table driver for MPC5744P
+*
+*  @section Intro Introduction
+*
+*	This package contains the LIN master schedule table engine running on top
+*	of the LINFlexD module (LIN_NB). The schedule table is walked from the PIT
+*	channel PIT_LIN_CH, each frame is started by a header request and its
+*	completion is handled in the LINFlexD interrupts. The application never
+*	waits for the bus: it exchanges data with the engine through the double
+*	buffered LIN_FrameBuffer items.
+*	In the slave mode the response table is programmed into the identifier
+*	filters, publish responses are loaded in the header interrupt from staged
+*	buffers and subscribed responses are stored into per-frame mailboxes.
+*
+*  The key features of this package are the following:
+*  - Unconditional, sporadic and event triggered frames
+*  - Schedule table switch at a slot boundary
+*  - Collision resolution of event triggered frames
+*  - Slot timeout supervision and error statistics
+*  - Slave response table on the hardware identifier filters
+*
+*  For more information about the functions and configuration items see these documents:
+*
+*******************************************************************************
+*
+* @attention
+*
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : MPC5744P
+*   Dependencies         : MPC5744P - Basic SW drivers.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   LIN_InitSlave	  Slave response table on the identifier filters
+BRNY001					      19/10/2026 	   LIN_InitMaster	  LIN interrupts above the DSPI ceiling
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#include "MPC5744P_drv.h"
+#include "LINFLEX.h"
+#include "PIT.h"
+#include "LIN.h"
+
+#define LIN_LINESR_ABORT	(LINFLEX_LINESR_ALL & ~LINFLEX_LINESR_NF)	///errors aborting the frame in progress
+#define LIN_LINESR_COLLISION	(LINFLEX_LINESR_BEF | LINFLEX_LINESR_CEF | LINFLEX_LINESR_FEF)	///errors of colliding responses
+
+LIN_MasterStruct LINmaster;
+LIN_SlaveStruct LINslave;
+
+static uint32_t LIN_mode = LIN_MODE_NONE;		///LIN_MODE_xxx, selects the interrupt handlers
+static const LIN_FrameConfig *LIN_frames;		///frame table of the active mode
+static LIN_FrameBuffer *LIN_buffers;			///frame data of the active mode
+
+/***************************************************************************//*!
+*   @brief The function LIN_LoadResponse loads a response into the buffer
+*			data registers.
+*	@par Include
+*					LIN.h
+* 	@par Description
+*					The last committed data of the frame are copied into
+*					BDRL/BDRM and the update flag of the frame is cleared.
+*	@param[in] p_buf - Frame data.
+********************************************************************************/
+static void LIN_LoadResponse(LIN_FrameBuffer *p_buf)
+{
+	const uint8_t *p_data = p_buf->data[p_buf->count & 1];
+
+	LINFLEX[LIN_NB]->BDRL.R = (uint32_t)p_data[0] | ((uint32_t)p_data[1] << 8) |
+							  ((uint32_t)p_data[2] << 16) | ((uint32_t)p_data[3] << 24);
+	LINFLEX[LIN_NB]->BDRM.R = (uint32_t)p_data[4] | ((uint32_t)p_data[5] << 8) |
+							  ((uint32_t)p_data[6] << 16) | ((uint32_t)p_data[7] << 24);
+	p_buf->updated = 0;
+}
+
+/***************************************************************************//*!
+*   @brief The function LIN_StoreResponse stores the received response.
+*	@par Include
+*					LIN.h
+* 	@par Description
+*					BDRL/BDRM are copied into the back buffer of the frame and
+*					committed.
+*	@param[in] p_buf - Frame data.
+*	@param[in] bdrl - BDRL register content.
+*	@param[in] bdrm - BDRM register content.
+********************************************************************************/
+static void LIN_StoreResponse(LIN_FrameBuffer *p_buf, uint32_t bdrl, uint32_t bdrm)
+{
+	uint8_t *p_back = p_buf->data[(p_buf->count + 1) & 1];
+	uint32_t i;
+
+	for(i = 0; i < 4; i++){
+		p_back[i] = (uint8_t)(bdrl >> (8 * i));
+		p_back[i + 4] = (uint8_t)(bdrm >> (8 * i));
+	}
+	p_buf->count++;							//commit
+}
+
+/***************************************************************************//*!
+*   @brief The function LIN_InitBuffers clears the frame data.
+*	@par Include
+*					LIN.h
+*	@param[in] p_buffers - Frame data.
+*	@param[in] nbFrames - Number of frames.
+********************************************************************************/
+static void LIN_InitBuffers(LIN_FrameBuffer *p_buffers, uint32_t nbFrames)
+{
+	uint32_t i, j;
+
+	for(i = 0; i < nbFrames; i++){
+		for(j = 0; j < 8; j++){
+			p_buffers[i].data[0][j] = 0;
+			p_buffers[i].data[1][j] = 0;
+		}
+		p_buffers[i].count = 0;
+		p_buffers[i].updated = 0;
+		p_buffers[i].errors = 0;
+		p_buffers[i].noResponse = 0;
+	}
+}
+
+/***************************************************************************//*!
+*   @brief The function LIN_StartFrame requests the header of a frame.
+*	@par Include
+*					LIN.h
+* 	@par Description
+*					This function programs the buffer identifier, loads the
+*					last committed data of a publish frame and requests the
+*					header transmission. The response is sent or received by
+*					the LINFlexD module without any software intervention.
+*	@param[in] frame - Index of the frame in the frame table.
+*	@param[in] p_event - Event triggered slot, 0 for other frames.
+*	@remarks 	Called from LIN_IsrTick only.
+********************************************************************************/
+static void LIN_StartFrame(uint32_t frame, const LIN_SlotConfig *p_event)
+{
+	const LIN_FrameConfig *p_cfg = &LINmaster.p_frames[frame];
+	LINFlexD_BIDR_tag bidr;
+
+	bidr.R = 0;
+	bidr.B.DFL = p_cfg->length - 1;
+	bidr.B.DIR = p_cfg->direction;
+	bidr.B.CCS = p_cfg->checksum;
+	bidr.B.ID = p_cfg->id;
+	LINFLEX[LIN_NB]->BIDR.R = bidr.R;
+
+	if(p_cfg->direction == LIN_PUBLISH){
+		LIN_LoadResponse(&LINmaster.p_buffers[frame]);
+	}
+
+	LINmaster.frame = frame;
+	LINmaster.p_event = p_event;
+	LINmaster.headers++;
+	LINFLEX[LIN_NB]->LINCR2.B.HTRQ = 1;		//header transmission request
+}
+
+/***************************************************************************//*!
+*   @brief The function LIN_AbortFrame aborts the frame in progress.
+*	@par Include
+*					LIN.h
+*	@remarks 	Called from the LIN interrupts only.
+********************************************************************************/
+static void LIN_AbortFrame(void)
+{
+	LINFLEX[LIN_NB]->LINCR2.B.ABRQ = 1;		//LIN state machine back to idle
+	LINmaster.frame = LIN_NO_FRAME;
+	LINmaster.p_event = 0;
+}
+
+/***************************************************************************//*!
+*   @brief The function LIN_InitMaster initializes the LIN master and its
+*			schedule tick.
+*	@par Include
+*					LIN.h
+* 	@par Description
+*					This function initializes the LINFlexD module LIN_NB as
+*					a LIN master at LIN_BR, enables its transmission,
+*					reception and error interrupts and starts the PIT channel
+*					PIT_LIN_CH with the LIN_TICK_US period. No schedule table
+*					is active until LIN_SetScheduleTable is called.
+*	@param[in] p_frames - Frame table.
+*	@param[in] p_buffers - Frame data, one item per frame of p_frames.
+*	@param[in] nbFrames - Number of frames.
+*	@remarks 	Interrupt priorities of the PIT_LIN_CH channel and of the
+*				LINFlexD module have to be equal (INT_LIN_PRIORITY), LIN
+*				interrupts do not preempt each other. INT_LIN_PRIORITY is
+*				above INT_CEIL_PRIORITY, the LIN interrupts shall not use
+*				the FS65 functions (DSPI).
+*	@par Code sample
+*			LIN_InitMaster(frames, buffers, 3);
+*			LIN_SetScheduleTable(&normalTable);
+*			- Starts the normalTable schedule with three frames.
+********************************************************************************/
+void LIN_InitMaster(const LIN_FrameConfig *p_frames, LIN_FrameBuffer *p_buffers, uint32_t nbFrames)
+{
+	LIN_InitBuffers(p_buffers, nbFrames);
+	LIN_mode = LIN_MODE_NONE;
+	LIN_frames = p_frames;
+	LIN_buffers = p_buffers;
+	LINmaster.p_frames = p_frames;
+	LINmaster.p_buffers = p_buffers;
+	LINmaster.nbFrames = nbFrames;
+	LINmaster.p_table = 0;
+	LINmaster.p_next = 0;
+	LINmaster.newTable = 0;
+	LINmaster.slot = 0;
+	LINmaster.ticksLeft = 0;
+	LINmaster.frame = LIN_NO_FRAME;
+	LINmaster.p_event = 0;
+	LINmaster.p_collision = 0;
+	LINmaster.collisionIndex = 0;
+	LINmaster.headers = 0;
+	LINmaster.responses = 0;
+	LINmaster.errors = 0;
+	LINmaster.timeouts = 0;
+	LINmaster.collisions = 0;
+
+	LINFLEX_InitLIN(LIN_NB, LINFLEX_CLK, LIN_BR, MASTER);
+	LINFLEX[LIN_NB]->LINIER.B.DTIE = 1;		//publish response sent
+	LINFLEX[LIN_NB]->LINIER.B.BEIE = 1;		//bit error
+	LINFLEX[LIN_NB]->LINIER.B.CEIE = 1;		//checksum error
+	LINFLEX[LIN_NB]->LINIER.B.HEIE = 1;		//header error
+	LIN_mode = LIN_MODE_MASTER;
+
+	PIT_Setup(PIT_LIN_CH, PIT_CLK/1000000, LIN_TICK_US);
+	PIT_EnableInt(PIT_LIN_CH);
+	PIT_EnableChannel(PIT_LIN_CH);
+}
+
+/***************************************************************************//*!
+*   @brief The function LIN_InitSlave initializes the LIN slave response
+*			table.
+*	@par Include
+*					LIN.h
+* 	@par Description
+*					This function initializes the LINFlexD module LIN_NB as
+*					a LIN slave at LIN_BR and programs one identifier filter
+*					(list mode) per frame of the response table. The filter
+*					bypass is disabled, headers of other identifiers are
+*					ignored by the hardware. Publish frames are answered in
+*					the header interrupt from the data staged by
+*					LIN_WriteFrame, subscribed frames are read by
+*					LIN_ReadFrame.
+*	@param[in] p_frames - Response table (at most LIN_SLAVE_FILTERS frames).
+*	@param[in] p_buffers - Frame data, one item per frame of p_frames.
+*	@param[in] nbFrames - Number of frames.
+*	@return 	LIN_RETURN_OK - Slave initialized. <br>
+*				LIN_RETURN_ERROR - Too many frames, nothing done.
+*	@remarks 	The response is requested within the header interrupt
+*				latency, INT_LIN_PRIORITY has to be preempted only by short
+*				interrupts to keep the LIN response space. It is above
+*				INT_CEIL_PRIORITY, the FS65 SPI transactions do not delay
+*				the header interrupt.
+*	@par Code sample
+*			LIN_InitSlave(responses, mailboxes, 4);
+*			- Answers the 4 identifiers of the responses table.
+********************************************************************************/
+uint32_t LIN_InitSlave(const LIN_FrameConfig *p_frames, LIN_FrameBuffer *p_buffers, uint32_t nbFrames)
+{
+	LINFlexD_IFCR_tag ifcr;
+	uint32_t i;
+
+	if(nbFrames > LIN_SLAVE_FILTERS){
+		return LIN_RETURN_ERROR;
+	}
+
+	PIT_DisableChannel(PIT_LIN_CH);				//no schedule tick in the slave mode
+	LIN_InitBuffers(p_buffers, nbFrames);
+	LIN_mode = LIN_MODE_NONE;
+	LIN_frames = p_frames;
+	LIN_buffers = p_buffers;
+	LINslave.p_frames = p_frames;
+	LINslave.p_buffers = p_buffers;
+	LINslave.nbFrames = nbFrames;
+	LINslave.frame = LIN_NO_FRAME;
+	LINslave.headers = 0;
+	LINslave.responses = 0;
+	LINslave.errors = 0;
+	LINslave.unknownHeaders = 0;
+
+	LINFLEX_InitLIN(LIN_NB, LINFLEX_CLK, LIN_BR, SLAVE);
+
+	LINFLEX[LIN_NB]->LINCR1.B.INIT = 1;		//filters are writable in the initialization mode only
+	LINFLEX[LIN_NB]->IFER.R = 0;
+	LINFLEX[LIN_NB]->IFMR.R = 0;				//identifier list mode
+	for(i = 0; i < nbFrames; i++){
+		ifcr.R = 0;
+		ifcr.B.DFL = p_frames[i].length - 1;
+		ifcr.B.DIR = p_frames[i].direction;
+		ifcr.B.CCS = p_frames[i].checksum;
+		ifcr.B.ID = p_frames[i].id;
+		LINFLEX[LIN_NB]->IFCR[i].R = ifcr.R;
+	}
+	LINFLEX[LIN_NB]->IFER.B.FACT = (1 << nbFrames) - 1;
+	LINFLEX[LIN_NB]->LINCR1.B.BF = 0;			//headers without a matching filter are ignored
+	LINFLEX[LIN_NB]->LINCR1.B.INIT = 0;
+
+	LINFLEX[LIN_NB]->LINIER.B.HRIE = 1;		//header of a publish frame
+	LINFLEX[LIN_NB]->LINIER.B.DTIE = 1;		//publish response sent
+	LINFLEX[LIN_NB]->LINIER.B.BEIE = 1;		//bit error
+	LINFLEX[LIN_NB]->LINIER.B.CEIE = 1;		//checksum error
+	LINFLEX[LIN_NB]->LINIER.B.HEIE = 1;		//header error
+	LIN_mode = LIN_MODE_SLAVE;
+
+	return LIN_RETURN_OK;
+}
+
+/***************************************************************************//*!
+*   @brief The function LIN_SetScheduleTable selects the active schedule table.
+*	@par Include
+*					LIN.h
+* 	@par Description
+*					The new table is applied at the next slot boundary, the
+*					slot in progress is always completed. The new table is
+*					started from its first slot.
+*	@param[in] p_table - Schedule table, 0 stops the schedule.
+*	@par Code sample
+*			LIN_SetScheduleTable(&diagTable);
+********************************************************************************/
+void LIN_SetScheduleTable(const LIN_ScheduleTable *p_table)
+{
+	LINmaster.p_next = p_table;
+	LINmaster.newTable = 1;
+}
+
+/***************************************************************************//*!
+*   @brief The function LIN_WriteFrame updates data of a publish frame.
+*	@par Include
+*					LIN.h
+* 	@par Description
+*					Data are written into the back buffer and committed at
+*					once. An unconditional frame sends them in its next slot,
+*					a sporadic frame is scheduled by the update.
+*	@param[in] frame - Index of the frame in the frame table.
+*	@param[in] p_data - Frame data (frame length Bytes).
+*	@remarks 	Shall not be called for the same frame from two contexts
+*				preempting each other.
+*	@par Code sample
+*			LIN_WriteFrame(0, lampCmd);
+********************************************************************************/
+void LIN_WriteFrame(uint32_t frame, const uint8_t *p_data)
+{
+	LIN_FrameBuffer *p_buf = &LIN_buffers[frame];
+	uint8_t *p_back = p_buf->data[(p_buf->count + 1) & 1];
+	uint32_t i;
+
+	for(i = 0; i < LIN_frames[frame].length; i++){
+		p_back[i] = p_data[i];
+	}
+	p_buf->count++;			//commit
+	p_buf->updated = 1;
+}
+
+/***************************************************************************//*!
+*   @brief The function LIN_ReadFrame returns the last data of a frame.
+*	@par Include
+*					LIN.h
+* 	@par Description
+*					This function copies the last committed data of a frame.
+*					The copy is repeated if the buffer was overwritten by the
+*					LIN interrupts in the meantime, so the result is always
+*					one consistent response.
+*	@param[in] frame - Index of the frame in the frame table.
+*	@param[out] p_data - Frame data (frame length Bytes).
+*	@return 	Number of updates of the frame, the application detects a
+*				new response by a change of this value.
+*	@par Code sample
+*			if(LIN_ReadFrame(1, switches) != lastCount) ...
+********************************************************************************/
+uint32_t LIN_ReadFrame(uint32_t frame, uint8_t *p_data)
+{
+	LIN_FrameBuffer *p_buf = &LIN_buffers[frame];
+	const uint8_t *p_front;
+	uint32_t count;
+	uint32_t i;
+
+	do{
+		count = p_buf->count;
+		p_front = p_buf->data[count & 1];
+		for(i = 0; i < LIN_frames[frame].length; i++){
+			p_data[i] = p_front[i];
+		}
+	}while((p_buf->count - count) > 1);		//front buffer rewritten during the copy
+
+	return count;
+}
+
+/***************************************************************************//*!
+*   @brief The function LIN_IsrTick walks the schedule table.
+*	@par Include
+*					LIN.h
+* 	@par Description
+*					PIT_LIN_CH interrupt. At each slot boundary a frame not
+*					completed within its slot is aborted, a requested table
+*					switch is applied and the header of the next slot is
+*					requested:
+*					- unconditional slot: its frame,
+*					- sporadic slot: the first updated frame of the list,
+*					- event triggered slot: the event triggered frame.
+*					After a collision the associated frames of the event
+*					triggered slot are polled one per slot before the table
+*					continues.
+********************************************************************************/
+void LIN_IsrTick(void)
+{
+	const LIN_SlotConfig *p_slot;
+	uint32_t i;
+
+	PIT_ClearFlag(PIT_LIN_CH);
+
+	if(LIN_mode != LIN_MODE_MASTER){
+		return;
+	}
+	if(LINmaster.ticksLeft > 1){
+		LINmaster.ticksLeft--;
+		return;
+	}
+
+	if(LINmaster.frame != LIN_NO_FRAME){
+		if(LINmaster.p_event == 0){	//no response to an event triggered header is not an error
+			LINmaster.timeouts++;
+			LINmaster.p_buffers[LINmaster.frame].noResponse++;
+		}
+		LIN_AbortFrame();
+	}
+
+	if(LINmaster.newTable){
+		LINmaster.p_table = LINmaster.p_next;
+		LINmaster.newTable = 0;
+		LINmaster.slot = 0;
+		LINmaster.p_collision = 0;
+	}
+	if(LINmaster.p_table == 0){
+		LINmaster.ticksLeft = 0;
+		return;
+	}
+
+	if(LINmaster.p_collision != 0){		//collision resolution
+		p_slot = LINmaster.p_collision;
+		LIN_StartFrame(p_slot->p_associated[LINmaster.collisionIndex], 0);
+		if(++LINmaster.collisionIndex >= p_slot->nbAssociated){
+			LINmaster.p_collision = 0;
+		}
+		LINmaster.ticksLeft = p_slot->ticks;
+		return;
+	}
+
+	p_slot = &LINmaster.p_table->p_slots[LINmaster.slot];
+	if(++LINmaster.slot >= LINmaster.p_table->nbSlots){
+		LINmaster.slot = 0;
+	}
+	LINmaster.ticksLeft = p_slot->ticks;
+
+	switch(p_slot->type){
+	case LIN_SLOT_UNCONDITIONAL:
+		LIN_StartFrame(p_slot->frame, 0);
+		break;
+	case LIN_SLOT_SPORADIC:
+		for(i = 0; i < p_slot->nbAssociated; i++){
+			if(LINmaster.p_buffers[p_slot->p_associated[i]].updated){
+				LIN_StartFrame(p_slot->p_associated[i], 0);
+				break;
+			}
+		}
+		break;
+	case LIN_SLOT_EVENT:
+		LIN_StartFrame(p_slot->frame, p_slot);
+		break;
+	default:
+		break;
+	}
+}
+
+/***************************************************************************//*!
+*   @brief The function LIN_MasterRx stores a received response (master).
+*	@par Include
+*					LIN.h
+* 	@par Description
+*					The response is copied into the back buffer of the frame
+*					and committed. A response to an event triggered header is
+*					stored into the associated frame given by its first Byte
+*					(protected identifier).
+********************************************************************************/
+static void LIN_MasterRx(void)
+{
+	uint32_t bdrl, bdrm;
+	uint32_t frame = LINmaster.frame;
+	uint32_t i;
+
+	bdrl = LINFLEX[LIN_NB]->BDRL.R;
+	bdrm = LINFLEX[LIN_NB]->BDRM.R;
+	LINFLEX[LIN_NB]->LINSR.R = LINFLEX_LINSR_DRF | LINFLEX_LINSR_RMB;	//release the buffer
+
+	if(frame == LIN_NO_FRAME){
+		return;								//response after the end of its slot
+	}
+	if(LINmaster.p_event != 0){
+		for(i = 0; i < LINmaster.p_event->nbAssociated; i++){
+			if(LINmaster.p_frames[LINmaster.p_event->p_associated[i]].id == (bdrl & 0x3F)){
+				frame = LINmaster.p_event->p_associated[i];
+				break;
+			}
+		}
+	}
+	LIN_StoreResponse(&LINmaster.p_buffers[frame], bdrl, bdrm);
+
+	LINmaster.responses++;
+	LINmaster.frame = LIN_NO_FRAME;
+	LINmaster.p_event = 0;
+}
+
+/***************************************************************************//*!
+*   @brief The function LIN_SlaveRx answers a header or stores a response
+*			(slave).
+*	@par Include
+*					LIN.h
+* 	@par Description
+*					Header of a publish frame (HRF): the staged response of
+*					the matching filter is loaded and its transmission is
+*					requested at once, so the response space does not depend
+*					on the main loop. Subscribed response (DRF): the data are
+*					committed into the mailbox of the matching filter.
+********************************************************************************/
+static void LIN_SlaveRx(void)
+{
+	uint32_t status = LINFLEX[LIN_NB]->LINSR.R;
+	uint32_t filter = LINFLEX[LIN_NB]->IFMI.B.IFMI;		//matching filter + 1, 0 - no match
+	uint32_t bdrl, bdrm;
+
+	if(status & LINFLEX_LINSR_HRF){
+		LINFLEX[LIN_NB]->LINSR.R = LINFLEX_LINSR_HRF;
+		if((filter == 0) || (filter > LINslave.nbFrames)){
+			LINslave.unknownHeaders++;
+			return;
+		}
+		LINslave.headers++;
+		if(LINslave.p_frames[filter - 1].direction == LIN_PUBLISH){
+			LIN_LoadResponse(&LINslave.p_buffers[filter - 1]);
+			LINslave.frame = filter - 1;
+			LINFLEX[LIN_NB]->LINCR2.B.DTRQ = 1;		//data transmission request
+		}
+	}
+	if(status & LINFLEX_LINSR_DRF){
+		bdrl = LINFLEX[LIN_NB]->BDRL.R;
+		bdrm = LINFLEX[LIN_NB]->BDRM.R;
+		LINFLEX[LIN_NB]->LINSR.R = LINFLEX_LINSR_DRF | LINFLEX_LINSR_RMB;	//release the buffer
+		if((filter == 0) || (filter > LINslave.nbFrames)){
+			LINslave.unknownHeaders++;
+			return;
+		}
+		LIN_StoreResponse(&LINslave.p_buffers[filter - 1], bdrl, bdrm);
+		LINslave.responses++;
+	}
+}
+
+/***************************************************************************//*!
+*   @brief The function LIN_IsrRx handles the LINFlexD reception interrupt.
+*	@par Include
+*					LIN.h
+* 	@par Description
+*					LINFlexD_0 Rx interrupt (vector 376), dispatched to the
+*					master or slave handler according to the initialized mode.
+********************************************************************************/
+void LIN_IsrRx(void)
+{
+	if(LIN_mode == LIN_MODE_SLAVE){
+		LIN_SlaveRx();
+	}
+	else{
+		LIN_MasterRx();
+	}
+}
+
+/***************************************************************************//*!
+*   @brief The function LIN_IsrTx ends a publish frame.
+*	@par Include
+*					LIN.h
+* 	@par Description
+*					LINFlexD data transmission interrupt, the response of the
+*					master or of the slave has been sent.
+********************************************************************************/
+void LIN_IsrTx(void)
+{
+	LINFLEX[LIN_NB]->LINSR.R = LINFLEX_LINSR_DTF;
+
+	if(LIN_mode == LIN_MODE_SLAVE){
+		LINslave.responses++;
+		LINslave.frame = LIN_NO_FRAME;
+	}
+	else if(LINmaster.frame != LIN_NO_FRAME){
+		LINmaster.responses++;
+		LINmaster.frame = LIN_NO_FRAME;
+	}
+}
+
+/***************************************************************************//*!
+*   @brief The function LIN_IsrError handles LIN errors.
+*	@par Include
+*					LIN.h
+* 	@par Description
+*					LINFlexD error interrupt. The frame in progress is aborted
+*					and counted as an error. A corrupted response to an event
+*					triggered header is a collision, the associated frames
+*					are polled in the following slots. A slave only counts the
+*					error, the LIN state machine waits for the next break.
+********************************************************************************/
+void LIN_IsrError(void)
+{
+	uint32_t status;
+
+	status = LINFLEX[LIN_NB]->LINESR.R & LINFLEX_LINESR_ALL;
+	LINFLEX[LIN_NB]->LINESR.R = status;		//clear flags
+
+	if(!(status & LIN_LINESR_ABORT)){
+		return;								//noise only, the response is still checked
+	}
+	if(LIN_mode == LIN_MODE_SLAVE){
+		LINslave.errors++;
+		if(LINslave.frame != LIN_NO_FRAME){
+			LINslave.p_buffers[LINslave.frame].errors++;
+			LINslave.frame = LIN_NO_FRAME;
+		}
+		return;
+	}
+	if((LINmaster.p_event != 0) && (status & LIN_LINESR_COLLISION)){
+		LINmaster.collisions++;
+		LINmaster.p_collision = LINmaster.p_event;
+		LINmaster.collisionIndex = 0;
+	}
+	else{
+		LINmaster.errors++;
+		if(LINmaster.frame != LIN_NO_FRAME){
+			LINmaster.p_buffers[LINmaster.frame].errors++;
+		}
+	}
+	LIN_AbortFrame();
+}
@@ -54,17 +54,30 @@ Revision History:
                              Modification     Function
 Author (core ID)              Date D/M/Y       Name		  Description of Changes
 B35993		 				  24/07/2014 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   LINFLEX_WriteUART	  Interrupt driven UART Tx ring buffer added
+BRNY001					      19/10/2026 	   LINFLEX_IsrRxUART	  Interrupt driven UART Rx ring buffer with idle-line framing added
+BRNY001					      19/10/2026 	   LINFLEX_ChangeBaudRate	  Integer baud rate computation (CLOCK_ComputeLinflex)
+BRNY001					      19/10/2026 	   LINFLEX_SendUART	  Time-bounded waits of LINFLEX_SendUART and LINFLEX_SendFrameLIN (TIME_WAIT)
+BRNY001					      19/10/2026 	   LINFLEX_IsrXxUART	  UART ring buffers in the local data RAM, UART handlers executed from SRAM (RAM_TEXT)
+BRNY001					      19/10/2026 	   LINFLEX_IsrRxUART	  Rx ISR priority above the DSPI ceiling
+BRNY001					      19/10/2026 	   LINFLEX_ClearParityError	  4-bit PE field written with 0xF
+BRNY001					      19/10/2026 	   LINFLEX_SendWordUART	  UART ceiling kept around the sends without ring buffer
+BRNY001					      19/10/2026 	   LINFLEX_IsrRxUART	  Frame boundary of TO recorded when DRF is pending too
 
 ---------------------------   ----------    ------------  ------------------------------------------
 ==================================================================================================*/
 
 #include "MPC5744P_drv.h"
-#include <math.h>
+#include "CLOCK.h"
 #include "LINFLEX.h"
 #include "SIUL.h"
+#include "TIME.h"
 
 volatile struct LINFlexD_tag *LINFLEX[2] = {&LINFlexD_0, &LINFlexD_1};
 
+DRAM_BSS LINFLEX_TxRingStruct LINFLEXtxRing;		///Tx ring buffer of the LINFLEX_UART_NB module
+DRAM_BSS LINFLEX_RxRingStruct LINFLEXrxRing;		///Rx ring buffer of the LINFLEX_UART_NB module
+
 /***************************************************************************//*!
 *   @brief The function LINFLEX_ChangeBaudRate changes a baud rate to the 
 *			desired one (if the value is in the specified range).
@@ -84,15 +97,17 @@ volatile struct LINFlexD_tag *LINFLEX[2] = {&LINFlexD_0, &LINFlexD_1};
 *						limits of LINIBRR and LINFBRR registers. *						
 *	@remarks 	If an internal RC oscillator is used as a system clock, then its 
 *				calibration is recommended before use of LINFlex module (see 
-*				calibrateRC function for details). Value obtained from the 
-*				calibration should be directly added in the floating point format
-*				as a parameter to the LINFLEX_InitUART function. If the calibration 
+*				calibrateRC function for details). Frequency obtained from the 
+*				calibration [Hz] should be directly added as a parameter to the 
+*				LINFLEX_InitUART function. If the calibration 
 *				will not be done, bus timing with RC oscillator should not be exact 
 *				and communication shall generate errors. LINFlex module should be 
 *				activated before use of this function (see LINFLEX_InitUART function 
-*				for details).
+*				for details). Registers are computed in integer arithmetic (see 
+*				CLOCK_ComputeLinflex), use CLOCK_LINFLEX_BAUD to check the achieved 
+*				baud rate at compile time.
 *	@par Code sample1
-*			LINFLEX_ChangeBaudRate(1, 40000000.0, 600);
+*			LINFLEX_ChangeBaudRate(1, 40000000, 600);
 *			- Command changes content of the LINFlex1 registers (LINIBRR, LINFBRR) 
 *			to set up baud rate 600 b/s with respect to the 40 MHz clock frequency. 
 *			In this case an XTAL oscillator is used.
@@ -103,21 +118,13 @@ volatile struct LINFlexD_tag *LINFLEX[2] = {&LINFlexD_0, &LINFlexD_1};
 *			RC oscillator. RCfrequency parameter is a real frequency of RC 
 *			oscillator obtained from its previous calibration.
 ********************************************************************************/
-void LINFLEX_ChangeBaudRate(vuint8_t nbLINFlex, double sysClk, uint32_t baudRate){
-	double LFDIVvalue = 0;
-	double fractionalPart = 0;
+void LINFLEX_ChangeBaudRate(vuint8_t nbLINFlex, uint32_t sysClk, uint32_t baudRate){
 	uint32_t integerPart = 0;
-	uint32_t fractionalPartRounded = 0;
-	
-	LFDIVvalue = sysClk/(16.0*baudRate);
-	
+	uint32_t fractionalPart = 0;
 	
-	integerPart = floor(LFDIVvalue);										//to get the integer part
-	fractionalPart = LFDIVvalue - floor(LFDIVvalue);		//to get only the fractional part
-	fractionalPart*=16;
-	fractionalPartRounded = round(fractionalPart);
+	(void)CLOCK_ComputeLinflex(sysClk, baudRate, &integerPart, &fractionalPart);
 	
-	LINFLEX[nbLINFlex]->LINFBRR.R = fractionalPartRounded;
+	LINFLEX[nbLINFlex]->LINFBRR.R = fractionalPart;
 	LINFLEX[nbLINFlex]->LINIBRR.R = integerPart;
 	
 }
@@ -334,15 +341,15 @@ void LINFLEX_EnableInt(vuint8_t nbLINFlex)
 *	@remarks 	Calibration is recommended if an internal RC oscillator is used 
 *				as a system clock.
 *	@par Code sample1
-*			LINFLEX_UART_Init(1, 40000000.0, 600);
+*			LINFLEX_UART_Init(1, 40000000, 600);
 *			- Command initializes UART module no. 1 with respect to the 40 MHz 
 *			system clock sysClk and the desired baud rate 600 b/s.
 *	@par Code sample2
-*			LINFLEX_UART_Init(0, 40000000.0, 115200);
+*			LINFLEX_UART_Init(0, 40000000, 115200);
 *			- Command initializes UART module no. 0 with respect to the 40 MHz 
 *			system clock sysClk and the desired baud rate 115 200 b/s.		
 ********************************************************************************/
-void LINFLEX_InitUART(vuint8_t nbLINFlex, double sysClk, uint32_t baudRate)
+void LINFLEX_InitUART(vuint8_t nbLINFlex, uint32_t sysClk, uint32_t baudRate)
 {
 
 	LINFLEX_ConfigurePads(nbLINFlex);
@@ -364,7 +371,21 @@ void LINFLEX_InitUART(vuint8_t nbLINFlex, double sysClk, uint32_t baudRate)
 
 	LINFLEX_ChangeBaudRate(nbLINFlex, sysClk, baudRate);
 	
-	LINFLEX_InitRxBuffer(nbLINFlex,4);				
+	if (nbLINFlex == LINFLEX_UART_NB)
+	{
+		//Rx ring buffer fed by LINFLEX_IsrRxUART, partial buffer flushed on the idle line timeout
+		LINFLEX_InitRxBuffer(nbLINFlex, LINFLEX_UART_RX_BUFFER_SIZE);
+		LINFLEX[nbLINFlex]->UARTPTO.R = LINFLEX_UART_RX_IDLE_BITS;
+		LINFLEX[nbLINFlex]->LINIER.B.DBEIETOIE = 1;		//UART timeout interrupt enable
+		LINFLEXrxRing.head = 0;
+		LINFLEXrxRing.tail = 0;
+		LINFLEXrxRing.frameHead = 0;
+		LINFLEXrxRing.frameTail = 0;
+	}
+	else
+	{
+		LINFLEX_InitRxBuffer(nbLINFlex,4);
+	}
 
 	LINFLEX[nbLINFlex]->UARTSR.B.DRFRFE = 1; // clear DRF flag (Data Reception Complete Flag)
 	LINFLEX[nbLINFlex]->UARTSR.B.DTFTFF = 1; // clear DTF flag (Data Transmission Complete Flag)
@@ -428,7 +449,7 @@ void LINFLEX_InitRxBuffer (vuint8_t nbLINFlex, int8_t nbBytes)
 *			data[1] = 'a';							</para>
 *			data[2] = 's';							</para>
 *			data[3] = 'y';							</para>
-*			LINFLEX_InitUART(1, 40000000.0, 600);	</para>
+*			LINFLEX_InitUART(1, 40000000, 600);	</para>
 *			LINFLEX_SendUART (1, &data[0], 4);		</para>
 *			- This sample of code will send a word ("Easy") via LINFlex1 UART. 
 *			Data bytes will be sent in the same order as they are in the memory 
@@ -439,7 +460,8 @@ void LINFLEX_SendUART (vuint8_t nbLINFlex, uint8_t* p_tx, uint8_t nbBytes)
 
 	uint32_t responseL=0;
 
-	while((LINFLEX[nbLINFlex]->LINSR.B.LINS != 2) && (LINFLEX[nbLINFlex]->LINSR.B.LINS != 0)){ };		//waiting for IDLE or SLEEP mode
+	(void)TIME_WAIT(TIME_WAIT_UART_STATE, TIME_TIMEOUT_UART_US,
+					(LINFLEX[nbLINFlex]->LINSR.B.LINS == 2) || (LINFLEX[nbLINFlex]->LINSR.B.LINS == 0));	//waiting for IDLE or SLEEP mode
 
 	LINFLEX[nbLINFlex]->UARTCR.B.TDFL_TFC = nbBytes-1;
 
@@ -461,7 +483,7 @@ void LINFLEX_SendUART (vuint8_t nbLINFlex, uint8_t* p_tx, uint8_t nbBytes)
 	}
 
 	LINFLEX[nbLINFlex]->BDRL.R = responseL;
-	while(LINFLEX[nbLINFlex]->UARTSR.B.DTFTFF!=1){}
+	(void)TIME_WAIT(TIME_WAIT_UART_DTF, TIME_TIMEOUT_UART_US, LINFLEX[nbLINFlex]->UARTSR.B.DTFTFF == 1);
 	LINFLEX[nbLINFlex]->UARTSR.B.DTFTFF=1;
 }
 
@@ -491,7 +513,7 @@ void LINFLEX_SendUART (vuint8_t nbLINFlex, uint8_t* p_tx, uint8_t nbBytes)
 *	@par Code sample
 *			</param>
 *		uint8_t data[4];								</param>	
-*		LINFLEX_InitUART(1, 40000000.0, 600);			</param>									
+*		LINFLEX_InitUART(1, 40000000, 600);			</param>									
 *		while(LINFLEX_GetReceiveFlagUART(1)==0);  		</param>
 *		LINFLEX_ReadUART (1, 4, &data[0]);				</param>
 *		LINFLEX_ClearReceiveFlagUART(1);				</param>
@@ -618,7 +640,7 @@ uint32_t LINFLEX_GetParityErrorUART(vuint8_t nbLINFlex){						//check parity err
 *			- Command clears all parity flags in the PE register for module no.0.	
 ********************************************************************************/
 void LINFLEX_ClearParityError(vuint8_t nbLINFlex){
-	LINFLEX[nbLINFlex]->UARTSR.B.PE = 0xFF;
+	LINFLEX[nbLINFlex]->UARTSR.B.PE = 0xF;		//w1c, 4 bits
 }
 
 /***************************************************************************//*!
@@ -676,21 +698,21 @@ uint32_t LINFLEX_IsIdle(vuint8_t nbLINFlex){			//function returns 1 if UART is i
 *				- "SLAVE" - LIN will be a Slave	
 *	@remarks 	If internal RC oscillator is used as a system clock, then its 
 *				calibration is recommended (see calibrateRC function for details). 
-*				Then the value obtained from the calibration should be directly 
-*				added in the floating point format as a parameter of the 
+*				Then the frequency obtained from the calibration [Hz] should be 
+*				directly added as a parameter of the 
 *				LINFLEX_UART_Init function. This will allow init function to 
 *				compute baud rate registers more precisely.
 *	@par Code sample1
-*			LINFLEX_InitLIN(1, 40000000.0, 600, MASTER);	
+*			LINFLEX_InitLIN(1, 40000000, 600, MASTER);	
 *			Command initializes LIN module no. 1 as a Master with respect to 
 *			the 40 MHz system clock sysClk and the desired baud rate 600 b/s. 	
 *	@par Code sample2
-*			LINFLEX_InitLIN(0, 40000000.0, 115200, SLAVE);	
+*			LINFLEX_InitLIN(0, 40000000, 115200, SLAVE);	
 *			Command initializes LIN module no. 0 as a Slave with respect to 
 *			the 40 MHz system clock sysClk and the desired baud rate 115
 *			200 b/s.	
 ********************************************************************************/
-void LINFLEX_InitLIN(vuint8_t nbLINFlex, double sysClk, uint32_t baudRate, uint8_t mode)
+void LINFLEX_InitLIN(vuint8_t nbLINFlex, uint32_t sysClk, uint32_t baudRate, uint8_t mode)
 {
 
 	LINFLEX_ConfigurePads(nbLINFlex);
@@ -828,7 +850,7 @@ void LINFLEX_SendFrameLIN (vuint8_t nbLINFlex, uint8_t* p_tx, uint8_t nbBytes, u
 	
 	LINFLEX[nbLINFlex]->LINCR2.B.HTRQ = 1;    // TEST PROC posilz i DATA a ne jenom HEADER??????????????????????????????????????????????????????????????
 
-	while(LINFLEX[nbLINFlex]->LINSR.B.DTF!=1){}
+	(void)TIME_WAIT(TIME_WAIT_LIN_DTF, TIME_TIMEOUT_UART_US, LINFLEX[nbLINFlex]->LINSR.B.DTF == 1);
 	LINFLEX[nbLINFlex]->LINSR.B.DTF=1;
 }
 
@@ -885,49 +907,380 @@ void LINFLEX_SendHeaderLIN (vuint8_t nbLINFlex, uint8_t nbBytes, uint8_t ID)
 *					LINFLEX.h
 * 	@par Description: 
 *					This function sends a word consisted of several Bytes via UART.
+*					Bytes are stored into the Tx ring buffer and sent by the 
+*					LINFLEX_IsrTxUART interrupt routine.
 *	@param[in] nbLINFlex -  Number of LINFlex module (0 or 1).
 *	@param[in] p_string -  Pointer to the array of Bytes to be sent.
 *	@param[in] length -  Number of Bytes to be sent.
-*	@remarks 	Function blocks UART as a resource, this could block execution 
-*				of the main routines if longer frames are sent.
+*	@remarks 	Function waits only if the Tx ring buffer is full. Only the 
+*				LINFLEX_UART_NB module owns a Tx ring buffer, other modules are 
+*				served by the blocking LINFLEX_SendUART function under the 
+*				INT_CEIL_UART_PRIORITY ceiling.
 ********************************************************************************/
 void LINFLEX_SendWordUART(vuint8_t nbLINFlex, uint8_t* p_string, uint8_t length){
-	int i = 0;
+	uint32_t sent = 0;
 	unsigned char data[4];
-	uint32_t stockPriority = 0;
-	stockPriority = INTC_0.CPR0.B.PRI;		//save current priority
-	INTC_0.CPR0.B.PRI = INT_CEIL_UART_PRIORITY;	//block UART resource
-	
-	for(i=0;i<length;i+=4){
-		data[0] = p_string[i];
-		if(length > (i+1)){
-			data[1] = p_string[i+1];
-			if(length > (i+2)){
-				data[2] = p_string[i+2];
-					if(length > (i+3)){
-						data[3] = p_string[i+3];
-						LINFLEX_SendUART(nbLINFlex,data,4);
-					}else
-					{
-						LINFLEX_SendUART(nbLINFlex,data,3);	
-					}
-					
-			}else
-			{
-				LINFLEX_SendUART(nbLINFlex,data,2);
-			}
-			
-		}else
+	uint32_t i;
+	uint32_t stockPriority;
+
+	if (nbLINFlex == LINFLEX_UART_NB)
+	{
+		while (sent < length)
 		{
-			LINFLEX_SendUART(nbLINFlex,data,1);
+			sent += LINFLEX_WriteUART(nbLINFlex, p_string + sent, length - sent);
 		}
-			
+		return;
+	}
+
+	stockPriority = INTC_0.CPR0.B.PRI;			//save current priority
+	if (stockPriority < INT_CEIL_UART_PRIORITY)
+	{
+		INTC_0.CPR0.B.PRI = INT_CEIL_UART_PRIORITY;	//block UART resource
+	}
+	for (sent = 0; sent < length; sent += 4)
+	{
+		for (i = 0; (i < 4) && ((sent + i) < length); i++)
+		{
+			data[i] = p_string[sent + i];
+		}
+		LINFLEX_SendUART(nbLINFlex, data, i);
 	}
-	
 	INTC_0.CPR0.B.PRI = stockPriority;			//release UART resource
 }
 
+/***************************************************************************//*!
+*   @brief The function LINFLEX_LoadTxChunk loads next Bytes from the Tx ring 
+*			buffer into the UART buffer.
+*	@par Include: 
+*					LINFLEX.h
+* 	@par Description: 
+*					This function moves up to 4 Bytes from the Tx ring buffer into
+*					the BDRL register and starts their transmission. If the ring 
+*					buffer is empty, the Tx interrupt is disabled and the 
+*					transmitter is marked as idle.
+*	@param[in] nbLINFlex -  Number of LINFlex module (0 or 1).
+*	@remarks 	Called with the Tx interrupt blocked (from LINFLEX_IsrTxUART or
+*				from LINFLEX_WriteUART under the INT_UART_TX_PRIORITY ceiling).
+********************************************************************************/
+static RAM_TEXT void LINFLEX_LoadTxChunk(vuint8_t nbLINFlex)
+{
+	uint32_t tail;
+	uint32_t count;
+	uint32_t word = 0;
+	uint32_t i;
+
+	tail = LINFLEXtxRing.tail;
+	count = LINFLEXtxRing.head - tail;
+	if (count == 0)
+	{
+		LINFLEX[nbLINFlex]->LINIER.B.DTIE = 0;
+		LINFLEXtxRing.busy = 0;
+		return;
+	}
+	if (count > 4)
+	{
+		count = 4;
+	}
+	for (i = 0; i < count; i++)
+	{
+		word |= (uint32_t)LINFLEXtxRing.data[(tail + i) & (LINFLEX_UART_TX_BUFFER_SIZE - 1)] << (8 * i);
+	}
+	LINFLEXtxRing.tail = tail + count;			//space released before the transmission ends
+	LINFLEXtxRing.bytesSent += count;
+
+	LINFLEX[nbLINFlex]->UARTCR.B.TDFL_TFC = count - 1;
+	LINFLEX[nbLINFlex]->BDRL.R = word;
+}
 
+/***************************************************************************//*!
+*   @brief The function LINFLEX_WriteUART stores data into the UART Tx ring 
+*			buffer.
+*	@par Include: 
+*					LINFLEX.h
+* 	@par Description: 
+*					This function copies as many Bytes as fit into the Tx ring 
+*					buffer and returns immediately. If the transmitter is idle, 
+*					the first chunk is loaded and the Tx interrupt (DTIE) is 
+*					enabled; the remaining Bytes are sent by LINFLEX_IsrTxUART.
+*	@param[in] nbLINFlex -  Number of LINFlex module (LINFLEX_UART_NB).
+*	@param[in] p_tx -  Pointer to the data to be sent.
+*	@param[in] nbBytes -  Number of Bytes to be sent.
+*	@return 	Number of Bytes accepted by the ring buffer (0 - nbBytes).
+*	@remarks 	Single producer: the function shall be called from one 
+*				priority level only. Do not mix with LINFLEX_SendUART on the 
+*				same module while the ring buffer is not empty.
+*	@par Code sample
+*			LINFLEX_WriteUART(LINFLEX_UART_NB, frame, 12);
+*			- Queues 12 Bytes for transmission and returns.
+********************************************************************************/
+uint32_t LINFLEX_WriteUART(vuint8_t nbLINFlex, const uint8_t* p_tx, uint32_t nbBytes)
+{
+	uint32_t head;
+	uint32_t space;
+	uint32_t i;
+	uint32_t stockPriority;
+
+	head = LINFLEXtxRing.head;
+	space = LINFLEX_UART_TX_BUFFER_SIZE - (head - LINFLEXtxRing.tail);
+	if (nbBytes > space)
+	{
+		nbBytes = space;
+		LINFLEXtxRing.overflows++;
+	}
+	for (i = 0; i < nbBytes; i++)
+	{
+		LINFLEXtxRing.data[(head + i) & (LINFLEX_UART_TX_BUFFER_SIZE - 1)] = p_tx[i];
+	}
+	LINFLEXtxRing.head = head + nbBytes;		//publish data to the ISR
+
+	if (LINFLEXtxRing.busy == 0)
+	{
+		stockPriority = INTC_0.CPR0.B.PRI;
+		if (stockPriority < INT_UART_TX_PRIORITY)
+		{
+			INTC_0.CPR0.B.PRI = INT_UART_TX_PRIORITY;	//block Tx ISR
+		}
+		if (LINFLEXtxRing.busy == 0)
+		{
+			LINFLEXtxRing.busy = 1;
+			LINFLEX[nbLINFlex]->UARTSR.R = LINFLEX_UARTSR_DTF;		//w1c
+			LINFLEX_LoadTxChunk(nbLINFlex);
+			LINFLEX[nbLINFlex]->LINIER.B.DTIE = 1;
+		}
+		INTC_0.CPR0.B.PRI = stockPriority;
+	}
+
+	return nbBytes;
+}
+
+/***************************************************************************//*!
+*   @brief The function LINFLEX_IsrTxUART is the UART data transmitted 
+*			interrupt routine.
+*	@par Include: 
+*					LINFLEX.h
+* 	@par Description: 
+*					This function clears the DTF flag and loads the next chunk 
+*					(up to 4 Bytes) from the Tx ring buffer. When the ring buffer 
+*					is empty the Tx interrupt is disabled.
+*	@remarks 	Vector #381 (LINFlex_1 TXI) for LINFLEX_UART_NB = 1. One 
+*				interrupt per 4 Bytes, i.e. each 47.7 us at 921600 Bd with
+*				parity, so the CPU stays free during the whole transmission
+*				except for the interrupt routine itself.
+********************************************************************************/
+RAM_TEXT void LINFLEX_IsrTxUART(void)
+{
+	LINFLEX[LINFLEX_UART_NB]->UARTSR.R = LINFLEX_UARTSR_DTF;		//w1c
+	LINFLEXtxRing.isrCount++;
+	LINFLEX_LoadTxChunk(LINFLEX_UART_NB);
+}
+
+/***************************************************************************//*!
+*   @brief The function LINFLEX_GetTxFreeUART returns free space of the Tx 
+*			ring buffer.
+*	@par Include: 
+*					LINFLEX.h
+*	@return 	Number of Bytes that can be written by LINFLEX_WriteUART 
+*				without truncation.
+********************************************************************************/
+uint32_t LINFLEX_GetTxFreeUART(void)
+{
+	return LINFLEX_UART_TX_BUFFER_SIZE - (LINFLEXtxRing.head - LINFLEXtxRing.tail);
+}
+
+/***************************************************************************//*!
+*   @brief The function LINFLEX_PushRxBytes stores received Bytes into the Rx 
+*			ring buffer.
+*	@par Include: 
+*					LINFLEX.h
+* 	@par Description: 
+*					This function copies nbBytes from the BDRM register value into 
+*					the Rx ring buffer. Bytes that do not fit are dropped and 
+*					counted as ring overruns.
+*	@param[in] data -  BDRM register content (first Byte on the LSB).
+*	@param[in] nbBytes -  Number of valid Bytes (1 - 4).
+*	@remarks 	Used by LINFLEX_IsrRxUART only (single producer).
+********************************************************************************/
+static RAM_TEXT void LINFLEX_PushRxBytes(uint32_t data, uint32_t nbBytes)
+{
+	uint32_t head;
+	uint32_t fill;
+	uint32_t i;
+
+	head = LINFLEXrxRing.head;
+	for (i = 0; i < nbBytes; i++)
+	{
+		if ((head - LINFLEXrxRing.tail) >= LINFLEX_UART_RX_RING_SIZE)
+		{
+			LINFLEXrxRing.ringOverruns += nbBytes - i;		//consumer too slow
+			break;
+		}
+		LINFLEXrxRing.data[head & (LINFLEX_UART_RX_RING_SIZE - 1)] = (uint8_t)(data >> (8 * i));
+		head++;
+	}
+	LINFLEXrxRing.head = head;				//publish data to the consumer
+	LINFLEXrxRing.bytesReceived += i;
+
+	fill = head - LINFLEXrxRing.tail;
+	if (fill > LINFLEXrxRing.maxFill)
+	{
+		LINFLEXrxRing.maxFill = fill;
+	}
+}
+
+/***************************************************************************//*!
+*   @brief The function LINFLEX_IsrRxUART is the UART receive interrupt 
+*			routine.
+*	@par Include: 
+*					LINFLEX.h
+* 	@par Description: 
+*					On DRF the whole UART buffer (LINFLEX_UART_RX_BUFFER_SIZE 
+*					Bytes) is moved into the Rx ring buffer. On the timeout flag 
+*					(line idle for LINFLEX_UART_RX_IDLE_BITS bit times) the 
+*					partially filled buffer is flushed and the end of the frame 
+*					is recorded, also when DRF is pending in the same call (the 
+*					frame ends with a full buffer). Buffer overrun, framing and 
+*					parity errors are counted.
+*	@remarks 	Vector #380 (LINFlex_1 RXI) for LINFLEX_UART_NB = 1. Runs at 
+*				INT_UART_RX_PRIORITY above INT_CEIL_PRIORITY so the FS65 SPI 
+*				transactions do not delay it, shall not use the DSPI.
+********************************************************************************/
+RAM_TEXT void LINFLEX_IsrRxUART(void)
+{
+	uint32_t status;
+	uint32_t count;
+	uint32_t frameHead;
+
+	status = LINFLEX[LINFLEX_UART_NB]->UARTSR.R;
+
+	if (status & LINFLEX_UARTSR_BOF)
+	{
+		LINFLEXrxRing.hwOverruns++;				//Byte lost in the UART buffer
+	}
+	if (status & LINFLEX_UARTSR_FEF)
+	{
+		LINFLEXrxRing.framingErrors++;
+	}
+	if (status & LINFLEX_UARTSR_PE)
+	{
+		LINFLEXrxRing.parityErrors++;
+	}
+
+	if (status & LINFLEX_UARTSR_DRF)
+	{
+		LINFLEX_PushRxBytes(LINFLEX[LINFLEX_UART_NB]->BDRM.R, LINFLEX_UART_RX_BUFFER_SIZE);
+	}
+	if (status & LINFLEX_UARTSR_TO)
+	{
+		//Idle line: flush Bytes received since the last DRF (none if DRF was pending too)
+		count = (status & LINFLEX_UARTSR_DRF) ? 0 : LINFLEX[LINFLEX_UART_NB]->LINSR.B.RDC;
+		if (count != 0)
+		{
+			LINFLEX_PushRxBytes(LINFLEX[LINFLEX_UART_NB]->BDRM.R, count);
+			LINFLEXrxRing.idleFlushes++;
+		}
+		frameHead = LINFLEXrxRing.frameHead;
+		if ((frameHead - LINFLEXrxRing.frameTail) < LINFLEX_UART_RX_FRAMES)
+		{
+			LINFLEXrxRing.frameEnd[frameHead & (LINFLEX_UART_RX_FRAMES - 1)] = LINFLEXrxRing.head;
+			LINFLEXrxRing.frameHead = frameHead + 1;
+		}
+	}
+
+	//w1c: clear handled flags and release the message buffer
+	LINFLEX[LINFLEX_UART_NB]->UARTSR.R = status & (LINFLEX_UARTSR_BOF | LINFLEX_UARTSR_FEF | 
+			LINFLEX_UARTSR_PE | LINFLEX_UARTSR_DRF | LINFLEX_UARTSR_TO | LINFLEX_UARTSR_RMB);
+}
+
+/***************************************************************************//*!
+*   @brief The function LINFLEX_ReadRxRing reads received Bytes from the Rx 
+*			ring buffer.
+*	@par Include: 
+*					LINFLEX.h
+* 	@par Description: 
+*					This function copies up to maxBytes received Bytes into the 
+*					user buffer without any regard to the frame boundaries.
+*	@param[out] p_rx -  Destination buffer.
+*	@param[in] maxBytes -  Size of the destination buffer.
+*	@return 	Number of Bytes copied.
+*	@remarks 	Single consumer: shall be called from one priority level only.
+********************************************************************************/
+uint32_t LINFLEX_ReadRxRing(uint8_t* p_rx, uint32_t maxBytes)
+{
+	uint32_t tail;
+	uint32_t count;
+	uint32_t i;
+
+	tail = LINFLEXrxRing.tail;
+	count = LINFLEXrxRing.head - tail;
+	if (count > maxBytes)
+	{
+		count = maxBytes;
+	}
+	for (i = 0; i < count; i++)
+	{
+		p_rx[i] = LINFLEXrxRing.data[(tail + i) & (LINFLEX_UART_RX_RING_SIZE - 1)];
+	}
+	LINFLEXrxRing.tail = tail + count;		//release space to the ISR
+
+	//drop frame marks already consumed
+	while ((LINFLEXrxRing.frameTail != LINFLEXrxRing.frameHead) && 
+			((int32_t)(LINFLEXrxRing.frameEnd[LINFLEXrxRing.frameTail & (LINFLEX_UART_RX_FRAMES - 1)] - (tail + count)) <= 0))
+	{
+		LINFLEXrxRing.frameTail++;
+	}
+
+	return count;
+}
+
+/***************************************************************************//*!
+*   @brief The function LINFLEX_ReadFrameUART reads one idle-line delimited 
+*			frame from the Rx ring buffer.
+*	@par Include: 
+*					LINFLEX.h
+* 	@par Description: 
+*					If at least one complete frame (Bytes followed by an idle 
+*					line) is available, the function copies it into the user 
+*					buffer. Bytes exceeding maxBytes are discarded.
+*	@param[out] p_rx -  Destination buffer.
+*	@param[in] maxBytes -  Size of the destination buffer.
+*	@return 	Length of the frame, 0 if no complete frame is available.
+*	@remarks 	Single consumer: shall be called from one priority level only.
+*	@par Code sample
+*			length = LINFLEX_ReadFrameUART(cmd, sizeof(cmd));
+********************************************************************************/
+uint32_t LINFLEX_ReadFrameUART(uint8_t* p_rx, uint32_t maxBytes)
+{
+	uint32_t tail;
+	uint32_t length;
+	uint32_t i;
+
+	if (LINFLEXrxRing.frameTail == LINFLEXrxRing.frameHead)
+	{
+		return 0;
+	}
+	tail = LINFLEXrxRing.tail;
+	length = LINFLEXrxRing.frameEnd[LINFLEXrxRing.frameTail & (LINFLEX_UART_RX_FRAMES - 1)] - tail;
+	for (i = 0; (i < length) && (i < maxBytes); i++)
+	{
+		p_rx[i] = LINFLEXrxRing.data[(tail + i) & (LINFLEX_UART_RX_RING_SIZE - 1)];
+	}
+	LINFLEXrxRing.tail = tail + length;
+	LINFLEXrxRing.frameTail++;
+
+	return i;
+}
+
+/***************************************************************************//*!
+*   @brief The function LINFLEX_GetRxCountUART returns number of Bytes waiting
+*			in the Rx ring buffer.
+*	@par Include: 
+*					LINFLEX.h
+*	@return 	Number of received Bytes not read yet.
+********************************************************************************/
+uint32_t LINFLEX_GetRxCountUART(void)
+{
+	return LINFLEXrxRing.head - LINFLEXrxRing.tail;
+}
 
 /***************************************************************************//*!
 *   @brief The function LINFLEX_ReadLIN reads data previously received via LIN.
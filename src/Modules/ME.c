@@ -52,13 +52,18 @@ Revision History:
                              Modification     Function
 Author (core ID)              Date D/M/Y       Name		  Description of Changes
 B35993		 				  31/07/2014 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   MC_MODE_INIT	  PLL and clock dividers taken from CLOCK.h
+BRNY001					      19/10/2026 	   MC_MODE_INIT	  Time-bounded mode transition waits (TIME_WAIT)
+BRNY001					      19/10/2026 	   MC_MODE_INIT	  Timed out mode transition returned as ME_RETURN_ERROR
 
 ---------------------------   ----------    ------------  ------------------------------------------
 ==================================================================================================*/
 
 #include "MPC5744P_drv.h"
+#include "CLOCK.h"
 #include "ME.h"
 #include "FCCU.h"
+#include "TIME.h"
 
 /***************************************************************************//*!
 *   @brief The function MC_MODE_INIT initializes Mode Entry Module (ME).
@@ -68,9 +73,16 @@ B35993		 				  31/07/2014 	   ALL		  Driver created
 *					This function makes a basic initialization of oscillators 
 *					and peripherals. After the necessary initialization, the MCU 
 *					goes into the DRUN mode.
-*	@remarks 	
+*	@return 	ME_RETURN_OK - DRUN entered on PLL1, ME_RETURN_ERROR - a mode
+*				transition timed out. The function stops at the first timeout:
+*				without a stable XOSC the PLLs are not configured and the MCU
+*				keeps running on the IRCOSC.
+*	@remarks 	The waits are bounded by TIME_TIMEOUT_ME_MODE_US (time base
+*				started by TIME_Init), timeouts are counted in
+*				TIMEwait[TIME_WAIT_ME_MODE]. The caller shall go to a safe
+*				state on ME_RETURN_ERROR (clocks of the peripherals unknown).
 ********************************************************************************/
-void MC_MODE_INIT(void)
+uint32_t MC_MODE_INIT(void)
 {
     /* Enable All Modes */
     MC_ME.ME.R = 0x000005E2;                        
@@ -89,9 +101,12 @@ void MC_MODE_INIT(void)
     /* RE enter the DRUN mode, to update the configuration */
     MC_ME.MCTL.R = 0x30005AF0;                      /* Mode & Key */
     MC_ME.MCTL.R = 0x3000A50F;                      /* Mode & Key inverted */
-    while(MC_ME.GS.B.S_MTRANS == 1);                /* Wait for mode entry to complete */
-    while(MC_ME.GS.B.S_CURRENT_MODE != 0x3);        /* Check DRUN mode has been entered */
-    while(!MC_ME.GS.B.S_XOSC);                      /* Wait for clock to stabilise */
+    if ((TIME_WAIT(TIME_WAIT_ME_MODE, TIME_TIMEOUT_ME_MODE_US, MC_ME.GS.B.S_MTRANS == 0) != TIME_WAIT_OK) ||         /* Wait for mode entry to complete */
+        (TIME_WAIT(TIME_WAIT_ME_MODE, TIME_TIMEOUT_ME_MODE_US, MC_ME.GS.B.S_CURRENT_MODE == 0x3) != TIME_WAIT_OK) ||  /* Check DRUN mode has been entered */
+        (TIME_WAIT(TIME_WAIT_ME_MODE, TIME_TIMEOUT_ME_MODE_US, MC_ME.GS.B.S_XOSC != 0) != TIME_WAIT_OK))              /* Wait for clock to stabilise */
+    {
+        return ME_RETURN_ERROR;
+    }
     
     /******************** PLL0, PLL1 **********************/
   
@@ -112,10 +127,10 @@ void MC_MODE_INIT(void)
         fPLL0_PHI1 = fPLL0_ref x PLL0DV[MFD] / (PLL0DV[PREDIV] x PLL0DV[RFDPHI1])
                    = 40MHz x 8 / (1 x 8) = 40 MHz                   
     */
-    PLLDIG.PLL0DV.B.RFDPHI1 = 8; 
-    PLLDIG.PLL0DV.B.RFDPHI = 2;
-    PLLDIG.PLL0DV.B.PREDIV = 1;
-    PLLDIG.PLL0DV.B.MFD = 8;
+    PLLDIG.PLL0DV.B.RFDPHI1 = CLOCK_PLL0_RFDPHI1; 
+    PLLDIG.PLL0DV.B.RFDPHI = CLOCK_PLL0_RFDPHI;
+    PLLDIG.PLL0DV.B.PREDIV = CLOCK_PLL0_PREDIV;
+    PLLDIG.PLL0DV.B.MFD = CLOCK_PLL0_MFD;
 
     /*
         Configure PLL1 Dividers for 200 MHz
@@ -127,8 +142,8 @@ void MC_MODE_INIT(void)
                   
 
     */    
-    PLLDIG.PLL1DV.B.RFDPHI = 2;                     
-    PLLDIG.PLL1DV.B.MFD = 20;    
+    PLLDIG.PLL1DV.B.RFDPHI = CLOCK_PLL1_RFDPHI;                     
+    PLLDIG.PLL1DV.B.MFD = CLOCK_PLL1_MFD;    
         
     /* Enable PLL0/PLL1 in DRUN mode and set PLL1 as SYS_CLK */
     MC_ME.DRUN_MC.R = 0x001300F4;
@@ -145,14 +160,14 @@ void MC_MODE_INIT(void)
     MC_CGM.AC0_SC.B.SELCTL = 2;                     /* source AC0 is PLL0 PHI */
     MC_CGM.AC0_DC0.R = 0x80000000;                  /* Aux clock select 0 divider 0 --> div by 1 (MOTC_CLK) */
     MC_CGM.AC0_DC1.R = 0x80070000;                  /* Aux clock select 0 divider 1 --> div by 8 (SWG_CLK) */
-    MC_CGM.AC0_DC2.R = 0x80010000;                  /* Aux clock select 0 divider 2 --> div by 2 (ADC_CLK) */
+    MC_CGM.AC0_DC2.R = 0x80000000 | ((CLOCK_ADC_DIV - 1) << 16);    /* Aux clock select 0 divider 2 --> div by 2 (ADC_CLK) */
 
     MC_CGM.AC1_DC0.R = 0x80010000;                  /* Aux clock select 1 divider 0 --> div by 2 (FRAY_PLL_CLK) */
     MC_CGM.AC1_DC1.R = 0x80030000;                  /* Aux clock select 1 divider 1 --> div by 4 (SENT_CLK) */
 
-    MC_CGM.AC2_DC0.R = 0x80030000;                  /* Aux clock select 2 divider 0 --> div by 4 (CAN_PLL_CLK) */
+    MC_CGM.AC2_DC0.R = 0x80000000 | ((CLOCK_CAN_DIV - 1) << 16);    /* Aux clock select 2 divider 0 --> div by 4 (CAN_PLL_CLK) */
     
-    MC_CGM.SC_DC0.R = 0x80030000;                   /* Sys clock select divider 0 --> div by 4 (PBRIDGEx_CLK) -> DSPI clock = 50MHz, PIT clock = 50 MHz */
+    MC_CGM.SC_DC0.R = 0x80000000 | ((CLOCK_PBRIDGE_DIV - 1) << 16); /* Sys clock select divider 0 --> div by 4 (PBRIDGEx_CLK) -> DSPI clock = 50MHz, PIT clock = 50 MHz */
 
     /******************** Start the core **********************/
     /* Main and checker cores running in RUN3:0, DRUN, SAFE, TEST modes */
@@ -166,7 +181,10 @@ void MC_MODE_INIT(void)
     MC_ME.MCTL.R = 0x30005AF0;                  /* Mode & Key */
     MC_ME.MCTL.R = 0x3000A50F;                  /* Mode & Key inverted */
   
-    while(MC_ME.GS.B.S_MTRANS == 1);            /* Wait for mode entry complete */
-    while(MC_ME.GS.B.S_CURRENT_MODE != 0x3);    /* Check DRUN mode entered */
-
+    if ((TIME_WAIT(TIME_WAIT_ME_MODE, TIME_TIMEOUT_ME_MODE_US, MC_ME.GS.B.S_MTRANS == 0) != TIME_WAIT_OK) ||         /* Wait for mode entry complete */
+        (TIME_WAIT(TIME_WAIT_ME_MODE, TIME_TIMEOUT_ME_MODE_US, MC_ME.GS.B.S_CURRENT_MODE == 0x3) != TIME_WAIT_OK))    /* Check DRUN mode entered */
+    {
+        return ME_RETURN_ERROR;
+    }
+    return ME_RETURN_OK;
 }
@@ -52,6 +52,8 @@ Revision History:
                              Modification     Function
 Author (core ID)              Date D/M/Y       Name		  Description of Changes
 B35993		 				  29/07/2014 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   PIT_wait_micsec	  Channel stopped after the wait
+BRNY001					      19/10/2026 	   PIT_wait_micsec	  Empty polling loop body (-Wextra)
 
 ---------------------------   ----------    ------------  ------------------------------------------
 ==================================================================================================*/
@@ -252,8 +254,9 @@ void PIT_wait_micsec(uint32_t duration)
     PIT_ClearFlag(2);
     PIT_Setup(2,PIT_CLK/1000000,duration);
     PIT_EnableChannel(2);
-    do;
-    while (PIT_GetFlag(2)==0);
+    while (PIT_GetFlag(2)==0){
+    }
+    PIT_DisableChannel(2);		//no periodic expiry left behind
 }
     
 
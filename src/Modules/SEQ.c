@@ -0,0 +1,197 @@
+/*******************************************************************************
+*
+* Freescale Semiconductor Inc.
+* (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+* ALL RIGHTS RESERVED.
+*
+********************************************************************************
+*
+* $File Name:       SEQ.c$
+* @file             SEQ.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Sequence lock source file
+* @brief            Sequence lock source file
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/****************************************************************************//*!
+*
+*  @mainpage Sequence lock for MPC5744P
+*
+*  @section Intro Introduction
+*
+*	This package contains the writer and reader side of the sequence lock.
+*	The outermost writer makes the sequence odd by a compare and swap and
+*	even again at its end; a writer preempting it finds the sequence odd and
+*	leaves it, so the odd period covers all nested writers. A reader
+*	preempting a writer cannot wait for it: it gets SEQ_BUSY.
+*
+*  The key features of this package are the following:
+*  - Two sequence accesses per write, one copy per read without conflict
+*  - Host build (SEQ_HOST) for the stress test Host/SEQ
+*
+*  For more information about the functions and configuration items see these documents:
+*
+*******************************************************************************
+*
+* @attention
+*
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : MPC5744P
+*   Dependencies         : MPC5744P - Basic SW drivers.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Driver created
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#ifdef SEQ_HOST
+#include "typedefs.h"
+#else
+#include "MPC5744P_drv.h"
+#endif
+#include "SEQ.h"
+
+/***************************************************************************//*!
+*   @brief The function SEQ_WriteBegin starts an update of the protected data.
+*	@par Include
+*					SEQ.h
+* 	@par Description
+*					If no write is in progress, the sequence is made odd.
+*	@param[in] p_lock - Sequence lock of the data.
+*	@return Token for SEQ_WriteEnd: 1 - outermost writer, 0 - nested writer.
+*	@remarks 	Callable from any context, the update shall not wait for a
+*				lower priority.
+*	@par Code sample
+*			token = SEQ_WriteBegin(&FS65_RegistersLock);
+*			...
+*			SEQ_WriteEnd(&FS65_RegistersLock, token);
+********************************************************************************/
+uint32_t SEQ_WriteBegin(SEQ_Lock *p_lock)
+{
+	uint32_t sequence;
+
+	for (;;)
+	{
+		sequence = p_lock->sequence;
+		if ((sequence & 1) != 0)
+		{
+			return 0;					//preempted writer already made it odd
+		}
+		if (__sync_bool_compare_and_swap(&p_lock->sequence, sequence, sequence + 1))
+		{
+			return 1;
+		}
+		//a preempting writer completed between the read and the swap
+	}
+}
+
+/***************************************************************************//*!
+*   @brief The function SEQ_WriteEnd ends an update of the protected data.
+*	@par Include
+*					SEQ.h
+*	@param[in] p_lock - Sequence lock of the data.
+*	@param[in] token - Value returned by SEQ_WriteBegin.
+********************************************************************************/
+void SEQ_WriteEnd(SEQ_Lock *p_lock, uint32_t token)
+{
+	if (token != 0)
+	{
+		p_lock->sequence++;				//even, nested writers do not touch an odd sequence
+	}
+}
+
+/***************************************************************************//*!
+*   @brief The function SEQ_ReadBegin starts a read of protected data.
+*	@par Include
+*					SEQ.h
+*	@param[in] p_lock - Sequence lock of the data.
+*	@return Sequence to be passed to SEQ_ReadValid.
+*	@remarks 	For copies of several data items under one lock, see
+*				SEQ_Read for a single item.
+*	@par Code sample
+*			do
+*			{
+*				sequence = SEQ_ReadBegin(&lock);
+*				copyA = dataA;
+*				copyB = dataB;
+*			}
+*			while (SEQ_ReadValid(&lock, sequence) == 0);
+********************************************************************************/
+uint32_t SEQ_ReadBegin(const SEQ_Lock *p_lock)
+{
+	return p_lock->sequence;
+}
+
+/***************************************************************************//*!
+*   @brief The function SEQ_ReadValid checks a read of protected data.
+*	@par Include
+*					SEQ.h
+*	@param[in] p_lock - Sequence lock of the data.
+*	@param[in] sequence - Value returned by SEQ_ReadBegin.
+*	@return 1 - the copies are consistent, 0 - to be repeated.
+********************************************************************************/
+uint32_t SEQ_ReadValid(const SEQ_Lock *p_lock, uint32_t sequence)
+{
+	return (((sequence & 1) == 0) && (p_lock->sequence == sequence)) ? 1 : 0;
+}
+
+/***************************************************************************//*!
+*   @brief The function SEQ_Read copies a consistent view of protected data.
+*	@par Include
+*					SEQ.h
+* 	@par Description
+*					The data are copied word by word between two reads of the
+*					sequence. The copy is valid if the sequence was even and
+*					did not change, else it is repeated (SEQ_RETRIES times).
+*	@param[in] p_lock - Sequence lock of the data.
+*	@param[in] p_source - Protected data (32-bit aligned).
+*	@param[out] p_copy - Copy of the data (32-bit aligned).
+*	@param[in] size - Size [Bytes], multiple of 4.
+*	@return SEQ_OK / SEQ_BUSY (p_copy not consistent).
+*	@remarks 	Never blocks the writers. A reader preempting a writer (higher
+*				priority) gets SEQ_BUSY.
+*	@par Code sample
+*			SEQ_Read(&FS65_VoltagesLock, &ADCstruct.actualVoltage, &voltages, sizeof(voltages));
+********************************************************************************/
+uint32_t SEQ_Read(const SEQ_Lock *p_lock, const volatile void *p_source, void *p_copy, uint32_t size)
+{
+	const vuint32_t *p_src = (const vuint32_t *)p_source;
+	uint32_t *p_dst = (uint32_t *)p_copy;
+	uint32_t sequence;
+	uint32_t retry;
+	uint32_t i;
+
+	for (retry = 0; retry < SEQ_RETRIES; retry++)
+	{
+		sequence = SEQ_ReadBegin(p_lock);
+		if ((sequence & 1) != 0)
+		{
+			continue;					//reader preempting a writer
+		}
+		for (i = 0; i < size / 4; i++)
+		{
+			p_dst[i] = p_src[i];
+		}
+		if (SEQ_ReadValid(p_lock, sequence) != 0)
+		{
+			return SEQ_OK;
+		}
+	}
+	return SEQ_BUSY;
+}
@@ -54,6 +54,7 @@ Revision History:
                              Modification     Function
 Author (core ID)              Date D/M/Y       Name		  Description of Changes
 B35993		 				  29/07/2014 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   SIUL_AnalogInput	  Additional configuration applied
 
 ---------------------------   ----------    ------------  ------------------------------------------
 ==================================================================================================*/
@@ -217,7 +218,7 @@ void SIUL_DigitalInputSimple(uint8_t pad, uint32_t config)
 ********************************************************************************/
 void SIUL_AnalogInput(uint8_t pad, uint32_t config)
 {
-    SIUL2.MSCR[pad].R = SIUL_ANALOG | 0x10000000;
+    SIUL2.MSCR[pad].R = SIUL_ANALOG | 0x10000000 | config;
 }
 
 /***************************************************************************//*!
@@ -0,0 +1,230 @@
+/*******************************************************************************
+*
+* Freescale Semiconductor Inc.
+* (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+* ALL RIGHTS RESERVED.
+*
+********************************************************************************
+*
+* $File Name:       SPITRACE.c$
+* @file             SPITRACE.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      SPI transaction trace source file
+* @brief            SPI transaction trace source file
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/****************************************************************************//*!
+*
+*  @mainpage SPI transaction trace for MPC5744P
+*
+*  @section Intro Introduction
+*
+*	This package contains the buffer of the DSPI frame trace and its export.
+*	The records are written by the DSPI driver while the caller owns the
+*	DSPI resource (priority ceiling), so two writers never interleave: the
+*	writer claims SPITRACEhead, fills the record and writes its sequence
+*	number last. A reader of any priority copies a record and checks its
+*	sequence number, like TRACE_Copy.
+*
+*  The key features of this package are the following:
+*  - Buffer and counters in the local data RAM (single cycle access)
+*  - Export of one record per call on CAN, paced by the caller
+*
+*  For more information about the functions and configuration items see these documents:
+*
+*******************************************************************************
+*
+* @attention
+*
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : MPC5744P
+*   Dependencies         : MPC5744P - Basic SW drivers.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   SPITRACE_Init	  Buffer cleared by the startup code (DRAM_BSS)
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#include "MPC5744P_drv.h"
+#include "TIME.h"
+#include "TRACE.h"
+#include "CAN.h"
+#include "SPITRACE.h"
+
+#if SPITRACE_ENABLE
+
+#define SPITRACE_CAN_ID_STEP	(1UL << 18)		///next standard identifier (MB ID register)
+
+DRAM_BSS SPITRACE_Record SPITRACEbuffer[SPITRACE_SIZE];
+DRAM_BSS vuint32_t SPITRACEhead;
+DRAM_BSS uint32_t SPITRACEsite;
+
+/***************************************************************************//*!
+*   @brief The function SPITRACE_Init clears the SPI trace.
+*	@par Include
+*					SPITRACE.h
+* 	@par Description
+*					Restarts the trace: counter and sequence numbers of the
+*					records (.dram_bss is cleared by the startup code only).
+*	@remarks 	Shall be called before the first DSPI transfer.
+*	@par Code sample
+*			SPITRACE_Init();
+********************************************************************************/
+void SPITRACE_Init(void)
+{
+	uint32_t i;
+
+	for (i = 0; i < SPITRACE_SIZE; i++)
+	{
+		SPITRACEbuffer[i].sequence = (uint16_t)(i - SPITRACE_SIZE);	//not the number of its first record
+	}
+	SPITRACEsite = 0;
+	SPITRACEhead = 0;
+}
+
+/***************************************************************************//*!
+*   @brief The function SPITRACE_Add records one DSPI frame.
+*	@par Include
+*					SPITRACE.h
+*	@param[in] dspi - DSPI module number.
+*	@param[in] tx - Sent word.
+*	@param[in] rx - Received word.
+*	@param[in] flags - SPITRACE_FLAG_BATCH, SPITRACE_FLAG_NO_ANSWER.
+*	@remarks 	Called by the DSPI driver, the caller owns the DSPI resource.
+********************************************************************************/
+void SPITRACE_Add(uint32_t dspi, uint32_t tx, uint32_t rx, uint32_t flags)
+{
+	uint32_t sequence = SPITRACEhead;
+	SPITRACE_Record *p_record = &SPITRACEbuffer[sequence & (SPITRACE_SIZE - 1)];
+
+	SPITRACEhead = sequence + 1;
+	p_record->time = TIME_ReadLow();
+	p_record->site = SPITRACEsite;
+	p_record->tx = (uint16_t)tx;
+	p_record->rx = (uint16_t)rx;
+	p_record->flags = (uint8_t)((flags & ~SPITRACE_FLAG_DSPI) | (dspi & SPITRACE_FLAG_DSPI));
+#if TRACE_ISR
+	p_record->depth = (uint8_t)TRACEdepth;
+#else
+	p_record->depth = 0;
+#endif
+	p_record->sequence = (uint16_t)sequence;
+}
+
+/***************************************************************************//*!
+*   @brief The function SPITRACE_Copy reads a record of the buffer.
+*	@par Include
+*					SPITRACE.h
+* 	@par Description
+*					The record is copied and then checked: it shall carry the
+*					requested sequence number and its slot shall not have been
+*					claimed by a newer record during the copy.
+*	@param[in] sequence - Record number.
+*	@param[out] p_record - Copy of the record.
+*	@return 1 - valid copy, 0 - record overwritten or not written yet.
+********************************************************************************/
+uint32_t SPITRACE_Copy(uint32_t sequence, SPITRACE_Record *p_record)
+{
+	*p_record = SPITRACEbuffer[sequence & (SPITRACE_SIZE - 1)];
+	return ((p_record->sequence == (uint16_t)sequence) && ((SPITRACEhead - sequence - 1) < SPITRACE_SIZE)) ? 1 : 0;
+}
+
+/***************************************************************************//*!
+*   @brief The function SPITRACE_Pack converts a record to its exported form.
+*	@par Include
+*					SPITRACE.h
+* 	@par Description
+*					SPITRACE_RECORD_SIZE Bytes, fields in the order of
+*					SPITRACE_Record, most significant Byte first.
+*	@param[in] p_record - Record.
+*	@param[out] p_dst - SPITRACE_RECORD_SIZE Bytes.
+********************************************************************************/
+void SPITRACE_Pack(const SPITRACE_Record *p_record, uint8_t *p_dst)
+{
+	p_dst[0] = (uint8_t)(p_record->time >> 24);
+	p_dst[1] = (uint8_t)(p_record->time >> 16);
+	p_dst[2] = (uint8_t)(p_record->time >> 8);
+	p_dst[3] = (uint8_t)p_record->time;
+	p_dst[4] = (uint8_t)(p_record->site >> 24);
+	p_dst[5] = (uint8_t)(p_record->site >> 16);
+	p_dst[6] = (uint8_t)(p_record->site >> 8);
+	p_dst[7] = (uint8_t)p_record->site;
+	p_dst[8] = (uint8_t)(p_record->tx >> 8);
+	p_dst[9] = (uint8_t)p_record->tx;
+	p_dst[10] = (uint8_t)(p_record->rx >> 8);
+	p_dst[11] = (uint8_t)p_record->rx;
+	p_dst[12] = (uint8_t)(p_record->sequence >> 8);
+	p_dst[13] = (uint8_t)p_record->sequence;
+	p_dst[14] = p_record->flags;
+	p_dst[15] = p_record->depth;
+}
+
+/***************************************************************************//*!
+*   @brief The function SPITRACE_SendCAN sends one record on CAN.
+*	@par Include
+*					SPITRACE.h
+* 	@par Description
+*					The packed record is sent in two frames: Bytes 0 - 7 in
+*					the message buffer nbBuffer with the identifier id, Bytes
+*					8 - 15 in the buffer nbBuffer + 1 with the next standard
+*					identifier. A record already overwritten is skipped to the
+*					oldest record of the buffer.
+*	@param[in] nbModule - Number of the CAN module.
+*	@param[in] nbBuffer - First of the two message buffers.
+*	@param[in] id - Identifier of the first frame (see CAN_Send).
+*	@param[in] sequence - Number of the record to send.
+*	@return Number of the next record to send (SPITRACEhead if all are sent).
+*	@remarks 	The caller paces the calls (one record per main loop for
+*				example) so the previous frames of the buffers are sent.
+*	@par Code sample
+*			next = SPITRACE_SendCAN(0, 30, 0x1C000000, next);
+*			- Function sends record next on CAN 0, identifiers 0x700 and 0x701.
+********************************************************************************/
+uint32_t SPITRACE_SendCAN(uint8_t nbModule, uint8_t nbBuffer, uint32_t id, uint32_t sequence)
+{
+	SPITRACE_Record record;
+	uint8_t packed[SPITRACE_RECORD_SIZE];
+	uint64_t message[2] = {0, 0};
+	uint32_t head = SPITRACEhead;
+	uint32_t i;
+
+	if ((head - sequence) > SPITRACE_SIZE)
+	{
+		sequence = head - SPITRACE_SIZE;			//overwritten since the last call
+	}
+	if (sequence == head)
+	{
+		return head;
+	}
+	if (SPITRACE_Copy(sequence, &record) == 0)
+	{
+		return sequence;							//rewritten meanwhile, next call
+	}
+	SPITRACE_Pack(&record, packed);
+	for (i = 0; i < SPITRACE_RECORD_SIZE; i++)
+	{
+		message[i / 8] = (message[i / 8] << 8) | packed[i];
+	}
+	CAN_Send(nbModule, nbBuffer, message[0], id);
+	CAN_Send(nbModule, (uint8_t)(nbBuffer + 1), message[1], id + SPITRACE_CAN_ID_STEP);
+	return sequence + 1;
+}
+
+#endif
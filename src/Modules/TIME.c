@@ -0,0 +1,246 @@
+/*******************************************************************************
+*
+* Freescale Semiconductor Inc.
+* (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+* ALL RIGHTS RESERVED.
+*
+********************************************************************************
+*
+* $File Name:       TIME.c$
+* @file             TIME.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Monotonic timebase source file
+* @brief            Monotonic timebase source file
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/****************************************************************************//*!
+*
+*  @mainpage Monotonic timebase for MPC5744P
+*
+*  @section Intro Introduction
+*
+*	This package contains the 64-bit monotonic time source shared by the
+*	drivers. The core time base (TBU:TBL) is used: it counts at the system
+*	clock, it is read by two instructions and it needs no PIT channel (the
+*	PIT lifetime timer would chain the channels 0 and 1, both in use).
+*
+*  The key features of this package are the following:
+*  - Tearing-free 64-bit read (TBU read again after TBL)
+*  - Conversions with a 32-bit fast path for short intervals
+*  - Bounded driver waits: each call site keeps its number of waits and
+*    timeouts and its longest wait, so slow hardware handshakes are visible
+*    in TIMEwait
+*
+*  For more information about the functions and configuration items see these documents:
+*
+*******************************************************************************
+*
+* @attention
+*
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : MPC5744P
+*   Dependencies         : MPC5744P - Basic SW drivers.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   TIME_WaitDone	  Per call site wait statistics
+BRNY001					      19/10/2026 	   TIME_Read	  Simulated time base in the host build (MPC5744P_HOST)
+BRNY001					      19/10/2026 	   TIME_Init	  Time to main recorded (time base started by the startup code)
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#include "MPC5744P_drv.h"
+#include "TIME.h"
+
+#ifdef MPC5744P_HOST
+//supplied by the host tool (simulated time base)
+uint64_t TIME_PortRead(void);
+#else
+#define stringify(s) tostring(s)
+#define tostring(s) #s
+#define mfspr(rn) ({unsigned int rval; __asm__ volatile("mfspr %0," stringify(rn) : "=r" (rval)); rval;})
+#define mtspr(rn, v)   __asm__ volatile("mtspr " stringify(rn) ",%0" : : "r" (v))
+
+#define TIME_SPR_TBL_R		268				///time base lower word (read)
+#define TIME_SPR_TBU_R		269				///time base upper word (read)
+#define TIME_SPR_TBL_W		284				///time base lower word (write)
+#define TIME_SPR_TBU_W		285				///time base upper word (write)
+#define TIME_SPR_HID0		1008
+#define TIME_HID0_TBEN		0x00004000		///HID0 time base enable
+#endif
+
+CLOCK_ASSERT(time_ticks_per_us, (CLOCK_SYS_HZ % 1000000) == 0);
+
+TIME_WaitStats TIMEwait[TIME_WAIT_NB];
+uint32_t TIMEstartupTicks;
+
+/***************************************************************************//*!
+*   @brief The function TIME_Init starts the time base.
+*	@par Include
+*					TIME.h
+* 	@par Description
+*					If the time base is stopped, it is cleared and enabled
+*					(HID0[TBEN]). A running time base is left untouched, so the
+*					function may be called more than once. The startup code
+*					starts the time base at reset, its value at the first call
+*					is kept in TIMEstartupTicks (time to main in reset clock
+*					cycles).
+*	@remarks 	Shall be called first in main, before any driver wait. Until
+*				MC_MODE_INIT selects PLL1 the time base counts at the reset
+*				clock (16 MHz IRCOSC), so the waits of the clock setup last up
+*				to 12.5 times their nominal timeout. In the host build the
+*				simulated time base always runs.
+*	@par Code sample
+*			TIME_Init();
+********************************************************************************/
+void TIME_Init(void)
+{
+#ifndef MPC5744P_HOST
+	if ((mfspr(TIME_SPR_HID0) & TIME_HID0_TBEN) == 0)
+	{
+		mtspr(TIME_SPR_TBL_W, 0);
+		mtspr(TIME_SPR_TBU_W, 0);
+		mtspr(TIME_SPR_HID0, mfspr(TIME_SPR_HID0) | TIME_HID0_TBEN);
+	}
+	else if (TIMEstartupTicks == 0)
+	{
+		TIMEstartupTicks = mfspr(TIME_SPR_TBL_R);
+	}
+#endif
+}
+
+/***************************************************************************//*!
+*   @brief The function TIME_Read returns the 64-bit time.
+*	@par Include
+*					TIME.h
+* 	@par Description
+*					TBU is read again after TBL, a carry from TBL between the
+*					two reads of TBU repeats the read.
+*	@return Time base ticks since reset (started by the startup code) or
+*			since TIME_Init.
+*	@remarks 	Callable from any context.
+*	@par Code sample
+*			start = TIME_Read();
+*			...
+*			us = TIME_TicksToUs(TIME_Read() - start);
+********************************************************************************/
+uint64_t TIME_Read(void)
+{
+#ifdef MPC5744P_HOST
+	return TIME_PortRead();
+#else
+	uint32_t upper;
+	uint32_t lower;
+
+	do
+	{
+		upper = mfspr(TIME_SPR_TBU_R);
+		lower = mfspr(TIME_SPR_TBL_R);
+	}
+	while (upper != mfspr(TIME_SPR_TBU_R));
+
+	return (((uint64_t)upper) << 32) | lower;
+#endif
+}
+
+/***************************************************************************//*!
+*   @brief The function TIME_ReadLow returns the lower word of the time.
+*	@par Include
+*					TIME.h
+* 	@par Description
+*					Single read of TBL. The difference of two values is valid
+*					for intervals below 2^32 ticks (21 s at 200 MHz).
+*	@return Lower 32 bits of the time base.
+********************************************************************************/
+uint32_t TIME_ReadLow(void)
+{
+#ifdef MPC5744P_HOST
+	return (uint32_t)TIME_PortRead();
+#else
+	return mfspr(TIME_SPR_TBL_R);
+#endif
+}
+
+/***************************************************************************//*!
+*   @brief The function TIME_TicksToUs converts ticks to us.
+*	@par Include
+*					TIME.h
+*	@param[in] ticks - Time base ticks.
+*	@return Time [us], rounded down.
+*	@remarks 	Values below 2^32 use a 32-bit division.
+********************************************************************************/
+uint64_t TIME_TicksToUs(uint64_t ticks)
+{
+	if ((ticks >> 32) == 0)
+	{
+		return (uint32_t)ticks / TIME_TICKS_PER_US;
+	}
+	return ticks / TIME_TICKS_PER_US;
+}
+
+/***************************************************************************//*!
+*   @brief The function TIME_TicksToNs converts ticks to ns.
+*	@par Include
+*					TIME.h
+*	@param[in] ticks - Time base ticks (below 2^54).
+*	@return Time [ns], rounded down.
+*	@remarks 	A multiplication only if the tick period is a whole number of
+*				ns (5 ns at 200 MHz).
+********************************************************************************/
+uint64_t TIME_TicksToNs(uint64_t ticks)
+{
+#if (1000 % TIME_TICKS_PER_US) == 0
+	return ticks * (1000 / TIME_TICKS_PER_US);
+#else
+	return (ticks * 1000) / TIME_TICKS_PER_US;
+#endif
+}
+
+/***************************************************************************//*!
+*   @brief The function TIME_WaitDone records a finished wait.
+*	@par Include
+*					TIME.h
+* 	@par Description
+*					Called by TIME_WAIT. The statistics of the call site are
+*					updated: number of waits, number of timeouts, last and
+*					longest duration.
+*	@param[in] site - TIME_WAIT_xxx call site.
+*	@param[in] ticks - Duration of the wait [time base ticks].
+*	@param[in] done - 1 - condition met, 0 - timeout.
+*	@return TIME_WAIT_OK / TIME_WAIT_TIMEOUT.
+*	@remarks 	The statistics are not locked, a call site shall not be shared
+*				by contexts preempting each other.
+********************************************************************************/
+uint32_t TIME_WaitDone(uint32_t site, uint32_t ticks, uint32_t done)
+{
+	TIME_WaitStats *p_stats = &TIMEwait[site];
+
+	p_stats->count++;
+	p_stats->lastTicks = ticks;
+	if (ticks > p_stats->maxTicks)
+	{
+		p_stats->maxTicks = ticks;
+	}
+	if (done == 0)
+	{
+		p_stats->timeouts++;
+		return TIME_WAIT_TIMEOUT;
+	}
+	return TIME_WAIT_OK;
+}
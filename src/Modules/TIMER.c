@@ -0,0 +1,515 @@
+/*******************************************************************************
+*
+* Freescale Semiconductor Inc.
+* (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+* ALL RIGHTS RESERVED.
+*
+********************************************************************************
+*
+* $File Name:       TIMER.c$
+* @file             TIMER.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Software timer wheel source file
+* @brief            Software timer wheel source file
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/****************************************************************************//*!
+*
+*  @mainpage Software timer wheel for MPC5744P
+*
+*  @section Intro Introduction
+*
+*	This package contains software timers multiplexed on the PIT channel
+*	PIT_TIMER_CH. A running timer is linked into one slot of a hierarchical
+*	wheel (TIMER_LEVELS levels of TIMER_SLOTS slots). The level is given by
+*	the highest bit in which the deadline differs from the wheel time, the
+*	slot by the deadline bits of that level. A slot of the level 0 holds the
+*	timers of one exact us, a slot of an upper level is moved down (cascaded)
+*	when the wheel time reaches its beginning.
+*	The occupied slots are tracked by one 64-bit mask per level, so the
+*	nearest event is found without scanning the slots and the PIT channel is
+*	programmed as a one-shot to that event only.
+*	The time is read from the monotonic timebase (TIME.h) in us.
+*
+*  The key features of this package are the following:
+*  - One-shot and periodic timers with a callback
+*  - Constant time start and cancel (doubly linked slot lists)
+*  - Tickless, no interrupt between two events
+*  - Host build (TIMER_HOST) with port functions supplied by the host tool
+*
+*  For more information about the functions and configuration items see these documents:
+*
+*******************************************************************************
+*
+* @attention
+*
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : MPC5744P
+*   Dependencies         : MPC5744P - Basic SW drivers.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   TIMER_PortNow	  Time read from the TIME module
+BRNY001					      19/10/2026 	   TIMER_Start	  Empty wheel advanced to the current time (level overflow after a long idle)
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#ifdef TIMER_HOST
+#include "typedefs.h"
+#else
+#include "MPC5744P_drv.h"
+#include "PIT.h"
+#include "TIME.h"
+#endif
+#include "TIMER.h"
+
+#ifdef TIMER_HOST
+//supplied by the host tool
+uint64_t TIMER_PortNow(void);
+void TIMER_PortProgram(uint64_t);
+#endif
+
+TIMER_WheelStruct TIMERwheel;
+
+#ifndef TIMER_HOST
+/***************************************************************************//*!
+*   @brief The function TIMER_PortNow reads the time.
+*	@par Include
+*					TIMER.h
+*	@return Time [us].
+********************************************************************************/
+static uint64_t TIMER_PortNow(void)
+{
+	return TIME_TicksToUs(TIME_Read());
+}
+
+/***************************************************************************//*!
+*   @brief The function TIMER_PortProgram programs the wake-up interrupt.
+*	@par Include
+*					TIMER.h
+* 	@par Description
+*					The PIT channel PIT_TIMER_CH is restarted as a one-shot
+*					expiring at the deadline, or at most TIMER_MAX_SLEEP_US
+*					later. TIMER_NO_DEADLINE stops the channel.
+*	@param[in] deadline - Absolute wake-up time [us].
+********************************************************************************/
+static void TIMER_PortProgram(uint64_t deadline)
+{
+	uint64_t now;
+	uint32_t delay = 1;
+
+	PIT_DisableChannel(PIT_TIMER_CH);
+	PIT_ClearFlag(PIT_TIMER_CH);
+	if (deadline != TIMER_NO_DEADLINE)
+	{
+		now = TIMER_PortNow();
+		if (deadline > now)
+		{
+			delay = (deadline - now > TIMER_MAX_SLEEP_US) ? TIMER_MAX_SLEEP_US : (uint32_t)(deadline - now);
+		}
+		PIT_Setup(PIT_TIMER_CH, PIT_CLK/1000000, delay);
+		PIT_EnableChannel(PIT_TIMER_CH);
+	}
+}
+#endif
+
+/***************************************************************************//*!
+*   @brief The function TIMER_Lock blocks the timer interrupt.
+*	@par Include
+*					TIMER.h
+* 	@par Description
+*					The current priority is raised to INT_TIMER_PRIORITY if it
+*					is lower.
+*	@return Priority to be restored by TIMER_Unlock.
+********************************************************************************/
+static uint32_t TIMER_Lock(void)
+{
+#ifdef TIMER_HOST
+	return 0;
+#else
+	uint32_t stockPriority = INTC_0.CPR0.B.PRI;
+
+	if (stockPriority < INT_TIMER_PRIORITY)
+	{
+		INTC_0.CPR0.B.PRI = INT_TIMER_PRIORITY;
+	}
+	return stockPriority;
+#endif
+}
+
+/***************************************************************************//*!
+*   @brief The function TIMER_Unlock restores the priority saved by TIMER_Lock.
+*	@par Include
+*					TIMER.h
+*	@param[in] stockPriority - Value returned by TIMER_Lock.
+********************************************************************************/
+static void TIMER_Unlock(uint32_t stockPriority)
+{
+#ifdef TIMER_HOST
+	(void)stockPriority;
+#else
+	INTC_0.CPR0.B.PRI = stockPriority;
+#endif
+}
+
+/***************************************************************************//*!
+*   @brief The function TIMER_Insert links a timer into the wheel.
+*	@par Include
+*					TIMER.h
+* 	@par Description
+*					A deadline in the past is placed at the wheel time. The
+*					level is the highest differing bit of the deadline and the
+*					wheel time divided by TIMER_SLOT_BITS, the deadline is
+*					always ahead of the current slot of that level.
+*	@param[in] p_timer - Timer.
+********************************************************************************/
+static void TIMER_Insert(TIMER_Struct *p_timer)
+{
+	uint64_t expiry = p_timer->expiry;
+	uint64_t diff;
+	uint32_t level = 0;
+	uint32_t index;
+	TIMER_Link *p_head;
+
+	if (expiry < TIMERwheel.now)
+	{
+		expiry = TIMERwheel.now;
+	}
+	diff = expiry ^ TIMERwheel.now;
+	if (diff != 0)
+	{
+		level = (uint32_t)(63 - __builtin_clzll(diff)) / TIMER_SLOT_BITS;	//32-bit delays from a recent wheel time keep diff below 2^36
+	}
+	index = (uint32_t)(expiry >> (level * TIMER_SLOT_BITS)) & (TIMER_SLOTS - 1);
+
+	p_head = &TIMERwheel.slots[level][index];
+	p_timer->link.p_next = p_head;
+	p_timer->link.p_prev = p_head->p_prev;
+	p_head->p_prev->p_next = &p_timer->link;
+	p_head->p_prev = &p_timer->link;
+	TIMERwheel.occupied[level] |= 1ull << index;
+	p_timer->slot = level * TIMER_SLOTS + index;
+	p_timer->running = 1;
+}
+
+/***************************************************************************//*!
+*   @brief The function TIMER_Remove unlinks a timer.
+*	@par Include
+*					TIMER.h
+* 	@par Description
+*					The occupied bit is cleared when the wheel slot of the
+*					timer becomes empty. The timer may also be linked in the
+*					expiry list of TIMER_Process.
+*	@param[in] p_timer - Running timer.
+********************************************************************************/
+static void TIMER_Remove(TIMER_Struct *p_timer)
+{
+	TIMER_Link *p_head = &TIMERwheel.slots[0][0] + p_timer->slot;
+
+	p_timer->link.p_prev->p_next = p_timer->link.p_next;
+	p_timer->link.p_next->p_prev = p_timer->link.p_prev;
+	if (p_head->p_next == p_head)
+	{
+		TIMERwheel.occupied[p_timer->slot / TIMER_SLOTS] &= ~(1ull << (p_timer->slot & (TIMER_SLOTS - 1)));
+	}
+	p_timer->running = 0;
+}
+
+/***************************************************************************//*!
+*   @brief The function TIMER_NextEvent finds the nearest wheel event.
+*	@par Include
+*					TIMER.h
+* 	@par Description
+*					For each level the first occupied slot at or after the
+*					current one is taken from the occupied mask. The event is
+*					the expiry for the level 0 and the cascade time (start of
+*					the slot) for the upper levels.
+*	@param[out] p_level - Level of the event.
+*	@param[out] p_index - Slot of the event.
+*	@return Event time [us], TIMER_NO_DEADLINE if the wheel is empty.
+********************************************************************************/
+static uint64_t TIMER_NextEvent(uint32_t *p_level, uint32_t *p_index)
+{
+	uint64_t best = TIMER_NO_DEADLINE;
+	uint64_t event;
+	uint64_t pending;
+	uint32_t level;
+	uint32_t shift;
+	uint32_t index;
+
+	for (level = 0; level < TIMER_LEVELS; level++)
+	{
+		shift = level * TIMER_SLOT_BITS;
+		pending = TIMERwheel.occupied[level] & (~0ull << ((TIMERwheel.now >> shift) & (TIMER_SLOTS - 1)));
+		if (pending != 0)
+		{
+			index = (uint32_t)__builtin_ctzll(pending);
+			event = ((TIMERwheel.now >> (shift + TIMER_SLOT_BITS)) << (shift + TIMER_SLOT_BITS)) |
+					((uint64_t)index << shift);
+			if (event < best)
+			{
+				best = event;
+				*p_level = level;
+				*p_index = index;
+			}
+		}
+	}
+	return best;
+}
+
+/***************************************************************************//*!
+*   @brief The function TIMER_Init initializes the timer wheel.
+*	@par Include
+*					TIMER.h
+* 	@par Description
+*					The slot lists are emptied and the PIT channel PIT_TIMER_CH
+*					interrupt is enabled. The channel runs only while a timer
+*					is pending.
+*	@remarks 	PIT module and the timebase shall be initialized before (see
+*				PIT_Init and TIME_Init functions).
+*	@par Code sample
+*			TIMER_Init();
+********************************************************************************/
+void TIMER_Init(void)
+{
+	uint32_t level;
+	uint32_t index;
+
+	for (level = 0; level < TIMER_LEVELS; level++)
+	{
+		for (index = 0; index < TIMER_SLOTS; index++)
+		{
+			TIMERwheel.slots[level][index].p_next = &TIMERwheel.slots[level][index];
+			TIMERwheel.slots[level][index].p_prev = &TIMERwheel.slots[level][index];
+		}
+		TIMERwheel.occupied[level] = 0;
+	}
+	TIMERwheel.deadline = TIMER_NO_DEADLINE;
+	TIMERwheel.started = 0;
+	TIMERwheel.cancelled = 0;
+	TIMERwheel.expired = 0;
+	TIMERwheel.cascaded = 0;
+	TIMERwheel.wakeups = 0;
+
+#ifndef TIMER_HOST
+	PIT_DisableChannel(PIT_TIMER_CH);
+	PIT_EnableInt(PIT_TIMER_CH);
+#endif
+	TIMERwheel.now = TIMER_PortNow();
+}
+
+/***************************************************************************//*!
+*   @brief The function TIMER_Start starts a timer.
+*	@par Include
+*					TIMER.h
+* 	@par Description
+*					A running timer is restarted. The PIT channel is
+*					reprogrammed only if the new deadline is the nearest one.
+*					An empty wheel is first advanced to the current time, so
+*					the deadline stays within the TIMER_LEVELS levels after
+*					any idle time.
+*	@param[in] p_timer - Timer, shall be zeroed before the first start.
+*	@param[in] delay - First expiry from now [us].
+*	@param[in] period - Reload period [us], 0 - one-shot.
+*	@param[in] callback - Function called from the PIT interrupt.
+*	@param[in] p_arg - Callback argument.
+*	@remarks 	Callable from the main loop and from interrupts.
+*	@par Code sample
+*			static TIMER_Struct ledTimer;
+*			TIMER_Start(&ledTimer, 500000, 500000, Led_Toggle, 0);
+*			- Command calls Led_Toggle(0) every 500 ms.
+********************************************************************************/
+void TIMER_Start(TIMER_Struct *p_timer, uint32_t delay, uint32_t period, TIMER_Callback callback, void *p_arg)
+{
+	uint32_t stockPriority = TIMER_Lock();
+	uint64_t now = TIMER_PortNow();
+	uint64_t occupied = 0;
+	uint32_t level;
+
+	if (p_timer->running != 0)
+	{
+		TIMER_Remove(p_timer);
+	}
+	for (level = 0; level < TIMER_LEVELS; level++)
+	{
+		occupied |= TIMERwheel.occupied[level];
+	}
+	if ((occupied == 0) && (now > TIMERwheel.now))
+	{
+		TIMERwheel.now = now;					//no wake-up advances an empty wheel
+	}
+	p_timer->callback = callback;
+	p_timer->p_arg = p_arg;
+	p_timer->period = period;
+	p_timer->expiry = now + delay;
+	TIMER_Insert(p_timer);
+	TIMERwheel.started++;
+
+	if (p_timer->expiry < TIMERwheel.deadline)
+	{
+		TIMERwheel.deadline = p_timer->expiry;
+		TIMER_PortProgram(p_timer->expiry);
+	}
+	TIMER_Unlock(stockPriority);
+}
+
+/***************************************************************************//*!
+*   @brief The function TIMER_Cancel stops a timer.
+*	@par Include
+*					TIMER.h
+* 	@par Description
+*					The timer is unlinked, the PIT channel is left programmed
+*					(an early wake-up reprograms it to the next event).
+*	@param[in] p_timer - Timer.
+*	@remarks 	Callable from the callbacks, also for the calling timer.
+*	@par Code sample
+*			TIMER_Cancel(&ledTimer);
+********************************************************************************/
+void TIMER_Cancel(TIMER_Struct *p_timer)
+{
+	uint32_t stockPriority = TIMER_Lock();
+
+	if (p_timer->running != 0)
+	{
+		TIMER_Remove(p_timer);
+		TIMERwheel.cancelled++;
+	}
+	TIMER_Unlock(stockPriority);
+}
+
+/***************************************************************************//*!
+*   @brief The function TIMER_IsRunning returns the timer state.
+*	@par Include
+*					TIMER.h
+*	@param[in] p_timer - Timer.
+*	@return 1 - timer pending, 0 - expired one-shot or cancelled timer.
+********************************************************************************/
+uint32_t TIMER_IsRunning(const TIMER_Struct *p_timer)
+{
+	return p_timer->running;
+}
+
+/***************************************************************************//*!
+*   @brief The function TIMER_Now returns the time of the timer wheel clock.
+*	@par Include
+*					TIMER.h
+*	@return Time [us].
+********************************************************************************/
+uint64_t TIMER_Now(void)
+{
+	return TIMER_PortNow();
+}
+
+/***************************************************************************//*!
+*   @brief The function TIMER_Process advances the wheel.
+*	@par Include
+*					TIMER.h
+* 	@par Description
+*					The events up to the given time are handled in time order:
+*					an upper level slot is cascaded, a level 0 slot is expired.
+*					A periodic timer is reloaded from its previous expiry
+*					before its callback is called, so the callback may cancel
+*					or restart it. The wake-up is then programmed to the next
+*					event.
+*	@param[in] target - Time to advance the wheel to [us].
+*	@remarks 	Called by TIMER_IsrPIT (or by the host tool).
+********************************************************************************/
+void TIMER_Process(uint64_t target)
+{
+	TIMER_Link expired;
+	TIMER_Link *p_head;
+	TIMER_Struct *p_timer;
+	uint64_t event;
+	uint32_t level = 0;
+	uint32_t index = 0;
+	uint32_t stockPriority = TIMER_Lock();
+
+	while ((event = TIMER_NextEvent(&level, &index)) <= target)
+	{
+		if (event > TIMERwheel.now)
+		{
+			TIMERwheel.now = event;
+		}
+
+		//move the slot list to the local expiry list
+		p_head = &TIMERwheel.slots[level][index];
+		expired.p_next = p_head->p_next;
+		expired.p_prev = p_head->p_prev;
+		expired.p_next->p_prev = &expired;
+		expired.p_prev->p_next = &expired;
+		p_head->p_next = p_head;
+		p_head->p_prev = p_head;
+		TIMERwheel.occupied[level] &= ~(1ull << index);
+
+		while (expired.p_next != &expired)
+		{
+			p_timer = (TIMER_Struct*)expired.p_next;
+			expired.p_next = p_timer->link.p_next;
+			expired.p_next->p_prev = &expired;
+
+			if (level != 0)
+			{
+				TIMER_Insert(p_timer);
+				TIMERwheel.cascaded++;
+			}
+			else
+			{
+				p_timer->running = 0;
+				TIMERwheel.expired++;
+				if (p_timer->period != 0)
+				{
+					p_timer->expiry += p_timer->period;
+					TIMER_Insert(p_timer);
+				}
+				p_timer->callback(p_timer->p_arg);
+			}
+		}
+	}
+	if (target > TIMERwheel.now)
+	{
+		TIMERwheel.now = target;
+	}
+
+	if (event != TIMERwheel.deadline)
+	{
+		TIMERwheel.deadline = event;
+		TIMER_PortProgram(event);
+	}
+	TIMER_Unlock(stockPriority);
+}
+
+#ifndef TIMER_HOST
+/***************************************************************************//*!
+*   @brief The function TIMER_IsrPIT handles the wake-up of the timer wheel.
+*	@par Include
+*					TIMER.h
+* 	@par Description
+*					PIT channel PIT_TIMER_CH interrupt (INT_TIMER_PRIORITY).
+*					The one-shot is stopped and the wheel is advanced to the
+*					current time.
+********************************************************************************/
+void TIMER_IsrPIT(void)
+{
+	PIT_DisableChannel(PIT_TIMER_CH);
+	PIT_ClearFlag(PIT_TIMER_CH);
+	TIMERwheel.wakeups++;
+	TIMERwheel.deadline = TIMER_NO_DEADLINE;
+	TIMER_Process(TIMER_PortNow());
+}
+#endif
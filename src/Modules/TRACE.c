@@ -0,0 +1,194 @@
+/*******************************************************************************
+*
+* Freescale Semiconductor Inc.
+* (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+* ALL RIGHTS RESERVED.
+*
+********************************************************************************
+*
+* $File Name:       TRACE.c$
+* @file             TRACE.c
+*
+* $Date:            Oct-19-2026$
+* @date             Oct-19-2026
+*
+* $Version:         0.1$
+* @version          0.1
+*
+* Description:      Interrupt entry/exit trace source file
+* @brief            Interrupt entry/exit trace source file
+*
+* --------------------------------------------------------------------
+* $Name:  $
+*******************************************************************************/
+/****************************************************************************//*!
+*
+*  @mainpage Interrupt entry/exit trace for MPC5744P
+*
+*  @section Intro Introduction
+*
+*	This package contains the buffer of the interrupt trace and its analysis.
+*	The records are written by the IVOR4 dispatcher (intc_sw_handlers.S):
+*	the prologue stores the IACKR value and the entry time in the stack frame
+*	and increments TRACEdepth, the epilogue (MSR[EE] cleared) decrements
+*	TRACEdepth, claims TRACEhead and writes the record.
+*	A handler completes after all interrupts nested in it, so the records of
+*	the interrupts preempting a handler are the records with a higher depth
+*	written just before its own record.
+*
+*  The key features of this package are the following:
+*  - Buffer and counters in the local data RAM (single cycle access)
+*  - Statistics of a vector derived from the buffer, without stopping it
+*
+*  For more information about the functions and configuration items see these documents:
+*
+*******************************************************************************
+*
+* @attention
+*
+*******************************************************************************/
+/*==================================================================================================
+*   Project              : PowerSBC
+*   Platform             : MPC5744P
+*   Dependencies         : MPC5744P - Basic SW drivers.
+*   All Rights Reserved.
+==================================================================================================*/
+
+/*==================================================================================================
+Revision History:
+                             Modification     Function
+Author (core ID)              Date D/M/Y       Name		  Description of Changes
+BRNY001					      19/10/2026 	   ALL		  Driver created
+BRNY001					      19/10/2026 	   TRACE_Init	  Buffer cleared by the startup code (DRAM_BSS)
+
+---------------------------   ----------    ------------  ------------------------------------------
+==================================================================================================*/
+
+#include "MPC5744P_drv.h"
+#include "TRACE.h"
+
+#if TRACE_ISR
+
+DRAM_BSS TRACE_Record TRACEbuffer[TRACE_SIZE];
+DRAM_BSS vuint32_t TRACEhead;
+DRAM_BSS vuint32_t TRACEdepth;
+
+/***************************************************************************//*!
+*   @brief The function TRACE_Copy reads a record of the buffer.
+*	@par Include
+*					TRACE.h
+* 	@par Description
+*					The record is copied and then checked: it shall carry the
+*					requested sequence number and its slot shall not have been
+*					claimed by a newer record during the copy.
+*	@param[in] sequence - Record number.
+*	@param[out] p_record - Copy of the record.
+*	@return 1 - valid copy, 0 - record overwritten.
+********************************************************************************/
+static uint32_t TRACE_Copy(uint32_t sequence, TRACE_Record *p_record)
+{
+	*p_record = TRACEbuffer[sequence & (TRACE_SIZE - 1)];
+	return ((p_record->sequence == sequence) && ((TRACEhead - sequence) <= TRACE_SIZE)) ? 1 : 0;
+}
+
+/***************************************************************************//*!
+*   @brief The function TRACE_Init clears the interrupt trace.
+*	@par Include
+*					TRACE.h
+* 	@par Description
+*					Restarts the trace: counters and sequence numbers of the
+*					records (.dram_bss is cleared by the startup code only).
+*	@remarks 	Shall be called before the interrupts are enabled
+*				(xcptn_xmpl), the time base shall run (TIME_Init).
+*	@par Code sample
+*			TRACE_Init();
+********************************************************************************/
+void TRACE_Init(void)
+{
+	uint32_t i;
+
+	for (i = 0; i < TRACE_SIZE; i++)
+	{
+		TRACEbuffer[i].sequence = 0xFFFFFFFF;
+	}
+	TRACEdepth = 0;
+	TRACEhead = 0;
+}
+
+/***************************************************************************//*!
+*   @brief The function TRACE_GetStats computes the statistics of a vector.
+*	@par Include
+*					TRACE.h
+* 	@par Description
+*					All records of the vector present in the buffer are taken.
+*					The execution time of a record is its exit minus entry time
+*					minus the time of the interrupts nested in it (records of
+*					depth + 1 written just before it).
+*	@param[in] vector - INTC vector number.
+*	@param[out] p_stats - Statistics (count 0 if the vector is not in the
+*					buffer).
+*	@remarks 	Callable while the trace runs, overwritten records are
+*				skipped.
+*	@par Code sample
+*			TRACE_GetStats(226, &stats);
+*			- Command returns the statistics of the watchdog PIT interrupt.
+********************************************************************************/
+void TRACE_GetStats(uint32_t vector, TRACE_Stats *p_stats)
+{
+	TRACE_Record record;
+	TRACE_Record nested;
+	uint32_t head = TRACEhead;
+	uint32_t first = (head > TRACE_SIZE) ? head - TRACE_SIZE : 0;
+	uint32_t sequence;
+	uint32_t previous;
+	uint32_t ticks;
+	uint64_t sum = 0;
+
+	p_stats->count = 0;
+	p_stats->preemptions = 0;
+	p_stats->minTicks = 0xFFFFFFFF;
+	p_stats->maxTicks = 0;
+	p_stats->meanTicks = 0;
+
+	for (sequence = first; sequence != head; sequence++)
+	{
+		if ((TRACE_Copy(sequence, &record) == 0) || (record.vector != vector))
+		{
+			continue;
+		}
+		ticks = record.exit - record.entry;
+		for (previous = sequence; previous != first; previous--)
+		{
+			if ((TRACE_Copy(previous - 1, &nested) == 0) || (nested.depth <= record.depth))
+			{
+				break;
+			}
+			if (nested.depth == record.depth + 1)
+			{
+				ticks -= nested.exit - nested.entry;
+				p_stats->preemptions++;
+			}
+		}
+		p_stats->count++;
+		sum += ticks;
+		if (ticks < p_stats->minTicks)
+		{
+			p_stats->minTicks = ticks;
+		}
+		if (ticks > p_stats->maxTicks)
+		{
+			p_stats->maxTicks = ticks;
+		}
+	}
+
+	if (p_stats->count != 0)
+	{
+		p_stats->meanTicks = (uint32_t)(sum / p_stats->count);
+	}
+	else
+	{
+		p_stats->minTicks = 0;
+	}
+}
+
+#endif
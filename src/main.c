@@ -64,6 +64,14 @@
   Author (core ID)              Date D/M/Y       Name		  Description of Changes
   B35993		 	      13/08/2014       ALL		  Driver created
   BRNY001			      26/10/2015       ALL		  Driver adapted to FS65xx
+  BRNY001			      19/10/2026       main		  Loop paced by a periodic timer of the timer wheel
+  BRNY001			      19/10/2026       main		  Monotonic timebase started first (bounded driver waits)
+  BRNY001			      19/10/2026       main		  Interrupt trace cleared before the interrupts are enabled
+  BRNY001			      19/10/2026       main		  Deferred work queues cleared before the interrupts are enabled
+  BRNY001			      19/10/2026       main		  Peripheral and FS65xx initialization run as BOOT stages
+  BRNY001			      19/10/2026       main		  Warm resume snapshot saved before LPOFF (FS65_SaveVkam)
+  BRNY001			      19/10/2026       main		  SPI trace initialized with SPITRACE_ENABLE (not TRACE_ISR)
+  BRNY001			      19/10/2026       Main_SafeState	  SAFE mode on a timed out FCCU or mode entry operation
   ---------------------------   ----------    ------------  ------------------------------------------
   ==================================================================================================*/
 
@@ -78,36 +86,57 @@
 #include "SIUL.h"
 #include "PIT.h"
 #include "CAN.h"
+#include "GUI.h"
+#include "TIME.h"
+#include "TIMER.h"
+#include "TRACE.h"
+#include "SPITRACE.h"
+#include "DEFER.h"
+#include "BOOT.h"
 
 #define FORCE_FS65_INIT
 
 __attribute__ ((section(".text")))
 extern void xcptn_xmpl(void);
 
-/**********************************************************************/
-/* Functions tested with the MPC5744P-257DC + the FS6522 demo board   */
-/**********************************************************************/
+static TIMER_Struct loopTimer;		///10 ms period of the main loop
+static vuint32_t loopTick;			///set by the loop timer
 
-int main()
+static void Main_LoopTick(void *p_arg)
 {
+    (void)p_arg;
+    loopTick = 1;
+}
 
-    uint32_t error_code;
-    uint8_t index;
-
-/* Enable all PBridge Masters for Reads, Writes, and Master Privilege Mode. */
-    AIPS_0.MPRA.R = 0x77777777;
-    AIPS_1.MPRA.R = 0x77777777;
-
-/* Configure FCCU */
-    FCCU_SetProtocol(FCCU_BI_STABLE);		//set Bi-Stable protocol if not in the SAFE mode
-
-/* Init MODE ENTRY module */
-    MC_MODE_INIT();                             /* (pll_init) Setup the MCU clocks and modes */
-
-/* Init interrupt controller */
-    xcptn_xmpl ();              /* Configure and Enable Interrupts */
+/* Platform not set up (FCCU_SetProtocol / MC_MODE_INIT timed out): SAFE   */
+/* mode, no FS65xx initialization - the FS65xx resets the MCU at the end  */
+/* of its INIT_FS phase                                                   */
+static void Main_SafeState(void)
+{
+    MC_ME.MCTL.R = 0x20005AF0;                  /* SAFE mode & Key */
+    MC_ME.MCTL.R = 0x2000A50F;                  /* SAFE mode & Key inverted */
+    for (;;)
+    {}
+}
 
-/* INIT SIUL */
+/**********************************************************************/
+/* Boot stages (BOOT.c): MCU peripherals set up during the FS65xx     */
+/* ABIST2 runs                                                        */
+/**********************************************************************/
+#define MAIN_STAGE_PADS		0
+#define MAIN_STAGE_DSPI		1
+#define MAIN_STAGE_TIMERS	2
+#define MAIN_STAGE_FS65		3
+#define MAIN_STAGE_WD		4
+#define MAIN_STAGE_CAN		5
+#define MAIN_STAGE_ADC		6
+#define MAIN_STAGE_GUI		7
+#define MAIN_STAGE_LDT		8
+#define MAIN_STAGE_NB		9
+
+static uint32_t Main_BootPads(uint32_t *p_waitUs)
+{
+    (void)p_waitUs;
     //PA0 interfaces IRQ signal from FS65xx
     SIUL_DigitalInput(SIUL_PA0,173,0,1);	//MPC5744P:P8[1] to FS65:J37[12]
     SIUL_EnableExtIntFallingEdge(1);
@@ -122,61 +151,100 @@ int main()
     SIUL_DigitalIO(SIUL_PA2,0);				//MPC5744P:P8[3]
     SIUL_ClearPad(SIUL_PA2);
     //SIUL_ToggleIO(SIUL_PA2);
+    return BOOT_DONE;
+}
 
-/* Init CAN */
-    CAN_Init(0);
-    CAN_ConfigurePads(0);  //PB0 = CAN0_TX (MPC5744P:J17[5] to FS65:J37[18])
-    					   //PB1 = CAN0_RX (MPC5744P:J17[2] to FS65:J37[19])
-
-/* Init ADC0 */
-    ADCstruct.scanVoltage.R = 0x8F;				//Scan 2.5V reference, wide voltages and temperature
-    ADC_Init(ADC_NB, ADC_MASK, 0, ONE_SHOT);	//PB7 (P9[1]) and PB8(P9[2]) as analog inputs:
-    ADC_SetInt(ADC_NB, EOC_FLAG, ADC_MASK);		//Enable EOC interrupt
-
-/* Init DSPI */
+static uint32_t Main_BootDSPI(uint32_t *p_waitUs)
+{
+    (void)p_waitUs;
     DSPI_Init(DSPI_NB, MASTER, DSPI_CLK, 1000000, 0);		//DSPI initialization as a MASTER, RFDF interrupt flag
     //PC7 (P10[8]) = SIN_0
     //PC6 (P10[7]) = SOUT
     //PC5 (P10[6]) = SCK
     //PC4 (P10[5]) = CS0
+    return BOOT_DONE;
+}
 
+static uint32_t Main_BootTimers(uint32_t *p_waitUs)
+{
+    (void)p_waitUs;
 /* Init PIT module for watchdog refresh */
     PIT_Init();
    	PIT_Setup(PIT_WD_CH, PIT_CLK/1000000, 3000);  //3msec refresh period
    	PIT_EnableInt(PIT_WD_CH);
 
-/* if power-on reset, FS65xx initialization*/
-
-#ifndef FORCE_FS65_INIT
-    if ( (MC_RGM.DES.B.F_VOR_DEST==1) || (MC_RGM.DES.B.F_POR==1) )
-    {
-#endif
-
-	  //Clear VOR and POR flags
-	  MC_RGM.DES.B.F_VOR_DEST = 1;
-	  MC_RGM.DES.B.F_POR      = 1;
-	  //Init FS65xx
-	  FS65_Init();
-	  // Start WD refresh
-	  PIT_EnableChannel(PIT_WD_CH);
-	  //Configure non-init registers
-	  FS65_Config_NonInit();
+/* Init software timers (PIT_TIMER_CH) */
+    TIMER_Init();
+    return BOOT_DONE;
+}
 
+/* if power-on reset or wake-up from LPOFF, FS65xx initialization (resumed after each  */
+/* FS65_InitStep wait, from the keep-alive RAM snapshot after LPOFF)                  */
+static uint32_t Main_BootFS65(uint32_t *p_waitUs)
+{
 #ifndef FORCE_FS65_INIT
-    }
-    else
+    if ( (MC_RGM.DES.B.F_VOR_DEST==0) && (MC_RGM.DES.B.F_POR==0) && (FS65_CheckVkam() != FS65_RETURN_OK)
+         && (BOOTstats[MAIN_STAGE_FS65].calls == 0) )
     {
       // Start WD refresh
       PIT_EnableChannel(PIT_WD_CH);
 	  //Reset was not caused by FS65xx
 	  //Get FS65xx status
 	  FS65_GetStatus();
-	  //Configure non-init registers
-	  FS65_Config_NonInit();
+	  return BOOT_DONE;
     }
 #endif
+    if (BOOTstats[MAIN_STAGE_FS65].calls == 0)
+    {
+	  //Clear VOR and POR flags
+	  MC_RGM.DES.B.F_VOR_DEST = 1;
+	  MC_RGM.DES.B.F_POR      = 1;
+    }
+	//Init FS65xx
+    return (FS65_InitStep(p_waitUs) == FS65_INIT_WAIT) ? BOOT_WAIT : BOOT_DONE;
+}
 
- /* Long duration Timer configuration */
+static uint32_t Main_BootWatchdog(uint32_t *p_waitUs)
+{
+    (void)p_waitUs;
+	// Start WD refresh
+	PIT_EnableChannel(PIT_WD_CH);
+	//Configure non-init registers
+	FS65_Config_NonInit();
+    return BOOT_DONE;
+}
+
+static uint32_t Main_BootCAN(uint32_t *p_waitUs)
+{
+    (void)p_waitUs;
+    CAN_Init(0);
+    CAN_ConfigurePads(0);  //PB0 = CAN0_TX (MPC5744P:J17[5] to FS65:J37[18])
+    					   //PB1 = CAN0_RX (MPC5744P:J17[2] to FS65:J37[19])
+    return BOOT_DONE;
+}
+
+static uint32_t Main_BootADC(uint32_t *p_waitUs)
+{
+    (void)p_waitUs;
+    ADCstruct.scanVoltage.R = 0x8F;				//Scan 2.5V reference, wide voltages and temperature
+    ADC_Init(ADC_NB, ADC_MASK, 0, ONE_SHOT);	//PB7 (P9[1]) and PB8(P9[2]) as analog inputs:
+    ADC_SetInt(ADC_NB, EOC_FLAG, ADC_MASK);		//Enable EOC interrupt
+    return BOOT_DONE;
+}
+
+static uint32_t Main_BootGUI(uint32_t *p_waitUs)
+{
+    (void)p_waitUs;
+    LINFLEX_InitUART(LINFLEX_UART_NB, LINFLEX_CLK, LINFLEX_UART_BR);
+    GUI_Init();
+    return BOOT_DONE;
+}
+
+static uint32_t Main_BootLDT(uint32_t *p_waitUs)
+{
+    uint32_t error_code;
+
+    (void)p_waitUs;
     //Configuration for Func 1 : generate an INT pulse after 15sec
     error_code = FS65_SetLDTNormalMode();
     error_code = FS65_SelectLDTOperation(LDT_FUNCTION_1);
@@ -187,20 +255,87 @@ int main()
 
     SIUL_ToggleIO(SIUL_PA1);
     error_code = FS65_StartLDTCounter();
+    (void)error_code;
+    return BOOT_DONE;
+}
+
+///Stages in priority order: the WD refresh starts as soon as the FS65xx is initialized
+static const BOOT_Stage mainBoot[MAIN_STAGE_NB] = {
+    {"pads",	Main_BootPads,		0},
+    {"DSPI",	Main_BootDSPI,		0},
+    {"timers",	Main_BootTimers,	0},
+    {"FS65",	Main_BootFS65,		BOOT_AFTER(MAIN_STAGE_PADS) | BOOT_AFTER(MAIN_STAGE_DSPI) | BOOT_AFTER(MAIN_STAGE_TIMERS)},
+    {"WD",		Main_BootWatchdog,	BOOT_AFTER(MAIN_STAGE_FS65)},
+    {"CAN",		Main_BootCAN,		0},
+    {"ADC",		Main_BootADC,		0},
+    {"GUI",		Main_BootGUI,		BOOT_AFTER(MAIN_STAGE_TIMERS)},
+    {"LDT",		Main_BootLDT,		BOOT_AFTER(MAIN_STAGE_WD)},
+};
+
+/**********************************************************************/
+/* Functions tested with the MPC5744P-257DC + the FS6522 demo board   */
+/**********************************************************************/
+
+int main()
+{
+
+    uint8_t index;
+
+/* Start the monotonic timebase (core time base at SYS_CLK), used by the driver waits */
+    TIME_Init();
+
+/* Enable all PBridge Masters for Reads, Writes, and Master Privilege Mode. */
+    AIPS_0.MPRA.R = 0x77777777;
+    AIPS_1.MPRA.R = 0x77777777;
+
+/* Configure FCCU */
+    if (FCCU_SetProtocol(FCCU_BI_STABLE) != FCCU_RETURN_OK)		//set Bi-Stable protocol if not in the SAFE mode
+    {
+	Main_SafeState();
+    }
+
+/* Init MODE ENTRY module */
+    if (MC_MODE_INIT() != ME_RETURN_OK)         /* (pll_init) Setup the MCU clocks and modes */
+    {
+	Main_SafeState();
+    }
+
+/* Init interrupt controller */
+#if TRACE_ISR
+    TRACE_Init();               /* Clear the interrupt trace (local data RAM) */
+#endif
+#if SPITRACE_ENABLE
+    SPITRACE_Init();            /* Clear the SPI frame trace (local data RAM) */
+#endif
+    DEFER_Init();               /* Clear the deferred work queues */
+    xcptn_xmpl ();              /* Configure and Enable Interrupts */
+
+/* Peripherals and FS65xx (BOOTstats, BOOToperationalTicks, BOOT_CriticalPath) */
+    (void)BOOT_Run(mainBoot, MAIN_STAGE_NB);
 
 /* Start infinite loop */
+   TIMER_Start(&loopTimer, 10000, 10000, Main_LoopTick, 0);
    for (index=0; index <= 8; index++)
     {
 	  ///Launch and configure ADC conversion
 	  ADC_StartNormalConversion(ADC_NB, ADC_MASK);
 
-	  //wait 10msec
-	  PIT_wait_micsec(10000);
+	  //wait for the next 10msec tick
+	  while (loopTick == 0)
+	  {}
+	  loopTick = 0;
 
 	  //Send CAN_Frame
 	  CAN_Send(0, 0, 0xA0A0A0A0A0A0A0A0, 0x15555555);
 
+	  //Bus-off recovery and requeue of pending frames
+	  CAN_ErrorTask(0);
+
+	  //Stream changed registers and measured values to the GUI
+	  GUI_Task();
+
    }
+   TIMER_Cancel(&loopTimer);
 
   /*
    *  Go to LPOFF mode with automatic wake-up after #1msec
@@ -213,6 +348,8 @@ int main()
    if (INTstruct.DIAG_SF_ERR.B.FLT_ERR == 0)
    {
   	 SIUL_ToggleIO(SIUL_PA2);
+  	 FS65_EnableVKAM();				//keep-alive supply during LPOFF
+  	 FS65_SaveVkam();				//warm resume after the wake-up
   	 FS65_SetLPOFFmode_autoWU();
   }
 